@@ -0,0 +1,205 @@
+// Copyright 2021 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_ARENA_ALLOCATOR_HPP
+#define JSONCONS_ARENA_ALLOCATOR_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <new> // ::operator new
+#include <type_traits>
+#include <jsoncons/config/jsoncons_config.hpp>
+#include <jsoncons/basic_json.hpp>
+
+namespace jsoncons {
+
+    // arena hands out memory from large blocks and frees it all at once,
+    // when release() is called or the arena is destroyed.
+    // Deallocating individual allocations is a no-op.
+
+    class arena
+    {
+        struct block
+        {
+            block* next;
+            std::size_t size;
+        };
+
+        static constexpr std::size_t default_block_size = 65536;
+        static constexpr std::size_t max_block_size = std::size_t(1) << 24;
+
+        block* head_;
+        char* current_;
+        char* end_;
+        std::size_t initial_block_size_;
+        std::size_t next_block_size_;
+        std::size_t bytes_reserved_;
+
+        // Noncopyable and nonmoveable
+        arena(const arena&) = delete;
+        arena& operator=(const arena&) = delete;
+    public:
+        explicit arena(std::size_t initial_block_size = default_block_size) noexcept
+            : head_(nullptr), current_(nullptr), end_(nullptr),
+              initial_block_size_(initial_block_size > sizeof(block) ? initial_block_size : default_block_size),
+              next_block_size_(initial_block_size_),
+              bytes_reserved_(0)
+        {
+        }
+
+        ~arena() noexcept
+        {
+            release();
+        }
+
+        void* allocate(std::size_t size, std::size_t alignment)
+        {
+            char* p = align_up(current_, alignment);
+            if (p == nullptr || p > end_ || static_cast<std::size_t>(end_ - p) < size)
+            {
+                add_block(size + alignment);
+                p = align_up(current_, alignment);
+            }
+            current_ = p + size;
+            return p;
+        }
+
+        // Frees all blocks. Values allocated from the arena must not be used afterwards.
+        void release() noexcept
+        {
+            while (head_ != nullptr)
+            {
+                block* next = head_->next;
+                ::operator delete(head_);
+                head_ = next;
+            }
+            current_ = nullptr;
+            end_ = nullptr;
+            next_block_size_ = initial_block_size_;
+            bytes_reserved_ = 0;
+        }
+
+        // Total size of the blocks obtained from the heap
+        std::size_t bytes_reserved() const noexcept
+        {
+            return bytes_reserved_;
+        }
+
+    private:
+        static char* align_up(char* p, std::size_t alignment) noexcept
+        {
+            if (p == nullptr)
+            {
+                return nullptr;
+            }
+            auto n = reinterpret_cast<std::uintptr_t>(p);
+            return p + ((alignment - (n % alignment)) % alignment);
+        }
+
+        void add_block(std::size_t min_size)
+        {
+            std::size_t size = next_block_size_;
+            while (size - sizeof(block) < min_size)
+            {
+                size *= 2;
+            }
+            block* b = static_cast<block*>(::operator new(size));
+            b->next = head_;
+            b->size = size;
+            head_ = b;
+            current_ = reinterpret_cast<char*>(b) + sizeof(block);
+            end_ = reinterpret_cast<char*>(b) + size;
+            bytes_reserved_ += size;
+            if (next_block_size_ < max_block_size)
+            {
+                next_block_size_ *= 2;
+            }
+        }
+    };
+
+    // arena_allocator allocates from an arena. A default constructed arena_allocator
+    // has no arena and uses the heap, so that code that default constructs an
+    // allocator keeps working. Two arena_allocators are equal if they use the same arena.
+
+    template <class T>
+    class arena_allocator
+    {
+        template <class U> friend class arena_allocator;
+
+        arena* arena_;
+    public:
+        using value_type = T;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using propagate_on_container_copy_assignment = std::true_type;
+        using propagate_on_container_move_assignment = std::true_type;
+        using propagate_on_container_swap = std::true_type;
+
+        template <class U>
+        struct rebind
+        {
+            using other = arena_allocator<U>;
+        };
+
+        arena_allocator() noexcept
+            : arena_(nullptr)
+        {
+        }
+
+        arena_allocator(arena& a) noexcept
+            : arena_(std::addressof(a))
+        {
+        }
+
+        template <class U>
+        arena_allocator(const arena_allocator<U>& other) noexcept
+            : arena_(other.arena_)
+        {
+        }
+
+        arena* get_arena() const noexcept
+        {
+            return arena_;
+        }
+
+        T* allocate(size_type n)
+        {
+            if (arena_ == nullptr)
+            {
+                return static_cast<T*>(::operator new(n*sizeof(T)));
+            }
+            return static_cast<T*>(arena_->allocate(n*sizeof(T), alignof(T)));
+        }
+
+        void deallocate(T* p, size_type) noexcept
+        {
+            if (arena_ == nullptr)
+            {
+                ::operator delete(p);
+            }
+        }
+
+        template <class U>
+        friend bool operator==(const arena_allocator& lhs, const arena_allocator<U>& rhs) noexcept
+        {
+            return lhs.arena_ == rhs.get_arena();
+        }
+
+        template <class U>
+        friend bool operator!=(const arena_allocator& lhs, const arena_allocator<U>& rhs) noexcept
+        {
+            return lhs.arena_ != rhs.get_arena();
+        }
+    };
+
+    typedef basic_json<char,sorted_policy,arena_allocator<char>> json_arena;
+    typedef basic_json<wchar_t,sorted_policy,arena_allocator<char>> wjson_arena;
+    typedef basic_json<char,preserve_order_policy,arena_allocator<char>> ojson_arena;
+    typedef basic_json<wchar_t,preserve_order_policy,arena_allocator<char>> wojson_arena;
+
+} // namespace jsoncons
+
+#endif // JSONCONS_ARENA_ALLOCATOR_HPP
@@ -33,10 +33,13 @@
 #include <jsoncons/json_encoder.hpp>
 #include <jsoncons/json_decoder.hpp>
 #include <jsoncons/json_reader.hpp>
+#include <jsoncons/json_index_parser.hpp>
 #include <jsoncons/json_type_traits.hpp>
 #include <jsoncons/byte_string.hpp>
 #include <jsoncons/json_error.hpp>
 #include <jsoncons/detail/string_wrapper.hpp>
+#include <jsoncons/detail/heap_value.hpp>
+#include <jsoncons/detail/hash_mix.hpp>
 
 namespace jsoncons { 
 
@@ -249,6 +252,30 @@ struct preserve_order_policy : public sorted_policy
     using key_order = preserve_key_order;
 };
 
+// Objects keep a hash index of their members, for constant time lookup by key
+
+struct sorted_hash_policy : public sorted_policy
+{
+    using key_index = hash_key_index;
+};
+
+struct preserve_order_hash_policy : public preserve_order_policy
+{
+    using key_index = hash_key_index;
+};
+
+// Arrays and objects are shared between copies, and copied on first mutation
+
+struct sorted_cow_policy : public sorted_policy
+{
+    using container_sharing = copy_on_write_sharing;
+};
+
+struct preserve_order_cow_policy : public preserve_order_policy
+{
+    using container_sharing = copy_on_write_sharing;
+};
+
 template <class IteratorT, class ConstIteratorT>
 class range 
 {
@@ -688,6 +715,33 @@ private:
         }
     };
 
+    static std::size_t hash_array(const array& val) noexcept
+    {
+        uint64_t h = 6;
+        for (const auto& item : val)
+        {
+            h = jsoncons::detail::hash_combine(h, item.hash());
+        }
+        return static_cast<std::size_t>(h);
+    }
+
+    static std::size_t hash_object(const object& val) noexcept
+    {
+        // The sum of the member hashes does not depend on member order
+        uint64_t sum = 0;
+        for (const auto& member : val)
+        {
+            sum += jsoncons::detail::hash_combine(jsoncons::detail::hash_chars(member.key().data(), member.key().size()), 
+                                                  member.value().hash());
+        }
+        return static_cast<std::size_t>(jsoncons::detail::hash_combine(7, sum));
+    }
+
+    template <class T>
+    using heap_value_type = typename std::conditional<is_copy_on_write<ImplementationPolicy>::value,
+                                                      jsoncons::detail::shared_heap_value<T,Allocator>,
+                                                      jsoncons::detail::unique_heap_value<T,Allocator>>::type;
+
     // array_storage
     class array_storage final
     {
@@ -696,89 +750,67 @@ private:
         uint8_t length_:4;
         semantic_tag tag_;
     private:
-        using array_allocator = typename std::allocator_traits<Allocator>:: template rebind_alloc<array>;
-        using pointer = typename std::allocator_traits<array_allocator>::pointer;
-
-        pointer ptr_;
-
-        template <typename... Args>
-        void create(array_allocator alloc, Args&& ... args)
-        {
-            ptr_ = std::allocator_traits<array_allocator>::allocate(alloc, 1);
-            JSONCONS_TRY
-            {
-                std::allocator_traits<array_allocator>::construct(alloc, jsoncons::detail::to_plain_pointer(ptr_), std::forward<Args>(args)...);
-            }
-            JSONCONS_CATCH(...)
-            {
-                std::allocator_traits<array_allocator>::deallocate(alloc, ptr_,1);
-                JSONCONS_RETHROW;
-            }
-        }
-
-        void destroy() noexcept
-        {
-            array_allocator alloc(ptr_->get_allocator());
-            std::allocator_traits<array_allocator>::destroy(alloc, jsoncons::detail::to_plain_pointer(ptr_));
-            std::allocator_traits<array_allocator>::deallocate(alloc, ptr_,1);
-        }
+        heap_value_type<array> holder_;
     public:
         array_storage(const array& val, semantic_tag tag)
-            : storage_(static_cast<uint8_t>(storage_kind::array_value)), length_(0), tag_(tag)
+            : storage_(static_cast<uint8_t>(storage_kind::array_value)), length_(0), tag_(tag),
+              holder_(val.get_allocator(), val)
         {
-            create(val.get_allocator(), val);
         }
 
         array_storage(const array& val, semantic_tag tag, const Allocator& a)
-            : storage_(val.storage_), length_(0), tag_(tag)
+            : storage_(val.storage_), length_(0), tag_(tag),
+              holder_(a, val, a)
         {
-            create(array_allocator(a), val, a);
         }
 
         array_storage(const array_storage& val)
-            : storage_(val.storage_), length_(0), tag_(val.tag_)
+            : storage_(val.storage_), length_(0), tag_(val.tag_),
+              holder_(val.holder_)
         {
-            create(val.ptr_->get_allocator(), *(val.ptr_));
         }
 
         array_storage(array_storage&& val) noexcept
             : storage_(val.storage_), length_(0), tag_(val.tag_),
-              ptr_(nullptr)
+              holder_(std::move(val.holder_))
         {
-            std::swap(val.ptr_, ptr_);
         }
 
         array_storage(const array_storage& val, const Allocator& a)
-            : storage_(val.storage_), length_(0), tag_(val.tag_)
-        {
-            create(array_allocator(a), *(val.ptr_), a);
-        }
-        ~array_storage() noexcept
+            : storage_(val.storage_), length_(0), tag_(val.tag_),
+              holder_(val.holder_, a)
         {
-            if (ptr_ != nullptr)
-            {
-                destroy();
-            }
         }
 
         allocator_type get_allocator() const
         {
-            return ptr_->get_allocator();
+            return holder_.get().get_allocator();
         }
 
         void swap(array_storage& val) noexcept
         {
-            std::swap(val.ptr_,ptr_);
+            holder_.swap(val.holder_);
         }
 
         array& value()
         {
-            return *ptr_;
+            return holder_.get();
         }
 
         const array& value() const
         {
-            return *ptr_;
+            return holder_.get();
+        }
+
+        std::size_t hash() const noexcept
+        {
+            std::size_t h;
+            if (!holder_.cached_hash(h))
+            {
+                h = hash_array(holder_.get());
+                holder_.cache_hash(h);
+            }
+            return h;
         }
     };
 
@@ -790,91 +822,67 @@ private:
         uint8_t length_:4;
         semantic_tag tag_;
     private:
-        using object_allocator = typename std::allocator_traits<Allocator>:: template rebind_alloc<object>;
-        using pointer = typename std::allocator_traits<object_allocator>::pointer;
-
-        pointer ptr_;
-
-        template <typename... Args>
-        void create(object_allocator alloc, Args&& ... args)
-        {
-            ptr_ = std::allocator_traits<object_allocator>::allocate(alloc, 1);
-            JSONCONS_TRY
-            {
-                std::allocator_traits<object_allocator>::construct(alloc, jsoncons::detail::to_plain_pointer(ptr_), std::forward<Args>(args)...);
-            }
-            JSONCONS_CATCH(...)
-            {
-                std::allocator_traits<object_allocator>::deallocate(alloc, ptr_,1);
-                JSONCONS_RETHROW;
-            }
-        }
+        heap_value_type<object> holder_;
     public:
         explicit object_storage(const object& val, semantic_tag tag)
-            : storage_(static_cast<uint8_t>(storage_kind::object_value)), length_(0), tag_(tag)
+            : storage_(static_cast<uint8_t>(storage_kind::object_value)), length_(0), tag_(tag),
+              holder_(val.get_allocator(), val)
         {
-            create(val.get_allocator(), val);
         }
 
         explicit object_storage(const object& val, semantic_tag tag, const Allocator& a)
-            : storage_(val.storage_), length_(0), tag_(tag)
+            : storage_(val.storage_), length_(0), tag_(tag),
+              holder_(a, val, a)
         {
-            create(object_allocator(a), val, a);
         }
 
         explicit object_storage(const object_storage& val)
-            : storage_(val.storage_), length_(0), tag_(val.tag_)
+            : storage_(val.storage_), length_(0), tag_(val.tag_),
+              holder_(val.holder_)
         {
-            create(val.ptr_->get_allocator(), *(val.ptr_));
         }
 
         explicit object_storage(object_storage&& val) noexcept
             : storage_(val.storage_), length_(0), tag_(val.tag_),
-              ptr_(nullptr)
+              holder_(std::move(val.holder_))
         {
-            std::swap(val.ptr_,ptr_);
         }
 
         explicit object_storage(const object_storage& val, const Allocator& a)
-            : storage_(val.storage_), length_(0), tag_(val.tag_)
-        {
-            create(object_allocator(a), *(val.ptr_), a);
-        }
-
-        ~object_storage() noexcept
+            : storage_(val.storage_), length_(0), tag_(val.tag_),
+              holder_(val.holder_, a)
         {
-            if (ptr_ != nullptr)
-            {
-                destroy();
-            }
         }
 
         void swap(object_storage& val) noexcept
         {
-            std::swap(val.ptr_,ptr_);
+            holder_.swap(val.holder_);
         }
 
         object& value()
         {
-            return *ptr_;
+            return holder_.get();
         }
 
         const object& value() const
         {
-            return *ptr_;
+            return holder_.get();
         }
 
-        allocator_type get_allocator() const
+        std::size_t hash() const noexcept
         {
-            return ptr_->get_allocator();
+            std::size_t h;
+            if (!holder_.cached_hash(h))
+            {
+                h = hash_object(holder_.get());
+                holder_.cache_hash(h);
+            }
+            return h;
         }
-    private:
 
-        void destroy() noexcept
+        allocator_type get_allocator() const
         {
-            object_allocator alloc(ptr_->get_allocator());
-            std::allocator_traits<object_allocator>::destroy(alloc, jsoncons::detail::to_plain_pointer(ptr_));
-            std::allocator_traits<object_allocator>::deallocate(alloc, ptr_,1);
+            return holder_.get().get_allocator();
         }
     };
 
@@ -1007,6 +1015,11 @@ private:
             return evaluate().size();
         }
 
+        std::size_t hash() const
+        {
+            return evaluate().hash();
+        }
+
         storage_kind storage() const
         {
             return evaluate().storage();
@@ -2240,7 +2253,8 @@ private:
         Init_rv_(std::forward<basic_json>(val));
     }
 
-    void Init_rv_(basic_json&& val, const Allocator& a, std::false_type) noexcept
+    // Moves if val uses the allocator a, otherwise copies into a
+    void Init_rv_(basic_json&& val, const Allocator& a, std::false_type)
     {
         switch (val.storage())
         {
@@ -2820,6 +2834,49 @@ public:
         return !(lhs < rhs);
     }
 
+    // Values that compare equal have the same hash. Object members are hashed 
+    // without regard to their order, so json and ojson values hash the same.
+    std::size_t hash() const noexcept
+    {
+        switch (storage())
+        {
+            case storage_kind::null_value:
+                return static_cast<std::size_t>(jsoncons::detail::hash_mix(1));
+            case storage_kind::bool_value:
+                return static_cast<std::size_t>(jsoncons::detail::hash_mix(cast<bool_storage>().value() ? 3 : 2));
+            case storage_kind::int64_value:
+                return static_cast<std::size_t>(jsoncons::detail::hash_double(static_cast<double>(cast<int64_storage>().value())));
+            case storage_kind::uint64_value:
+                return static_cast<std::size_t>(jsoncons::detail::hash_double(static_cast<double>(cast<uint64_storage>().value())));
+            case storage_kind::half_value:
+                return static_cast<std::size_t>(jsoncons::detail::hash_double(jsoncons::detail::decode_half(cast<half_storage>().value())));
+            case storage_kind::double_value:
+                return static_cast<std::size_t>(jsoncons::detail::hash_double(cast<double_storage>().value()));
+            case storage_kind::short_string_value:
+            case storage_kind::long_string_value:
+            {
+                auto sv = as_string_view();
+                return static_cast<std::size_t>(jsoncons::detail::hash_combine(4, jsoncons::detail::hash_chars(sv.data(), sv.size())));
+            }
+            case storage_kind::byte_string_value:
+            {
+                const auto& stor = cast<byte_string_storage>();
+                return static_cast<std::size_t>(jsoncons::detail::hash_combine(5, jsoncons::detail::hash_chars(stor.data(), stor.length())));
+            }
+            case storage_kind::array_value:
+                return cast<array_storage>().hash();
+            case storage_kind::empty_object_value:
+                return static_cast<std::size_t>(jsoncons::detail::hash_combine(7, 0));
+            case storage_kind::object_value:
+                return cast<object_storage>().hash();
+            case storage_kind::json_const_pointer:
+                return cast<json_const_pointer_storage>().value()->hash();
+            default:
+                JSONCONS_UNREACHABLE();
+                break;
+        }
+    }
+
     void swap(basic_json& other) noexcept
     {
         if (this == &other)
@@ -2856,7 +2913,21 @@ public:
           const basic_json_decode_options<char_type>& options = basic_json_decode_options<CharT>(), 
           std::function<bool(json_errc,const ser_context&)> err_handler = default_json_parsing())
     {
-        json_decoder<basic_json> decoder;
+        return parse(result_allocator_arg, allocator_type(), s, options, err_handler);
+    }
+
+    // Allocates the result with alloc, e.g. an arena_allocator
+
+    template <class Source>
+    static
+    typename std::enable_if<jsoncons::detail::is_sequence_of<Source,char_type>::value,basic_json>::type
+    parse(result_allocator_arg_t, const allocator_type& alloc,
+          const Source& s, 
+          const basic_json_decode_options<char_type>& options = basic_json_decode_options<CharT>(), 
+          std::function<bool(json_errc,const ser_context&)> err_handler = default_json_parsing())
+    {
+        json_decoder<basic_json> decoder(result_allocator_arg, alloc);
+        decoder.intern_keys(options.intern_keys());
         basic_json_parser<char_type> parser(options,err_handler);
 
         auto result = unicons::skip_bom(s.begin(), s.end());
@@ -2865,6 +2936,16 @@ public:
             JSONCONS_THROW(ser_error(result.ec));
         }
         std::size_t offset = result.it - s.begin();
+        if (options.parse_engine() == json_parse_engine::structural_index)
+        {
+            basic_json j;
+            if (try_parse_with_index(s.data()+offset, s.size()-offset, options, alloc, j, 
+                                     std::integral_constant<bool,sizeof(char_type) == sizeof(char)>()))
+            {
+                return j;
+            }
+            // Fall through to the state machine parser for comments, error recovery and error reporting
+        }
         parser.update(s.data()+offset,s.size()-offset);
         parser.parse_some(decoder);
         parser.finish_parse(decoder);
@@ -2876,6 +2957,35 @@ public:
         return decoder.get_result();
     }
 
+private:
+    static bool try_parse_with_index(const char_type* data, std::size_t length, 
+                                     const basic_json_decode_options<char_type>& options,
+                                     const allocator_type& alloc,
+                                     basic_json& j, std::true_type)
+    {
+        json_decoder<basic_json> decoder(result_allocator_arg, alloc);
+        decoder.intern_keys(options.intern_keys());
+        basic_json_index_parser<char_type> parser(options);
+        parser.update(data, length);
+        std::error_code ec;
+        parser.parse(decoder, ec);
+        if (ec || !decoder.is_valid())
+        {
+            return false;
+        }
+        j = decoder.get_result();
+        return true;
+    }
+
+    static bool try_parse_with_index(const char_type*, std::size_t, 
+                                     const basic_json_decode_options<char_type>&,
+                                     const allocator_type&,
+                                     basic_json&, std::false_type)
+    {
+        return false;
+    }
+public:
+
     template <class Source>
     static
     typename std::enable_if<jsoncons::detail::is_sequence_of<Source,char_type>::value,basic_json>::type
@@ -2904,7 +3014,16 @@ public:
                             const basic_json_decode_options<char_type>& options = basic_json_decode_options<CharT>(), 
                             std::function<bool(json_errc,const ser_context&)> err_handler = default_json_parsing())
     {
-        json_decoder<basic_json> visitor;
+        return parse(result_allocator_arg, allocator_type(), is, options, err_handler);
+    }
+
+    static basic_json parse(result_allocator_arg_t, const allocator_type& alloc,
+                            std::basic_istream<char_type>& is, 
+                            const basic_json_decode_options<char_type>& options = basic_json_decode_options<CharT>(), 
+                            std::function<bool(json_errc,const ser_context&)> err_handler = default_json_parsing())
+    {
+        json_decoder<basic_json> visitor(result_allocator_arg, alloc);
+        visitor.intern_keys(options.intern_keys());
         basic_json_reader<char_type,stream_source<char_type>> reader(is, visitor, options, err_handler);
         reader.read_next();
         reader.check_done();
@@ -2928,6 +3047,7 @@ public:
                             std::function<bool(json_errc,const ser_context&)> err_handler = default_json_parsing())
     {
         json_decoder<basic_json> visitor;
+        visitor.intern_keys(options.intern_keys());
         basic_json_reader<char_type,iterator_source<InputIt>> reader(iterator_source<InputIt>(std::forward<InputIt>(first),std::forward<InputIt>(last)), visitor, options, err_handler);
         reader.read_next();
         reader.check_done();
@@ -3043,9 +3163,9 @@ public:
         Init_rv_(std::forward<basic_json>(other));
     }
 
-    basic_json(basic_json&& other, const Allocator&) noexcept
+    basic_json(basic_json&& other, const Allocator& alloc)
     {
-        Init_rv_(std::forward<basic_json>(other));
+        Init_rv_(std::forward<basic_json>(other), alloc, jsoncons::detail::is_stateless<Allocator>());
     }
 
     explicit basic_json(json_object_arg_t, 
@@ -5767,4 +5887,17 @@ jsoncons::wojson operator "" _ojson(const wchar_t* s, std::size_t n)
 
 } // namespace jsoncons
 
+namespace std {
+
+    template <class CharT,class ImplementationPolicy,class Allocator>
+    struct hash<jsoncons::basic_json<CharT,ImplementationPolicy,Allocator>>
+    {
+        std::size_t operator()(const jsoncons::basic_json<CharT,ImplementationPolicy,Allocator>& val) const noexcept
+        {
+            return val.hash();
+        }
+    };
+
+} // namespace std
+
 #endif
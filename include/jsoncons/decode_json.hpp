@@ -29,7 +29,7 @@ namespace jsoncons {
 
         jsoncons::json_decoder<T> decoder;
         basic_json_reader<char_type, string_source<char_type>> reader(s, decoder, options);
-        reader.read();
+        reader.read(decoder);
         if (!decoder.is_valid())
         {
             JSONCONS_THROW(ser_error(convert_errc::conversion_failed, reader.line(), reader.column()));
@@ -63,7 +63,7 @@ namespace jsoncons {
     {
         jsoncons::json_decoder<T> decoder;
         basic_json_reader<CharT, stream_source<CharT>> reader(is, decoder, options);
-        reader.read();
+        reader.read(decoder);
         if (!decoder.is_valid())
         {
             JSONCONS_THROW(ser_error(convert_errc::conversion_failed, reader.line(), reader.column()));
@@ -98,7 +98,7 @@ namespace jsoncons {
 
         jsoncons::json_decoder<T> decoder;
         basic_json_reader<char_type, iterator_source<InputIt>> reader(iterator_source<InputIt>(first,last), decoder, options);
-        reader.read();
+        reader.read(decoder);
         if (!decoder.is_valid())
         {
             JSONCONS_THROW(ser_error(convert_errc::conversion_failed, reader.line(), reader.column()));
@@ -139,7 +139,7 @@ namespace jsoncons {
         json_decoder<T,TempAllocator> decoder(temp_alloc);
 
         basic_json_reader<char_type, string_source<char_type>,TempAllocator> reader(s, decoder, options, temp_alloc);
-        reader.read();
+        reader.read(decoder);
         if (!decoder.is_valid())
         {
             JSONCONS_THROW(ser_error(convert_errc::conversion_failed, reader.line(), reader.column()));
@@ -177,7 +177,7 @@ namespace jsoncons {
         json_decoder<T,TempAllocator> decoder(temp_alloc);
 
         basic_json_reader<CharT, stream_source<CharT>,TempAllocator> reader(is, decoder, options, temp_alloc);
-        reader.read();
+        reader.read(decoder);
         if (!decoder.is_valid())
         {
             JSONCONS_THROW(ser_error(convert_errc::conversion_failed, reader.line(), reader.column()));
@@ -99,6 +99,22 @@ namespace jsoncons {
         }
     };
 
+    // types declared with the json traits macros
+
+    template <class T, class CharT>
+    struct decode_traits<T,CharT,
+        typename std::enable_if<json_traits_macro_decoder<T>::value
+    >::type>
+    {
+        template <class Json,class TempAllocator>
+        static T decode(basic_staj_cursor<CharT>& cursor, 
+                        json_decoder<Json,TempAllocator>& decoder, 
+                        std::error_code& ec)
+        {
+            return json_traits_macro_decoder<T>::decode(cursor, decoder, ec);
+        }
+    };
+
     // std::pair
 
     template <class T1, class T2, class CharT>
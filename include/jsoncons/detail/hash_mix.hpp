@@ -0,0 +1,67 @@
+// Copyright 2021 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_DETAIL_HASH_MIX_HPP
+#define JSONCONS_DETAIL_HASH_MIX_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring> // std::memcpy
+#include <type_traits> // std::make_unsigned
+
+namespace jsoncons {
+namespace detail {
+
+    // Building blocks for structural hashes of json values
+
+    // The splitmix64 finalizer, every input bit affects every output bit
+    inline uint64_t hash_mix(uint64_t h) noexcept
+    {
+        h ^= h >> 30;
+        h *= 0xbf58476d1ce4e5b9ull;
+        h ^= h >> 27;
+        h *= 0x94d049bb133111ebull;
+        h ^= h >> 31;
+        return h;
+    }
+
+    // Order dependent
+    inline uint64_t hash_combine(uint64_t seed, uint64_t h) noexcept
+    {
+        return hash_mix(seed + 0x9e3779b97f4a7c15ull + h);
+    }
+
+    // FNV-1a over code units
+    template <class CharT>
+    uint64_t hash_chars(const CharT* s, std::size_t length) noexcept
+    {
+        using unsigned_type = typename std::make_unsigned<CharT>::type;
+
+        uint64_t h = 14695981039346656037ull;
+        for (std::size_t i = 0; i < length; ++i)
+        {
+            h = (h ^ static_cast<uint64_t>(static_cast<unsigned_type>(s[i]))) * 1099511628211ull;
+        }
+        return h;
+    }
+
+    // Numbers that compare equal hash the same, whatever their representation,
+    // so integers are hashed by their value as double
+    inline uint64_t hash_double(double val) noexcept
+    {
+        if (val == 0)
+        {
+            val = 0; // -0.0 == 0.0
+        }
+        uint64_t bits;
+        std::memcpy(&bits, &val, sizeof(val));
+        return hash_mix(bits);
+    }
+
+} // namespace detail
+} // namespace jsoncons
+
+#endif // JSONCONS_DETAIL_HASH_MIX_HPP
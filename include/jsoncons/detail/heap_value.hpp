@@ -0,0 +1,266 @@
+// Copyright 2021 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_DETAIL_HEAP_VALUE_HPP
+#define JSONCONS_DETAIL_HEAP_VALUE_HPP
+
+#include <atomic> // std::atomic
+#include <cstddef>
+#include <memory> // std::allocator_traits
+#include <utility> // std::forward, std::swap
+#include <jsoncons/config/compiler_support.hpp>
+#include <jsoncons/detail/more_type_traits.hpp>
+
+namespace jsoncons {
+namespace detail {
+
+    // unique_heap_value owns a T allocated with an allocator rebound from Allocator.
+    // Copies are deep.
+
+    template <class T,class Allocator>
+    class unique_heap_value
+    {
+        using value_allocator = typename std::allocator_traits<Allocator>:: template rebind_alloc<T>;
+        using pointer = typename std::allocator_traits<value_allocator>::pointer;
+
+        pointer ptr_;
+
+        template <typename... Args>
+        void create(value_allocator alloc, Args&& ... args)
+        {
+            ptr_ = std::allocator_traits<value_allocator>::allocate(alloc, 1);
+            JSONCONS_TRY
+            {
+                std::allocator_traits<value_allocator>::construct(alloc, jsoncons::detail::to_plain_pointer(ptr_), std::forward<Args>(args)...);
+            }
+            JSONCONS_CATCH(...)
+            {
+                std::allocator_traits<value_allocator>::deallocate(alloc, ptr_,1);
+                JSONCONS_RETHROW;
+            }
+        }
+
+        void destroy() noexcept
+        {
+            value_allocator alloc(ptr_->get_allocator());
+            std::allocator_traits<value_allocator>::destroy(alloc, jsoncons::detail::to_plain_pointer(ptr_));
+            std::allocator_traits<value_allocator>::deallocate(alloc, ptr_,1);
+        }
+    public:
+        template <typename... Args>
+        explicit unique_heap_value(const Allocator& alloc, Args&& ... args)
+        {
+            create(value_allocator(alloc), std::forward<Args>(args)...);
+        }
+
+        unique_heap_value(const unique_heap_value& other)
+        {
+            create(value_allocator(other.ptr_->get_allocator()), *(other.ptr_));
+        }
+
+        unique_heap_value(const unique_heap_value& other, const Allocator& alloc)
+        {
+            create(value_allocator(alloc), *(other.ptr_), alloc);
+        }
+
+        unique_heap_value(unique_heap_value&& other) noexcept
+            : ptr_(nullptr)
+        {
+            std::swap(other.ptr_, ptr_);
+        }
+
+        ~unique_heap_value() noexcept
+        {
+            if (ptr_ != nullptr)
+            {
+                destroy();
+            }
+        }
+
+        unique_heap_value& operator=(const unique_heap_value&) = delete;
+        unique_heap_value& operator=(unique_heap_value&&) = delete;
+
+        void swap(unique_heap_value& other) noexcept
+        {
+            std::swap(other.ptr_, ptr_);
+        }
+
+        T& get()
+        {
+            return *ptr_;
+        }
+
+        const T& get() const
+        {
+            return *ptr_;
+        }
+
+        std::size_t use_count() const noexcept
+        {
+            return 1;
+        }
+
+        bool cached_hash(std::size_t&) const noexcept
+        {
+            return false;
+        }
+
+        void cache_hash(std::size_t) const noexcept
+        {
+        }
+    };
+
+    // shared_heap_value keeps a T in a node with an atomic reference count. Copies
+    // share the node. Non-const access to a node that is shared first replaces it
+    // with a private copy, so a change through one copy is never seen through another.
+    // Since the elements of a T are copied the same way, that copy is only one level deep.
+    // A node can also keep the hash of its value. It is kept only while the node is
+    // shared, when the value cannot change, and is discarded on non-const access.
+
+    template <class T,class Allocator>
+    class shared_heap_value
+    {
+        struct node
+        {
+            std::atomic<std::size_t> count;
+            std::atomic<bool> has_hash;
+            std::atomic<std::size_t> hash;
+            T value;
+
+            template <typename... Args>
+            node(Args&& ... args)
+                : count(1), has_hash(false), hash(0), value(std::forward<Args>(args)...)
+            {
+            }
+        };
+
+        using node_allocator = typename std::allocator_traits<Allocator>:: template rebind_alloc<node>;
+        using pointer = typename std::allocator_traits<node_allocator>::pointer;
+
+        pointer ptr_;
+
+        template <typename... Args>
+        static pointer create(node_allocator alloc, Args&& ... args)
+        {
+            pointer ptr = std::allocator_traits<node_allocator>::allocate(alloc, 1);
+            JSONCONS_TRY
+            {
+                std::allocator_traits<node_allocator>::construct(alloc, jsoncons::detail::to_plain_pointer(ptr), std::forward<Args>(args)...);
+            }
+            JSONCONS_CATCH(...)
+            {
+                std::allocator_traits<node_allocator>::deallocate(alloc, ptr,1);
+                JSONCONS_RETHROW;
+            }
+            return ptr;
+        }
+
+        static void release(pointer ptr) noexcept
+        {
+            if (ptr->count.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            {
+                node_allocator alloc(ptr->value.get_allocator());
+                std::allocator_traits<node_allocator>::destroy(alloc, jsoncons::detail::to_plain_pointer(ptr));
+                std::allocator_traits<node_allocator>::deallocate(alloc, ptr,1);
+            }
+        }
+    public:
+        template <typename... Args>
+        explicit shared_heap_value(const Allocator& alloc, Args&& ... args)
+            : ptr_(create(node_allocator(alloc), std::forward<Args>(args)...))
+        {
+        }
+
+        shared_heap_value(const shared_heap_value& other) noexcept
+            : ptr_(other.ptr_)
+        {
+            ptr_->count.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        shared_heap_value(const shared_heap_value& other, const Allocator& alloc)
+        {
+            if (other.ptr_->value.get_allocator() == alloc)
+            {
+                ptr_ = other.ptr_;
+                ptr_->count.fetch_add(1, std::memory_order_relaxed);
+            }
+            else
+            {
+                ptr_ = create(node_allocator(alloc), other.ptr_->value, alloc);
+            }
+        }
+
+        shared_heap_value(shared_heap_value&& other) noexcept
+            : ptr_(nullptr)
+        {
+            std::swap(other.ptr_, ptr_);
+        }
+
+        ~shared_heap_value() noexcept
+        {
+            if (ptr_ != nullptr)
+            {
+                release(ptr_);
+            }
+        }
+
+        shared_heap_value& operator=(const shared_heap_value&) = delete;
+        shared_heap_value& operator=(shared_heap_value&&) = delete;
+
+        void swap(shared_heap_value& other) noexcept
+        {
+            std::swap(other.ptr_, ptr_);
+        }
+
+        T& get()
+        {
+            if (ptr_->count.load(std::memory_order_acquire) != 1)
+            {
+                pointer ptr = create(node_allocator(ptr_->value.get_allocator()), ptr_->value);
+                release(ptr_);
+                ptr_ = ptr;
+            }
+            else
+            {
+                ptr_->has_hash.store(false, std::memory_order_relaxed);
+            }
+            return ptr_->value;
+        }
+
+        const T& get() const
+        {
+            return ptr_->value;
+        }
+
+        std::size_t use_count() const noexcept
+        {
+            return ptr_->count.load(std::memory_order_relaxed);
+        }
+
+        bool cached_hash(std::size_t& h) const noexcept
+        {
+            if (!ptr_->has_hash.load(std::memory_order_acquire))
+            {
+                return false;
+            }
+            h = ptr_->hash.load(std::memory_order_relaxed);
+            return true;
+        }
+
+        void cache_hash(std::size_t h) const noexcept
+        {
+            if (use_count() > 1)
+            {
+                ptr_->hash.store(h, std::memory_order_relaxed);
+                ptr_->has_hash.store(true, std::memory_order_release);
+            }
+        }
+    };
+
+} // namespace detail
+} // namespace jsoncons
+
+#endif // JSONCONS_DETAIL_HEAP_VALUE_HPP
@@ -0,0 +1,249 @@
+// Copyright 2021 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_DETAIL_KEY_INTERN_TABLE_HPP
+#define JSONCONS_DETAIL_KEY_INTERN_TABLE_HPP
+
+#include <algorithm> // std::sort
+#include <cstddef>
+#include <cstdint>
+#include <memory> // std::allocator_traits
+#include <string>
+#include <vector>
+
+namespace jsoncons {
+namespace detail {
+
+    // key_intern_table gives each distinct object key a small integer id, and
+    // remembers, for each distinct sequence of key ids (an object "shape"), the order
+    // that sorts the keys. Decoding records that share a shape then costs one hash
+    // lookup per key and one per object, instead of sorting the members of every object.
+    // The table stops growing at max_keys keys and max_shapes shapes.
+
+    template <class CharT,class Allocator=std::allocator<char>>
+    class key_intern_table
+    {
+    public:
+        static constexpr uint32_t npos = 0xffffffff;
+        static constexpr std::size_t max_keys = 4096;
+        static constexpr std::size_t max_key_length = 256;
+        static constexpr std::size_t max_shapes = 1024;
+        static constexpr std::size_t max_shape_length = 256;
+    private:
+        using char_allocator_type = typename std::allocator_traits<Allocator>:: template rebind_alloc<CharT>;
+        using uint32_allocator_type = typename std::allocator_traits<Allocator>:: template rebind_alloc<uint32_t>;
+        using uint64_allocator_type = typename std::allocator_traits<Allocator>:: template rebind_alloc<uint64_t>;
+
+        struct shape_entry
+        {
+            uint64_t hash;
+            uint32_t offset; // ids at offset, followed by the sorted order
+            uint32_t length;
+            bool has_order;  // false if a key is repeated
+        };
+        using shape_allocator_type = typename std::allocator_traits<Allocator>:: template rebind_alloc<shape_entry>;
+
+        std::basic_string<CharT,std::char_traits<CharT>,char_allocator_type> chars_;
+        std::vector<uint32_t,uint32_allocator_type> key_offsets_;
+        std::vector<uint64_t,uint64_allocator_type> key_hashes_;
+        std::vector<uint32_t,uint32_allocator_type> key_slots_;
+
+        std::vector<uint32_t,uint32_allocator_type> shape_data_;
+        std::vector<shape_entry,shape_allocator_type> shapes_;
+        std::vector<uint32_t,uint32_allocator_type> shape_slots_;
+    public:
+        key_intern_table(const Allocator& alloc = Allocator())
+            : chars_(char_allocator_type(alloc)),
+              key_offsets_(uint32_allocator_type(alloc)),
+              key_hashes_(uint64_allocator_type(alloc)),
+              key_slots_(uint32_allocator_type(alloc)),
+              shape_data_(uint32_allocator_type(alloc)),
+              shapes_(shape_allocator_type(alloc)),
+              shape_slots_(uint32_allocator_type(alloc))
+        {
+            key_offsets_.push_back(0);
+        }
+
+        std::size_t key_count() const
+        {
+            return key_hashes_.size();
+        }
+
+        std::size_t shape_count() const
+        {
+            return shapes_.size();
+        }
+
+        // Returns the id of the key, or npos if the table is full
+        uint32_t intern(const CharT* s, std::size_t length)
+        {
+            if (length > max_key_length)
+            {
+                return npos;
+            }
+            uint64_t hash = hash_chars(s, length);
+            if (!key_slots_.empty())
+            {
+                std::size_t mask = key_slots_.size() - 1;
+                for (std::size_t i = static_cast<std::size_t>(hash & mask); key_slots_[i] != 0; i = (i + 1) & mask)
+                {
+                    uint32_t id = key_slots_[i] - 1;
+                    if (key_hashes_[id] == hash && key_length(id) == length &&
+                        std::char_traits<CharT>::compare(chars_.data() + key_offsets_[id], s, length) == 0)
+                    {
+                        return id;
+                    }
+                }
+            }
+            if (key_hashes_.size() >= max_keys)
+            {
+                return npos;
+            }
+            uint32_t id = static_cast<uint32_t>(key_hashes_.size());
+            chars_.append(s, length);
+            key_offsets_.push_back(static_cast<uint32_t>(chars_.size()));
+            key_hashes_.push_back(hash);
+            if ((key_hashes_.size() * 2) > key_slots_.size())
+            {
+                rehash(key_slots_, key_hashes_.size(), [this](uint32_t k){return key_hashes_[k];});
+            }
+            else
+            {
+                insert_slot(key_slots_, hash, id);
+            }
+            return id;
+        }
+
+        std::basic_string<CharT> key(uint32_t id) const
+        {
+            return std::basic_string<CharT>(chars_.data() + key_offsets_[id], key_length(id));
+        }
+
+        // For the key ids of the members of an object, returns the positions of the
+        // members in key order, or nullptr if a key is repeated or not interned, or the
+        // table is full. The pointer is valid until the next call.
+        const uint32_t* find_order(const uint32_t* ids, std::size_t length)
+        {
+            if (length == 0 || length > max_shape_length)
+            {
+                return nullptr;
+            }
+            uint64_t hash = length;
+            for (std::size_t i = 0; i < length; ++i)
+            {
+                if (ids[i] == npos)
+                {
+                    return nullptr;
+                }
+                hash = (hash ^ ids[i]) * 1099511628211ull;
+            }
+            if (!shape_slots_.empty())
+            {
+                std::size_t mask = shape_slots_.size() - 1;
+                for (std::size_t i = static_cast<std::size_t>(hash & mask); shape_slots_[i] != 0; i = (i + 1) & mask)
+                {
+                    const shape_entry& entry = shapes_[shape_slots_[i] - 1];
+                    if (entry.hash == hash && entry.length == length &&
+                        std::equal(ids, ids + length, shape_data_.data() + entry.offset))
+                    {
+                        return entry.has_order ? shape_data_.data() + entry.offset + length : nullptr;
+                    }
+                }
+            }
+            if (shapes_.size() >= max_shapes)
+            {
+                return nullptr;
+            }
+
+            uint32_t offset = static_cast<uint32_t>(shape_data_.size());
+            shape_data_.insert(shape_data_.end(), ids, ids + length);
+            for (std::size_t i = 0; i < length; ++i)
+            {
+                shape_data_.push_back(static_cast<uint32_t>(i));
+            }
+            uint32_t* order = shape_data_.data() + offset + length;
+            const uint32_t* shape_ids = shape_data_.data() + offset;
+            std::sort(order, order + length,
+                      [&](uint32_t a, uint32_t b) {return compare_keys(shape_ids[a], shape_ids[b]) < 0;});
+            bool has_order = true;
+            for (std::size_t i = 1; i < length && has_order; ++i)
+            {
+                has_order = shape_ids[order[i-1]] != shape_ids[order[i]];
+            }
+
+            shapes_.push_back(shape_entry{hash, offset, static_cast<uint32_t>(length), has_order});
+            if ((shapes_.size() * 2) > shape_slots_.size())
+            {
+                rehash(shape_slots_, shapes_.size(), [this](uint32_t k){return shapes_[k].hash;});
+            }
+            else
+            {
+                insert_slot(shape_slots_, hash, static_cast<uint32_t>(shapes_.size() - 1));
+            }
+            return has_order ? order : nullptr;
+        }
+
+    private:
+        std::size_t key_length(uint32_t id) const
+        {
+            return key_offsets_[id+1] - key_offsets_[id];
+        }
+
+        int compare_keys(uint32_t a, uint32_t b) const
+        {
+            std::size_t len_a = key_length(a);
+            std::size_t len_b = key_length(b);
+            int diff = std::char_traits<CharT>::compare(chars_.data() + key_offsets_[a],
+                                                        chars_.data() + key_offsets_[b],
+                                                        (std::min)(len_a, len_b));
+            if (diff != 0)
+            {
+                return diff;
+            }
+            return len_a < len_b ? -1 : (len_a > len_b ? 1 : 0);
+        }
+
+        static uint64_t hash_chars(const CharT* s, std::size_t length)
+        {
+            uint64_t hash = 14695981039346656037ull;
+            for (std::size_t i = 0; i < length; ++i)
+            {
+                hash = (hash ^ static_cast<uint64_t>(s[i])) * 1099511628211ull;
+            }
+            return hash;
+        }
+
+        static void insert_slot(std::vector<uint32_t,uint32_allocator_type>& slots, uint64_t hash, uint32_t k)
+        {
+            std::size_t mask = slots.size() - 1;
+            std::size_t i = static_cast<std::size_t>(hash & mask);
+            while (slots[i] != 0)
+            {
+                i = (i + 1) & mask;
+            }
+            slots[i] = k + 1;
+        }
+
+        template <class Hash>
+        static void rehash(std::vector<uint32_t,uint32_allocator_type>& slots, std::size_t count, Hash hash)
+        {
+            std::size_t capacity = slots.empty() ? 64 : slots.size();
+            while (capacity < count * 2)
+            {
+                capacity *= 2;
+            }
+            slots.assign(capacity, 0);
+            for (std::size_t k = 0; k < count; ++k)
+            {
+                insert_slot(slots, hash(static_cast<uint32_t>(k)), static_cast<uint32_t>(k));
+            }
+        }
+    };
+
+} // namespace detail
+} // namespace jsoncons
+
+#endif // JSONCONS_DETAIL_KEY_INTERN_TABLE_HPP
@@ -0,0 +1,194 @@
+// Copyright 2021 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_DETAIL_MEMBER_INDEX_HPP
+#define JSONCONS_DETAIL_MEMBER_INDEX_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory> // std::allocator_traits
+#include <string> // std::char_traits
+#include <utility> // std::move
+#include <vector>
+
+namespace jsoncons {
+namespace detail {
+
+    // member_index maps the keys of a sequence of object members to their positions,
+    // using open addressing with linear probing. A slot holds a position plus one, zero
+    // marks an empty slot. Hashes are not stored, they are recomputed from the keys
+    // when the table grows. The load factor is kept at or below one half.
+
+    template <class Allocator>
+    class member_index
+    {
+        using slot_allocator_type = typename std::allocator_traits<Allocator>:: template rebind_alloc<std::size_t>;
+
+        std::vector<std::size_t,slot_allocator_type> slots_;
+    public:
+        static constexpr std::size_t min_capacity = 16;
+
+        explicit member_index(const Allocator& alloc = Allocator())
+            : slots_(slot_allocator_type(alloc))
+        {
+        }
+
+        member_index(const member_index& other) = default;
+
+        member_index(member_index&& other) = default;
+
+        member_index(const member_index& other, const Allocator& alloc)
+            : slots_(other.slots_, slot_allocator_type(alloc))
+        {
+        }
+
+        member_index& operator=(const member_index& other) = default;
+
+        member_index& operator=(member_index&& other) = default;
+
+        bool empty() const noexcept
+        {
+            return slots_.empty();
+        }
+
+        std::size_t capacity() const noexcept
+        {
+            return slots_.size();
+        }
+
+        void clear() noexcept
+        {
+            slots_.clear();
+        }
+
+        void shrink_to_fit()
+        {
+            slots_.shrink_to_fit();
+        }
+
+        void swap(member_index& other) noexcept
+        {
+            slots_.swap(other.slots_);
+        }
+
+        // Returns the position of the member with the key, or members.size() if there is none
+        template <class Members, class CharT>
+        std::size_t find(const Members& members, const CharT* s, std::size_t length) const
+        {
+            return find(members, hash(s, length), s, length);
+        }
+
+        // Indexes all members, which must have unique keys
+        template <class Members>
+        void build(const Members& members)
+        {
+            slots_.assign(capacity_for(members.size()), 0);
+            for (std::size_t i = 0; i < members.size(); ++i)
+            {
+                const auto& key = members[i].key();
+                insert_slot(hash(key.data(), key.size()), i);
+            }
+        }
+
+        // Indexes all members, erasing any member whose key repeats the key of an
+        // earlier member
+        template <class Members>
+        void build_unique(Members& members)
+        {
+            slots_.assign(capacity_for(members.size()), 0);
+            std::size_t count = 0;
+            for (std::size_t i = 0; i < members.size(); ++i)
+            {
+                const auto& key = members[i].key();
+                std::size_t h = hash(key.data(), key.size());
+                if (find(members, h, key.data(), key.size()) != members.size())
+                {
+                    continue;
+                }
+                if (count != i)
+                {
+                    members[count] = std::move(members[i]);
+                }
+                insert_slot(h, count);
+                ++count;
+            }
+            members.erase(members.begin() + count, members.end());
+        }
+
+        // Indexes a member that has been inserted at pos. Members formerly at pos
+        // and after have moved up one place.
+        template <class Members>
+        void insert(const Members& members, std::size_t pos)
+        {
+            if (members.size() * 2 > slots_.size())
+            {
+                build(members);
+                return;
+            }
+            if (pos + 1 < members.size())
+            {
+                for (auto& slot : slots_)
+                {
+                    slot += static_cast<std::size_t>(slot > pos);
+                }
+            }
+            const auto& key = members[pos].key();
+            insert_slot(hash(key.data(), key.size()), pos);
+        }
+
+        template <class CharT>
+        static std::size_t hash(const CharT* s, std::size_t length) noexcept
+        {
+            uint64_t h = 14695981039346656037ull;
+            for (std::size_t i = 0; i < length; ++i)
+            {
+                h = (h ^ static_cast<uint64_t>(s[i])) * 1099511628211ull;
+            }
+            return static_cast<std::size_t>(h ^ (h >> 32));
+        }
+
+    private:
+        static std::size_t capacity_for(std::size_t count) noexcept
+        {
+            std::size_t capacity = min_capacity;
+            while (capacity < count * 2)
+            {
+                capacity *= 2;
+            }
+            return capacity;
+        }
+
+        template <class Members, class CharT>
+        std::size_t find(const Members& members, std::size_t h, const CharT* s, std::size_t length) const
+        {
+            std::size_t mask = slots_.size() - 1;
+            for (std::size_t i = h & mask; slots_[i] != 0; i = (i + 1) & mask)
+            {
+                const auto& key = members[slots_[i] - 1].key();
+                if (key.size() == length && std::char_traits<CharT>::compare(key.data(), s, length) == 0)
+                {
+                    return slots_[i] - 1;
+                }
+            }
+            return members.size();
+        }
+
+        void insert_slot(std::size_t h, std::size_t pos) noexcept
+        {
+            std::size_t mask = slots_.size() - 1;
+            std::size_t i = h & mask;
+            while (slots_[i] != 0)
+            {
+                i = (i + 1) & mask;
+            }
+            slots_[i] = pos + 1;
+        }
+    };
+
+} // namespace detail
+} // namespace jsoncons
+
+#endif // JSONCONS_DETAIL_MEMBER_INDEX_HPP
@@ -18,6 +18,7 @@
 #include <cstddef> // std::byte
 #include <utility> // std::declval
 #include <climits> // CHAR_BIT
+#include <limits> // std::numeric_limits
 #include <jsoncons/config/compiler_support.hpp>
 
 namespace jsoncons {
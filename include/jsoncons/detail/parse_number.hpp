@@ -17,6 +17,7 @@
 #include <type_traits> // std::enable_if
 #include <exception>
 #include <jsoncons/config/jsoncons_config.hpp>
+#include <jsoncons/detail/parse_double.hpp>
 #include <cctype>
 
 namespace jsoncons { namespace detail {
@@ -771,20 +772,24 @@ base16_to_integer(const CharT* s, std::size_t length)
 class to_double_t
 {
 private:
-    _locale_t locale_;
+    // Created on first use, only needed for input that the fast path leaves to _strtod_l
+    mutable _locale_t locale_;
 public:
     to_double_t()
+        : locale_(nullptr)
     {
-        locale_ = _create_locale(LC_NUMERIC, "C");
     }
     ~to_double_t() noexcept
     {
-        _free_locale(locale_);
+        if (locale_ != nullptr)
+        {
+            _free_locale(locale_);
+        }
     }
 
     to_double_t(const to_double_t&)
+        : locale_(nullptr)
     {
-        locale_ = _create_locale(LC_NUMERIC, "C");
     }
 
     to_double_t& operator=(const to_double_t&) 
@@ -800,10 +805,15 @@ public:
 
     template <class CharT>
     typename std::enable_if<std::is_same<CharT,char>::value,double>::type
-    operator()(const CharT* s, std::size_t) const
+    operator()(const CharT* s, std::size_t length) const
     {
+        double val;
+        if (try_parse_double(s, length, '.', val))
+        {
+            return val;
+        }
         CharT *end = nullptr;
-        double val = _strtod_l(s, &end, locale_);
+        val = _strtod_l(s, &end, c_locale());
         if (s == end)
         {
             JSONCONS_THROW(json_runtime_error<std::invalid_argument>("Convert string to double failed"));
@@ -813,16 +823,30 @@ public:
 
     template <class CharT>
     typename std::enable_if<std::is_same<CharT,wchar_t>::value,double>::type
-    operator()(const CharT* s, std::size_t) const
+    operator()(const CharT* s, std::size_t length) const
     {
+        double val;
+        if (try_parse_double(s, length, L'.', val))
+        {
+            return val;
+        }
         CharT *end = nullptr;
-        double val = _wcstod_l(s, &end, locale_);
+        val = _wcstod_l(s, &end, c_locale());
         if (s == end)
         {
             JSONCONS_THROW(json_runtime_error<std::invalid_argument>("Convert string to double failed"));
         }
         return val;
     }
+private:
+    _locale_t c_locale() const
+    {
+        if (locale_ == nullptr)
+        {
+            locale_ = _create_locale(LC_NUMERIC, "C");
+        }
+        return locale_;
+    }
 };
 
 #elif defined(JSONCONS_HAS_STRTOLD_L)
@@ -830,20 +854,24 @@ public:
 class to_double_t
 {
 private:
-    locale_t locale_;
+    // Created on first use, only needed for input that the fast path leaves to strtold_l
+    mutable locale_t locale_;
 public:
     to_double_t()
+        : locale_((locale_t) 0)
     {
-        locale_ = newlocale(LC_ALL_MASK, "C", (locale_t) 0);
     }
     ~to_double_t() noexcept
     {
-        freelocale(locale_);
+        if (locale_ != (locale_t) 0)
+        {
+            freelocale(locale_);
+        }
     }
 
     to_double_t(const to_double_t&)
+        : locale_((locale_t) 0)
     {
-        locale_ = newlocale(LC_ALL_MASK, "C", (locale_t) 0);
     }
 
     to_double_t& operator=(const to_double_t&) 
@@ -860,8 +888,13 @@ public:
     typename std::enable_if<std::is_same<CharT,char>::value,double>::type
     operator()(const CharT* s, std::size_t length) const
     {
+        double val;
+        if (try_parse_double(s, length, '.', val))
+        {
+            return val;
+        }
         char *end = nullptr;
-        double val = strtold_l(s, &end, locale_);
+        val = strtold_l(s, &end, c_locale());
         if (s == end)
         {
             JSONCONS_THROW(json_runtime_error<std::invalid_argument>("Convert string to double failed"));
@@ -873,25 +906,37 @@ public:
     typename std::enable_if<std::is_same<CharT,wchar_t>::value,double>::type
     operator()(const CharT* s, std::size_t length) const
     {
+        double val;
+        if (try_parse_double(s, length, L'.', val))
+        {
+            return val;
+        }
         CharT *end = nullptr;
-        double val = wcstold_l(s, &end, locale_);
+        val = wcstold_l(s, &end, c_locale());
         if (s == end)
         {
             JSONCONS_THROW(json_runtime_error<std::invalid_argument>("Convert string to double failed"));
         }
         return val;
     }
+private:
+    locale_t c_locale() const
+    {
+        if (locale_ == (locale_t) 0)
+        {
+            locale_ = newlocale(LC_ALL_MASK, "C", (locale_t) 0);
+        }
+        return locale_;
+    }
 };
 
 #else
 class to_double_t
 {
 private:
-    std::vector<char> buffer_;
     char decimal_point_;
 public:
     to_double_t()
-        : buffer_()
     {
         struct lconv * lc = localeconv();
         if (lc != nullptr && lc->decimal_point[0] != 0)
@@ -902,7 +947,6 @@ public:
         {
             decimal_point_ = '.'; 
         }
-        buffer_.reserve(100);
     }
 
     to_double_t(const to_double_t&) = default;
@@ -915,10 +959,15 @@ public:
 
     template <class CharT>
     typename std::enable_if<std::is_same<CharT,char>::value,double>::type
-    operator()(const CharT* s, std::size_t /*length*/) const
+    operator()(const CharT* s, std::size_t length) const
     {
+        double val;
+        if (try_parse_double(s, length, decimal_point_, val))
+        {
+            return val;
+        }
         CharT *end = nullptr;
-        double val = strtod(s, &end);
+        val = strtod(s, &end);
         if (s == end)
         {
             JSONCONS_THROW(json_runtime_error<std::invalid_argument>("Convert string to double failed"));
@@ -928,10 +977,15 @@ public:
 
     template <class CharT>
     typename std::enable_if<std::is_same<CharT,wchar_t>::value,double>::type
-    operator()(const CharT* s, std::size_t /*length*/) const
+    operator()(const CharT* s, std::size_t length) const
     {
+        double val;
+        if (try_parse_double(s, length, static_cast<CharT>(decimal_point_), val))
+        {
+            return val;
+        }
         CharT *end = nullptr;
-        double val = wcstod(s, &end);
+        val = wcstod(s, &end);
         if (s == end)
         {
             JSONCONS_THROW(json_runtime_error<std::invalid_argument>("Convert string to double failed"));
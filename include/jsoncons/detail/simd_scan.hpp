@@ -0,0 +1,485 @@
+// Copyright 2021 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_DETAIL_SIMD_SCAN_HPP
+#define JSONCONS_DETAIL_SIMD_SCAN_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <jsoncons/config/compiler_support.hpp>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#  include <intrin.h> // _BitScanForward
+#endif
+
+// Define JSONCONS_NO_SIMD to force the scalar code paths
+
+#if !defined(JSONCONS_NO_SIMD)
+#  if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#    define JSONCONS_HAS_SSE2 1
+#    include <emmintrin.h>
+#    if defined(__AVX2__)
+#      define JSONCONS_HAS_AVX2 1
+#      include <immintrin.h>
+#    elif (defined(__GNUC__) || defined(__clang__)) && !defined(JSONCONS_NO_AVX2_DISPATCH) && !defined(__INTEL_COMPILER)
+       // AVX2 is not enabled for the whole translation unit, select it at runtime
+#      define JSONCONS_HAS_AVX2_DISPATCH 1
+#      include <immintrin.h>
+#    endif
+#  elif defined(__aarch64__) && defined(__ARM_NEON)
+#    define JSONCONS_HAS_NEON 1
+#    include <arm_neon.h>
+#  endif
+#endif
+
+namespace jsoncons {
+namespace detail {
+
+    enum class simd_level : uint8_t {none, sse2, avx2, neon};
+
+    inline simd_level detect_simd_level() noexcept
+    {
+#if defined(JSONCONS_HAS_AVX2)
+        return simd_level::avx2;
+#elif defined(JSONCONS_HAS_AVX2_DISPATCH)
+        static const bool has_avx2 = __builtin_cpu_supports("avx2") != 0;
+        return has_avx2 ? simd_level::avx2 : simd_level::sse2;
+#elif defined(JSONCONS_HAS_SSE2)
+        return simd_level::sse2;
+#elif defined(JSONCONS_HAS_NEON)
+        return simd_level::neon;
+#else
+        return simd_level::none;
+#endif
+    }
+
+    inline unsigned trailing_zeros(uint32_t mask) noexcept
+    {
+#if defined(_MSC_VER) && !defined(__clang__)
+        unsigned long index;
+        _BitScanForward(&index, mask);
+        return static_cast<unsigned>(index);
+#elif defined(__GNUC__) || defined(__clang__)
+        return static_cast<unsigned>(__builtin_ctz(mask));
+#else
+        unsigned n = 0;
+        while ((mask & 1) == 0)
+        {
+            mask >>= 1;
+            ++n;
+        }
+        return n;
+#endif
+    }
+
+    inline unsigned trailing_zeros64(uint64_t mask) noexcept
+    {
+#if defined(_MSC_VER) && !defined(__clang__) && defined(_M_X64)
+        unsigned long index;
+        _BitScanForward64(&index, mask);
+        return static_cast<unsigned>(index);
+#elif defined(__GNUC__) || defined(__clang__)
+        return static_cast<unsigned>(__builtin_ctzll(mask));
+#else
+        const uint32_t low = static_cast<uint32_t>(mask);
+        return low != 0 ? trailing_zeros(low) : 32 + trailing_zeros(static_cast<uint32_t>(mask >> 32));
+#endif
+    }
+
+    // Scalar classifiers, shared by the fallback paths and the tails of the vector loops
+
+    template <class CharT>
+    JSONCONS_CPP14_CONSTEXPR bool is_string_special(CharT c) noexcept
+    {
+        using uchar_type = typename std::make_unsigned<CharT>::type;
+        return c == '\"' || c == '\\' || static_cast<uchar_type>(c) < 0x20;
+    }
+
+    template <class CharT>
+    JSONCONS_CPP14_CONSTEXPR bool is_escape_special(CharT c, bool escape_solidus, bool escape_all_non_ascii) noexcept
+    {
+        using uchar_type = typename std::make_unsigned<CharT>::type;
+        return is_string_special(c) || static_cast<uchar_type>(c) == 0x7f || (escape_solidus && c == '/') ||
+               (escape_all_non_ascii && static_cast<uchar_type>(c) >= 0x80);
+    }
+
+    template <class CharT>
+    JSONCONS_CPP14_CONSTEXPR bool is_blank(CharT c) noexcept
+    {
+        return c == ' ' || c == '\t';
+    }
+
+    template <class CharT>
+    JSONCONS_CPP14_CONSTEXPR bool is_nesting_special(CharT c) noexcept
+    {
+        return c == '\"' || c == '{' || c == '}' || c == '[' || c == ']' || c == '\n';
+    }
+
+#if defined(JSONCONS_HAS_SSE2)
+
+    // Bit i of the result is set if byte i of v is a quote, backslash or control character
+    inline uint32_t string_special_mask_sse2(__m128i v) noexcept
+    {
+        const __m128i quote = _mm_cmpeq_epi8(v, _mm_set1_epi8('\"'));
+        const __m128i backslash = _mm_cmpeq_epi8(v, _mm_set1_epi8('\\'));
+        // v <= 0x1f (unsigned) iff v saturating-minus 0x1f is zero
+        const __m128i control = _mm_cmpeq_epi8(_mm_subs_epu8(v, _mm_set1_epi8(0x1f)), _mm_setzero_si128());
+        return static_cast<uint32_t>(_mm_movemask_epi8(_mm_or_si128(_mm_or_si128(quote, backslash), control)));
+    }
+
+    // Bit i of the result is set if byte i of v is a quote, backslash, control character, DEL,
+    // or equal to solidus, or if it is 0x80 or above and bit i of non_ascii is set. 
+    // Passing '\"' for solidus leaves out the solidus.
+    inline uint32_t escape_special_mask_sse2(__m128i v, __m128i solidus, uint32_t non_ascii) noexcept
+    {
+        const __m128i del_or_solidus = _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8(0x7f)),
+                                                    _mm_cmpeq_epi8(v, solidus));
+        const uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(del_or_solidus)) |
+                              (static_cast<uint32_t>(_mm_movemask_epi8(v)) & non_ascii);
+        return string_special_mask_sse2(v) | mask;
+    }
+
+    // Bit i of the result is set if byte i of v is not a space or tab
+    inline uint32_t non_blank_mask_sse2(__m128i v) noexcept
+    {
+        const __m128i blank = _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8(' ')),
+                                           _mm_cmpeq_epi8(v, _mm_set1_epi8('\t')));
+        return static_cast<uint32_t>(_mm_movemask_epi8(blank)) ^ 0xffffu;
+    }
+
+    // Bit i of the result is set if byte i of v is a quote, brace, bracket or newline
+    inline uint32_t nesting_special_mask_sse2(__m128i v) noexcept
+    {
+        // '[' and ']' differ from '{' and '}' only in bit 5
+        const __m128i folded = _mm_or_si128(v, _mm_set1_epi8(0x20));
+        const __m128i brackets = _mm_or_si128(_mm_cmpeq_epi8(folded, _mm_set1_epi8('{')),
+                                              _mm_cmpeq_epi8(folded, _mm_set1_epi8('}')));
+        const __m128i others = _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('\"')),
+                                            _mm_cmpeq_epi8(v, _mm_set1_epi8('\n')));
+        return static_cast<uint32_t>(_mm_movemask_epi8(_mm_or_si128(brackets, others)));
+    }
+
+#endif // JSONCONS_HAS_SSE2
+
+#if defined(JSONCONS_HAS_AVX2) || defined(JSONCONS_HAS_AVX2_DISPATCH)
+
+#if defined(JSONCONS_HAS_AVX2_DISPATCH)
+    __attribute__((target("avx2")))
+#endif
+    inline const char* find_string_special_avx2(const char* first, const char* last) noexcept
+    {
+        const __m256i quote = _mm256_set1_epi8('\"');
+        const __m256i backslash = _mm256_set1_epi8('\\');
+        const __m256i control_max = _mm256_set1_epi8(0x1f);
+        while (last - first >= 32)
+        {
+            const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first));
+            const __m256i special = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(v, quote),
+                                                                    _mm256_cmpeq_epi8(v, backslash)),
+                                                    _mm256_cmpeq_epi8(_mm256_subs_epu8(v, control_max), _mm256_setzero_si256()));
+            const uint32_t mask = static_cast<uint32_t>(_mm256_movemask_epi8(special));
+            if (mask != 0)
+            {
+                return first + trailing_zeros(mask);
+            }
+            first += 32;
+        }
+        return first;
+    }
+
+#if defined(JSONCONS_HAS_AVX2_DISPATCH)
+    __attribute__((target("avx2")))
+#endif
+    inline const char* find_escape_special_avx2(const char* first, const char* last, char solidus, uint32_t non_ascii) noexcept
+    {
+        const __m256i quote = _mm256_set1_epi8('\"');
+        const __m256i backslash = _mm256_set1_epi8('\\');
+        const __m256i control_max = _mm256_set1_epi8(0x1f);
+        const __m256i del = _mm256_set1_epi8(0x7f);
+        const __m256i slash = _mm256_set1_epi8(solidus);
+        while (last - first >= 32)
+        {
+            const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first));
+            const __m256i special = _mm256_or_si256(_mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(v, quote),
+                                                                                    _mm256_cmpeq_epi8(v, backslash)),
+                                                                    _mm256_cmpeq_epi8(_mm256_subs_epu8(v, control_max), _mm256_setzero_si256())),
+                                                    _mm256_or_si256(_mm256_cmpeq_epi8(v, del), _mm256_cmpeq_epi8(v, slash)));
+            const uint32_t mask = static_cast<uint32_t>(_mm256_movemask_epi8(special)) |
+                                  (static_cast<uint32_t>(_mm256_movemask_epi8(v)) & non_ascii);
+            if (mask != 0)
+            {
+                return first + trailing_zeros(mask);
+            }
+            first += 32;
+        }
+        return first;
+    }
+
+#endif // JSONCONS_HAS_AVX2 || JSONCONS_HAS_AVX2_DISPATCH
+
+    // find_string_special returns a pointer to the first quote, backslash or control character
+    // in [first,last), or last if there is none.
+
+    template <class CharT>
+    typename std::enable_if<sizeof(CharT) != sizeof(char),const CharT*>::type
+    find_string_special(const CharT* first, const CharT* last) noexcept
+    {
+        while (first != last && !is_string_special(*first))
+        {
+            ++first;
+        }
+        return first;
+    }
+
+    template <class CharT>
+    typename std::enable_if<sizeof(CharT) == sizeof(char),const CharT*>::type
+    find_string_special(const CharT* first, const CharT* last) noexcept
+    {
+#if defined(JSONCONS_HAS_SSE2)
+        if (last - first >= 16)
+        {
+            // Most strings are short, try one 16 byte block before anything else
+            uint32_t mask = string_special_mask_sse2(_mm_loadu_si128(reinterpret_cast<const __m128i*>(first)));
+            if (mask != 0)
+            {
+                return first + trailing_zeros(mask);
+            }
+            first += 16;
+    #if defined(JSONCONS_HAS_AVX2) || defined(JSONCONS_HAS_AVX2_DISPATCH)
+            if (last - first >= 64 && detect_simd_level() == simd_level::avx2)
+            {
+                first = reinterpret_cast<const CharT*>(find_string_special_avx2(reinterpret_cast<const char*>(first),
+                                                                                reinterpret_cast<const char*>(last)));
+                if (last - first >= 32)
+                {
+                    return first;
+                }
+            }
+    #endif
+            while (last - first >= 16)
+            {
+                mask = string_special_mask_sse2(_mm_loadu_si128(reinterpret_cast<const __m128i*>(first)));
+                if (mask != 0)
+                {
+                    return first + trailing_zeros(mask);
+                }
+                first += 16;
+            }
+        }
+#elif defined(JSONCONS_HAS_NEON)
+        const uint8x16_t quote = vdupq_n_u8('\"');
+        const uint8x16_t backslash = vdupq_n_u8('\\');
+        const uint8x16_t control_bound = vdupq_n_u8(0x20);
+        while (last - first >= 16)
+        {
+            const uint8x16_t v = vld1q_u8(reinterpret_cast<const uint8_t*>(first));
+            const uint8x16_t special = vorrq_u8(vorrq_u8(vceqq_u8(v, quote), vceqq_u8(v, backslash)),
+                                                vcltq_u8(v, control_bound));
+            if (vmaxvq_u8(special) != 0)
+            {
+                break; // located by the scalar loop below
+            }
+            first += 16;
+        }
+#endif
+        while (first != last && !is_string_special(*first))
+        {
+            ++first;
+        }
+        return first;
+    }
+
+    // find_escape_special returns a pointer to the first character in [first,last) that the
+    // JSON encoders cannot copy as is: a quote, backslash, control character or DEL, a solidus 
+    // if escape_solidus is set, or a character from 0x80 up if escape_all_non_ascii is set. 
+    // Returns last if there is none.
+
+    template <class CharT>
+    typename std::enable_if<sizeof(CharT) != sizeof(char),const CharT*>::type
+    find_escape_special(const CharT* first, const CharT* last, bool escape_solidus, bool escape_all_non_ascii) noexcept
+    {
+        while (first != last && !is_escape_special(*first, escape_solidus, escape_all_non_ascii))
+        {
+            ++first;
+        }
+        return first;
+    }
+
+    template <class CharT>
+    typename std::enable_if<sizeof(CharT) == sizeof(char),const CharT*>::type
+    find_escape_special(const CharT* first, const CharT* last, bool escape_solidus, bool escape_all_non_ascii) noexcept
+    {
+#if defined(JSONCONS_HAS_SSE2)
+        if (last - first >= 16)
+        {
+            const char solidus = escape_solidus ? '/' : '\"';
+            const __m128i solidus_v = _mm_set1_epi8(solidus);
+            const uint32_t non_ascii = escape_all_non_ascii ? 0xffffffffu : 0;
+
+            uint32_t mask = escape_special_mask_sse2(_mm_loadu_si128(reinterpret_cast<const __m128i*>(first)), solidus_v, non_ascii);
+            if (mask != 0)
+            {
+                return first + trailing_zeros(mask);
+            }
+            first += 16;
+    #if defined(JSONCONS_HAS_AVX2) || defined(JSONCONS_HAS_AVX2_DISPATCH)
+            if (last - first >= 64 && detect_simd_level() == simd_level::avx2)
+            {
+                first = reinterpret_cast<const CharT*>(find_escape_special_avx2(reinterpret_cast<const char*>(first),
+                                                                               reinterpret_cast<const char*>(last),
+                                                                               solidus, non_ascii));
+                if (last - first >= 32)
+                {
+                    return first;
+                }
+            }
+    #endif
+            while (last - first >= 16)
+            {
+                mask = escape_special_mask_sse2(_mm_loadu_si128(reinterpret_cast<const __m128i*>(first)), solidus_v, non_ascii);
+                if (mask != 0)
+                {
+                    return first + trailing_zeros(mask);
+                }
+                first += 16;
+            }
+        }
+#elif defined(JSONCONS_HAS_NEON)
+        const uint8x16_t quote = vdupq_n_u8('\"');
+        const uint8x16_t backslash = vdupq_n_u8('\\');
+        const uint8x16_t control_bound = vdupq_n_u8(0x20);
+        const uint8x16_t del = vdupq_n_u8(0x7f);
+        const uint8x16_t solidus = vdupq_n_u8(escape_solidus ? '/' : '\"');
+        const uint8x16_t non_ascii_bound = vdupq_n_u8(0x80);
+        const uint8x16_t non_ascii = vdupq_n_u8(escape_all_non_ascii ? 0xff : 0);
+        while (last - first >= 16)
+        {
+            const uint8x16_t v = vld1q_u8(reinterpret_cast<const uint8_t*>(first));
+            const uint8x16_t special = vorrq_u8(vorrq_u8(vorrq_u8(vceqq_u8(v, quote), vceqq_u8(v, backslash)),
+                                                         vorrq_u8(vcltq_u8(v, control_bound), vceqq_u8(v, del))),
+                                                vorrq_u8(vceqq_u8(v, solidus), vandq_u8(vcgeq_u8(v, non_ascii_bound), non_ascii)));
+            if (vmaxvq_u8(special) != 0)
+            {
+                break; // located by the scalar loop below
+            }
+            first += 16;
+        }
+#endif
+        while (first != last && !is_escape_special(*first, escape_solidus, escape_all_non_ascii))
+        {
+            ++first;
+        }
+        return first;
+    }
+
+    // find_nesting_special returns a pointer to the first quote, brace, bracket or newline
+    // in [first,last), or last if there is none.
+
+    template <class CharT>
+    typename std::enable_if<sizeof(CharT) != sizeof(char),const CharT*>::type
+    find_nesting_special(const CharT* first, const CharT* last) noexcept
+    {
+        while (first != last && !is_nesting_special(*first))
+        {
+            ++first;
+        }
+        return first;
+    }
+
+    template <class CharT>
+    typename std::enable_if<sizeof(CharT) == sizeof(char),const CharT*>::type
+    find_nesting_special(const CharT* first, const CharT* last) noexcept
+    {
+#if defined(JSONCONS_HAS_SSE2)
+        while (last - first >= 16)
+        {
+            const uint32_t mask = nesting_special_mask_sse2(_mm_loadu_si128(reinterpret_cast<const __m128i*>(first)));
+            if (mask != 0)
+            {
+                return first + trailing_zeros(mask);
+            }
+            first += 16;
+        }
+#elif defined(JSONCONS_HAS_NEON)
+        const uint8x16_t bit5 = vdupq_n_u8(0x20);
+        const uint8x16_t left = vdupq_n_u8('{');
+        const uint8x16_t right = vdupq_n_u8('}');
+        const uint8x16_t quote = vdupq_n_u8('\"');
+        const uint8x16_t newline = vdupq_n_u8('\n');
+        while (last - first >= 16)
+        {
+            const uint8x16_t v = vld1q_u8(reinterpret_cast<const uint8_t*>(first));
+            const uint8x16_t folded = vorrq_u8(v, bit5);
+            const uint8x16_t special = vorrq_u8(vorrq_u8(vceqq_u8(folded, left), vceqq_u8(folded, right)),
+                                                vorrq_u8(vceqq_u8(v, quote), vceqq_u8(v, newline)));
+            if (vmaxvq_u8(special) != 0)
+            {
+                break; // located by the scalar loop below
+            }
+            first += 16;
+        }
+#endif
+        while (first != last && !is_nesting_special(*first))
+        {
+            ++first;
+        }
+        return first;
+    }
+
+    // skip_blanks returns a pointer to the first character in [first,last) that is
+    // not a space or tab, or last if there is none.
+
+    template <class CharT>
+    typename std::enable_if<sizeof(CharT) != sizeof(char),const CharT*>::type
+    skip_blanks(const CharT* first, const CharT* last) noexcept
+    {
+        while (first != last && is_blank(*first))
+        {
+            ++first;
+        }
+        return first;
+    }
+
+    template <class CharT>
+    typename std::enable_if<sizeof(CharT) == sizeof(char),const CharT*>::type
+    skip_blanks(const CharT* first, const CharT* last) noexcept
+    {
+#if defined(JSONCONS_HAS_SSE2)
+        while (last - first >= 16)
+        {
+            const uint32_t mask = non_blank_mask_sse2(_mm_loadu_si128(reinterpret_cast<const __m128i*>(first)));
+            if (mask != 0)
+            {
+                return first + trailing_zeros(mask);
+            }
+            first += 16;
+        }
+#elif defined(JSONCONS_HAS_NEON)
+        const uint8x16_t space = vdupq_n_u8(' ');
+        const uint8x16_t tab = vdupq_n_u8('\t');
+        while (last - first >= 16)
+        {
+            const uint8x16_t v = vld1q_u8(reinterpret_cast<const uint8_t*>(first));
+            const uint8x16_t blank = vorrq_u8(vceqq_u8(v, space), vceqq_u8(v, tab));
+            if (vminvq_u8(blank) == 0)
+            {
+                break; // located by the scalar loop below
+            }
+            first += 16;
+        }
+#endif
+        while (first != last && is_blank(*first))
+        {
+            ++first;
+        }
+        return first;
+    }
+
+} // namespace detail
+} // namespace jsoncons
+
+#endif // JSONCONS_DETAIL_SIMD_SCAN_HPP
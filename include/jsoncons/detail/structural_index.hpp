@@ -0,0 +1,387 @@
+// Copyright 2021 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_DETAIL_STRUCTURAL_INDEX_HPP
+#define JSONCONS_DETAIL_STRUCTURAL_INDEX_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring> // std::memcpy, std::memset
+#include <vector>
+#include <limits> // std::numeric_limits
+#include <jsoncons/config/compiler_support.hpp>
+#include <jsoncons/detail/simd_scan.hpp>
+
+namespace jsoncons {
+namespace detail {
+
+    // Character classes used by stage 1 of the two-stage parser
+
+    struct structural_block
+    {
+        uint64_t backslash;
+        uint64_t quote;
+        uint64_t op;          // { } [ ] : ,
+        uint64_t whitespace;  // space, tab, line feed, carriage return
+    };
+
+    inline uint8_t structural_char_class(uint8_t c) noexcept
+    {
+        switch (c)
+        {
+            case '{': case '}': case '[': case ']': case ':': case ',':
+                return 1;
+            case ' ': case '\t': case '\n': case '\r':
+                return 2;
+            case '\"':
+                return 4;
+            case '\\':
+                return 8;
+            default:
+                return 0;
+        }
+    }
+
+    inline void classify_block_scalar(const uint8_t* p, structural_block& block) noexcept
+    {
+        block.backslash = 0;
+        block.quote = 0;
+        block.op = 0;
+        block.whitespace = 0;
+        for (std::size_t i = 0; i < 64; ++i)
+        {
+            const uint64_t bit = uint64_t(1) << i;
+            switch (structural_char_class(p[i]))
+            {
+                case 1: block.op |= bit; break;
+                case 2: block.whitespace |= bit; break;
+                case 4: block.quote |= bit; break;
+                case 8: block.backslash |= bit; break;
+                default: break;
+            }
+        }
+    }
+
+#if defined(JSONCONS_HAS_SSE2)
+
+    inline void classify_block_sse2(const uint8_t* p, structural_block& block) noexcept
+    {
+        block.backslash = 0;
+        block.quote = 0;
+        block.op = 0;
+        block.whitespace = 0;
+        for (int i = 0; i < 4; ++i)
+        {
+            const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 16*i));
+            const __m128i op = _mm_or_si128(
+                _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('{')), _mm_cmpeq_epi8(v, _mm_set1_epi8('}'))),
+                             _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('[')), _mm_cmpeq_epi8(v, _mm_set1_epi8(']')))),
+                _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8(':')), _mm_cmpeq_epi8(v, _mm_set1_epi8(','))));
+            const __m128i ws = _mm_or_si128(
+                _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8(' ')), _mm_cmpeq_epi8(v, _mm_set1_epi8('\t'))),
+                _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('\n')), _mm_cmpeq_epi8(v, _mm_set1_epi8('\r'))));
+            const int shift = 16*i;
+            block.backslash |= uint64_t(uint16_t(_mm_movemask_epi8(_mm_cmpeq_epi8(v, _mm_set1_epi8('\\'))))) << shift;
+            block.quote |= uint64_t(uint16_t(_mm_movemask_epi8(_mm_cmpeq_epi8(v, _mm_set1_epi8('\"'))))) << shift;
+            block.op |= uint64_t(uint16_t(_mm_movemask_epi8(op))) << shift;
+            block.whitespace |= uint64_t(uint16_t(_mm_movemask_epi8(ws))) << shift;
+        }
+    }
+
+#elif defined(JSONCONS_HAS_NEON)
+
+    inline uint64_t neon_movemask64(uint8x16_t m0, uint8x16_t m1, uint8x16_t m2, uint8x16_t m3) noexcept
+    {
+        const uint8x16_t bit_mask = {0x01, 0x02, 0x4, 0x8, 0x10, 0x20, 0x40, 0x80,
+                                     0x01, 0x02, 0x4, 0x8, 0x10, 0x20, 0x40, 0x80};
+        uint8x16_t sum0 = vpaddq_u8(vandq_u8(m0, bit_mask), vandq_u8(m1, bit_mask));
+        uint8x16_t sum1 = vpaddq_u8(vandq_u8(m2, bit_mask), vandq_u8(m3, bit_mask));
+        sum0 = vpaddq_u8(sum0, sum1);
+        sum0 = vpaddq_u8(sum0, sum0);
+        return vgetq_lane_u64(vreinterpretq_u64_u8(sum0), 0);
+    }
+
+    inline void classify_block_neon(const uint8_t* p, structural_block& block) noexcept
+    {
+        uint8x16_t backslash[4];
+        uint8x16_t quote[4];
+        uint8x16_t op[4];
+        uint8x16_t ws[4];
+        for (int i = 0; i < 4; ++i)
+        {
+            const uint8x16_t v = vld1q_u8(p + 16*i);
+            backslash[i] = vceqq_u8(v, vdupq_n_u8('\\'));
+            quote[i] = vceqq_u8(v, vdupq_n_u8('\"'));
+            op[i] = vorrq_u8(vorrq_u8(vorrq_u8(vceqq_u8(v, vdupq_n_u8('{')), vceqq_u8(v, vdupq_n_u8('}'))),
+                                      vorrq_u8(vceqq_u8(v, vdupq_n_u8('[')), vceqq_u8(v, vdupq_n_u8(']')))),
+                             vorrq_u8(vceqq_u8(v, vdupq_n_u8(':')), vceqq_u8(v, vdupq_n_u8(','))));
+            ws[i] = vorrq_u8(vorrq_u8(vceqq_u8(v, vdupq_n_u8(' ')), vceqq_u8(v, vdupq_n_u8('\t'))),
+                             vorrq_u8(vceqq_u8(v, vdupq_n_u8('\n')), vceqq_u8(v, vdupq_n_u8('\r'))));
+        }
+        block.backslash = neon_movemask64(backslash[0], backslash[1], backslash[2], backslash[3]);
+        block.quote = neon_movemask64(quote[0], quote[1], quote[2], quote[3]);
+        block.op = neon_movemask64(op[0], op[1], op[2], op[3]);
+        block.whitespace = neon_movemask64(ws[0], ws[1], ws[2], ws[3]);
+    }
+
+#endif
+
+    inline void classify_block(const uint8_t* p, structural_block& block) noexcept
+    {
+#if defined(JSONCONS_HAS_SSE2)
+        classify_block_sse2(p, block);
+#elif defined(JSONCONS_HAS_NEON)
+        classify_block_neon(p, block);
+#else
+        classify_block_scalar(p, block);
+#endif
+    }
+
+    // Bit i of the result is the xor of bits 0..i of x
+    inline uint64_t prefix_xor(uint64_t x) noexcept
+    {
+        x ^= x << 1;
+        x ^= x << 2;
+        x ^= x << 4;
+        x ^= x << 8;
+        x ^= x << 16;
+        x ^= x << 32;
+        return x;
+    }
+
+    // Classifies input 64 bytes at a time, carrying escape, string and scalar state 
+    // from one block to the next
+
+    class structural_scanner
+    {
+        uint64_t prev_ends_odd_backslash_; // 1 if the previous block ended in an odd run of backslashes
+        uint64_t prev_in_string_;          // all ones if the previous block ended inside a string
+        uint64_t prev_scalar_;             // 1 if the previous block ended in a number or literal
+        uint8_t tail_[64];
+    public:
+        // Bits of the last block scanned
+        uint64_t op;             // { } [ ] : , outside strings
+        uint64_t opening_quotes;
+        uint64_t scalar_starts;  // first character of numbers and literals
+
+        structural_scanner() noexcept
+            : prev_ends_odd_backslash_(0), prev_in_string_(0), prev_scalar_(0), 
+              op(0), opening_quotes(0), scalar_starts(0)
+        {
+        }
+
+        bool in_string() const noexcept
+        {
+            return prev_in_string_ != 0;
+        }
+
+        // Scans the block at p, of which remaining bytes, at most 64, are input
+        void scan(const uint8_t* p, std::size_t remaining) noexcept
+        {
+            const uint64_t even_bits = 0x5555555555555555ULL;
+            const uint64_t odd_bits = ~even_bits;
+
+            structural_block block;
+            if (remaining >= 64)
+            {
+                classify_block(p, block);
+            }
+            else
+            {
+                std::memset(tail_, ' ', sizeof(tail_));
+                std::memcpy(tail_, p, remaining);
+                classify_block(tail_, block);
+            }
+
+            // Characters preceded by an odd number of backslashes are escaped
+            const uint64_t start_edges = block.backslash & ~(block.backslash << 1);
+            const uint64_t even_start_mask = even_bits ^ prev_ends_odd_backslash_;
+            const uint64_t even_starts = start_edges & even_start_mask;
+            const uint64_t odd_starts = start_edges & ~even_start_mask;
+            const uint64_t even_carries = block.backslash + even_starts;
+            uint64_t odd_carries = block.backslash + odd_starts;
+            const uint64_t ends_odd_backslash = odd_carries < block.backslash ? 1 : 0;
+            odd_carries |= prev_ends_odd_backslash_;
+            prev_ends_odd_backslash_ = ends_odd_backslash;
+            const uint64_t even_carry_ends = even_carries & ~block.backslash;
+            const uint64_t odd_carry_ends = odd_carries & ~block.backslash;
+            const uint64_t escaped = (even_carry_ends & odd_bits) | (odd_carry_ends & even_bits);
+
+            const uint64_t quotes = block.quote & ~escaped;
+            // Set from an opening quote up to, not including, its closing quote
+            const uint64_t in_string = prefix_xor(quotes) ^ prev_in_string_;
+            prev_in_string_ = static_cast<uint64_t>(static_cast<int64_t>(in_string) >> 63);
+
+            op = block.op & ~in_string;
+            opening_quotes = quotes & in_string;
+            const uint64_t scalar = ~(block.op | block.whitespace | block.quote) & ~in_string;
+            scalar_starts = scalar & ~((scalar << 1) | prev_scalar_);
+            prev_scalar_ = scalar >> 63;
+
+            if (remaining < 64)
+            {
+                const uint64_t valid = (uint64_t(1) << remaining) - 1;
+                op &= valid;
+                opening_quotes &= valid;
+                scalar_starts &= valid;
+            }
+        }
+    };
+
+    // Stage 1 of the two-stage parser. Records the offset of every structural character
+    // ({ } [ ] : ,) outside strings, of every opening quote, and of the first character
+    // of every number or literal. Returns false if the input ends inside a string, or is
+    // too large to be indexed with 32 bit offsets.
+
+    template <class Allocator>
+    bool build_structural_index(const char* data, std::size_t length,
+                                std::vector<uint32_t,Allocator>& index)
+    {
+        index.clear();
+        if (length >= (std::numeric_limits<uint32_t>::max)())
+        {
+            return false;
+        }
+        // Structural characters are usually between a sixth and a tenth of the input
+        index.reserve(length/8 + 16);
+
+        const uint8_t* p = reinterpret_cast<const uint8_t*>(data);
+        structural_scanner scanner;
+
+        for (std::size_t offset = 0; offset < length; offset += 64)
+        {
+            scanner.scan(p + offset, length - offset);
+            uint64_t structurals = scanner.op | scanner.opening_quotes | scanner.scalar_starts;
+            while (structurals != 0)
+            {
+                index.push_back(static_cast<uint32_t>(offset + trailing_zeros64(structurals)));
+                structurals &= structurals - 1;
+            }
+        }
+        return !scanner.in_string();
+    }
+
+    // Finds the elements of the array that starts at data[first], which must be '['. 
+    // On success, separators holds the offsets of the opening bracket, of the commas between 
+    // elements, and of the closing bracket, and max_depth the deepest nesting seen. 
+    // Returns false if brackets do not balance or the input ends first. The elements 
+    // themselves are not validated.
+
+    template <class Allocator>
+    bool find_array_elements(const char* data, std::size_t length, std::size_t first,
+                             std::vector<std::size_t,Allocator>& separators, std::size_t& max_depth)
+    {
+        separators.clear();
+        max_depth = 0;
+        if (first >= length || data[first] != '[')
+        {
+            return false;
+        }
+
+        const uint8_t* p = reinterpret_cast<const uint8_t*>(data);
+        structural_scanner scanner;
+        std::size_t depth = 0;
+
+        // Blocks are aligned on first, bits below first are skipped
+        for (std::size_t offset = first; offset < length; offset += 64)
+        {
+            scanner.scan(p + offset, length - offset);
+            uint64_t ops = scanner.op;
+            while (ops != 0)
+            {
+                const std::size_t pos = offset + trailing_zeros64(ops);
+                ops &= ops - 1;
+                switch (data[pos])
+                {
+                    case '[': 
+                    case '{':
+                        if (++depth > max_depth)
+                        {
+                            max_depth = depth;
+                        }
+                        if (depth == 1)
+                        {
+                            separators.push_back(pos);
+                        }
+                        break;
+                    case ']':
+                    case '}':
+                        if (depth == 0)
+                        {
+                            return false;
+                        }
+                        if (--depth == 0)
+                        {
+                            separators.push_back(pos);
+                            return data[pos] == ']';
+                        }
+                        break;
+                    case ',':
+                        if (depth == 1)
+                        {
+                            separators.push_back(pos);
+                        }
+                        break;
+                    default:
+                        break;
+                }
+            }
+        }
+        return false;
+    }
+
+    // Finds the bracket or brace that closes the array or object that starts at data[first].
+    // Returns its offset, or length if brackets do not balance or the input ends first.
+    // The contents are not validated.
+
+    inline std::size_t find_container_end(const char* data, std::size_t length, std::size_t first)
+    {
+        if (first >= length || (data[first] != '[' && data[first] != '{'))
+        {
+            return length;
+        }
+
+        const uint8_t* p = reinterpret_cast<const uint8_t*>(data);
+        structural_scanner scanner;
+        std::size_t depth = 0;
+
+        for (std::size_t offset = first; offset < length; offset += 64)
+        {
+            scanner.scan(p + offset, length - offset);
+            uint64_t ops = scanner.op;
+            while (ops != 0)
+            {
+                const std::size_t pos = offset + trailing_zeros64(ops);
+                ops &= ops - 1;
+                switch (data[pos])
+                {
+                    case '[': 
+                    case '{':
+                        ++depth;
+                        break;
+                    case ']':
+                    case '}':
+                        if (depth == 0)
+                        {
+                            return length;
+                        }
+                        if (--depth == 0)
+                        {
+                            return (data[pos] == ']') == (data[first] == '[') ? pos : length;
+                        }
+                        break;
+                    default:
+                        break;
+                }
+            }
+        }
+        return length;
+    }
+
+} // namespace detail
+} // namespace jsoncons
+
+#endif // JSONCONS_DETAIL_STRUCTURAL_INDEX_HPP
@@ -16,7 +16,7 @@
 #include <stdio.h> // snprintf
 #include <jsoncons/config/jsoncons_config.hpp>
 #include <jsoncons/json_options.hpp>
-#include <jsoncons/detail/grisu3.hpp>
+#include <jsoncons/detail/schubfach.hpp>
 #include <jsoncons/detail/parse_number.hpp>
 #include <jsoncons/detail/more_type_traits.hpp>
 
@@ -284,7 +284,7 @@ namespace detail {
     }
 
     template<class Result>
-    bool dtoa_scientific(double val, char decimal_point, Result& result)
+    bool dtoa_scientific(double val, char decimal_point, Result& result, std::false_type)
     {
         if (val == 0)
         {
@@ -316,6 +316,33 @@ namespace detail {
         return true;
     }
 
+    template<class Result>
+    bool dtoa_scientific(double v, char, Result& result, std::true_type)
+    {
+        if (v == 0)
+        {
+            result.push_back('0');
+            result.push_back('.');
+            result.push_back('0');
+            return true;
+        }
+
+        int length = 0;
+        int k;
+
+        char buffer[100];
+
+        double u = std::signbit(v) ? -v : v;
+        jsoncons::detail::schubfach(u, buffer, length, k);
+        if (std::signbit(v))
+        {
+            result.push_back('-');
+        }
+        // An empty range for plain and fixed point notation
+        jsoncons::detail::prettify_string(buffer, length, k, 0, 0, result);
+        return true;
+    }
+
     template<class Result>
     bool dtoa_general(double val, char decimal_point, Result& result, std::false_type)
     {
@@ -350,7 +377,7 @@ namespace detail {
     }
 
     template<class Result>
-    bool dtoa_general(double v, char decimal_point, Result& result, std::true_type)
+    bool dtoa_general(double v, char, Result& result, std::true_type)
     {
         if (v == 0)
         {
@@ -366,21 +393,15 @@ namespace detail {
         char buffer[100];
 
         double u = std::signbit(v) ? -v : v;
-        if (jsoncons::detail::grisu3(u, buffer, &length, &k))
+        jsoncons::detail::schubfach(u, buffer, length, k);
+        if (std::signbit(v))
         {
-            if (std::signbit(v))
-            {
-                result.push_back('-');
-            }
-            // min exp: -4 is consistent with sprintf
-            // max exp: std::numeric_limits<double>::max_digits10
-            jsoncons::detail::prettify_string(buffer, length, k, -4, std::numeric_limits<double>::max_digits10, result);
-            return true;
-        }
-        else
-        {
-            return dtoa_general(v, decimal_point, result, std::false_type());
+            result.push_back('-');
         }
+        // min exp: -4 is consistent with sprintf
+        // max exp: std::numeric_limits<double>::max_digits10
+        jsoncons::detail::prettify_string(buffer, length, k, -4, std::numeric_limits<double>::max_digits10, result);
+        return true;
     }
 
     template<class Result>
@@ -417,7 +438,7 @@ namespace detail {
     }
 
     template<class Result>
-    bool dtoa_fixed(double v, char decimal_point, Result& result, std::true_type)
+    bool dtoa_fixed(double v, char, Result& result, std::true_type)
     {
         if (v == 0)
         {
@@ -433,19 +454,13 @@ namespace detail {
         char buffer[100];
 
         double u = std::signbit(v) ? -v : v;
-        if (jsoncons::detail::grisu3(u, buffer, &length, &k))
+        jsoncons::detail::schubfach(u, buffer, length, k);
+        if (std::signbit(v))
         {
-            if (std::signbit(v))
-            {
-                result.push_back('-');
-            }
-            jsoncons::detail::prettify_string(buffer, length, k, std::numeric_limits<int>::lowest(), (std::numeric_limits<int>::max)(), result);
-            return true;
-        }
-        else
-        {
-            return dtoa_fixed(v, decimal_point, result, std::false_type());
+            result.push_back('-');
         }
+        jsoncons::detail::prettify_string(buffer, length, k, std::numeric_limits<int>::lowest(), (std::numeric_limits<int>::max)(), result);
+        return true;
     }
 
     template<class Result>
@@ -460,6 +475,12 @@ namespace detail {
         return dtoa_general(v, decimal_point, result, std::integral_constant<bool, std::numeric_limits<double>::is_iec559>());
     }
 
+    template<class Result>
+    bool dtoa_scientific(double v, char decimal_point, Result& result)
+    {
+        return dtoa_scientific(v, decimal_point, result, std::integral_constant<bool, std::numeric_limits<double>::is_iec559>());
+    }
+
     class write_double
     {
     private:
@@ -11,6 +11,7 @@
 #include <tuple>
 #include <array>
 #include <memory>
+#include <iterator> // std::distance
 #include <type_traits> // std::enable_if, std::true_type, std::false_type
 #include <jsoncons/json_visitor.hpp>
 #include <jsoncons/json_decoder.hpp>
@@ -158,6 +159,23 @@ namespace jsoncons {
         }
     };
 
+    // types declared with the json traits macros
+
+    template <class T, class CharT>
+    struct encode_traits<T,CharT,
+        typename std::enable_if<json_traits_macro_encoder<T>::value
+    >::type>
+    {
+        template <class Json>
+        static void encode(const T& val, 
+                           basic_json_visitor<CharT>& encoder, 
+                           const Json& proto, 
+                           std::error_code& ec)
+        {
+            json_traits_macro_encoder<T>::encode(val, encoder, proto, ec);
+        }
+    };
+
     // std::pair
 
     template <class T1, class T2, class CharT>
@@ -254,7 +272,7 @@ namespace jsoncons {
                            const Json& proto, 
                            std::error_code& ec)
         {
-            encoder.begin_array(val.size(),semantic_tag::none,ser_context(),ec);
+            encoder.begin_array(size_of(val),semantic_tag::none,ser_context(),ec);
             if (ec) return;
             for (auto it = std::begin(val); it != std::end(val); ++it)
             {
@@ -263,6 +281,21 @@ namespace jsoncons {
             }
             encoder.end_array(ser_context(), ec);
         }
+    private:
+        template <class U = T>
+        static typename std::enable_if<jsoncons::detail::has_size<U>::value,std::size_t>::type
+        size_of(const U& val)
+        {
+            return val.size();
+        }
+
+        // e.g. std::forward_list
+        template <class U = T>
+        static typename std::enable_if<!jsoncons::detail::has_size<U>::value,std::size_t>::type
+        size_of(const U& val)
+        {
+            return static_cast<std::size_t>(std::distance(std::begin(val), std::end(val)));
+        }
     };
 
     template <class T, class CharT>
@@ -0,0 +1,392 @@
+// Copyright 2021 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_FD_SINK_HPP
+#define JSONCONS_FD_SINK_HPP
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstring> // std::memcpy
+#include <memory> // std::unique_ptr
+#include <mutex>
+#include <system_error>
+#include <thread>
+#include <utility> // std::swap
+#include <vector>
+#include <jsoncons/config/jsoncons_config.hpp>
+
+#if defined(__unix__) || defined(__APPLE__)
+#  define JSONCONS_HAS_FD_SINK 1
+#  include <sys/types.h>
+#  include <sys/uio.h>
+#  include <unistd.h>
+#  include <cerrno>
+#endif
+
+#if defined(JSONCONS_HAS_FD_SINK)
+
+namespace jsoncons {
+
+    enum class fd_write_mode : uint8_t
+    {
+        // Buffers are written on the thread that fills them
+        direct,
+        // Full buffers are handed to a writer thread while the next one is filled
+        writer_thread
+    };
+
+namespace detail {
+
+    // Writes all of iov, retrying after signals and short writes
+    inline std::error_code write_all(int fd, struct iovec* iov, int iovcnt)
+    {
+        while (iovcnt > 0)
+        {
+            ssize_t n = ::writev(fd, iov, iovcnt);
+            if (n < 0)
+            {
+                if (errno == EINTR)
+                {
+                    continue;
+                }
+                return std::error_code(errno, std::system_category());
+            }
+            std::size_t written = static_cast<std::size_t>(n);
+            while (iovcnt > 0 && written >= iov->iov_len)
+            {
+                written -= iov->iov_len;
+                ++iov;
+                --iovcnt;
+            }
+            if (iovcnt > 0)
+            {
+                iov->iov_base = static_cast<char*>(iov->iov_base) + written;
+                iov->iov_len -= written;
+            }
+        }
+        return std::error_code();
+    }
+
+    // Owns the writer thread of an fd sink, if it has one, and the first error
+    // seen on the descriptor. Once a write has failed, later writes are dropped.
+    // Lives on the heap so that the sink can be moved while a write is in flight.
+
+    class fd_writer
+    {
+        int fd_;
+        std::error_code ec_;
+        std::thread thread_;
+        std::mutex mutex_;
+        std::condition_variable cv_;
+        const void* pending_;
+        std::size_t pending_length_;
+        bool stopping_;
+
+        // Noncopyable and nonmoveable
+        fd_writer(const fd_writer&) = delete;
+        fd_writer& operator=(const fd_writer&) = delete;
+    public:
+        fd_writer(int fd, fd_write_mode mode)
+            : fd_(fd), pending_(nullptr), pending_length_(0), stopping_(false)
+        {
+            if (mode == fd_write_mode::writer_thread)
+            {
+                thread_ = std::thread([this]() { run(); });
+            }
+        }
+
+        ~fd_writer() noexcept
+        {
+            if (thread_.joinable())
+            {
+                {
+                    std::lock_guard<std::mutex> lock(mutex_);
+                    stopping_ = true;
+                }
+                cv_.notify_all();
+                thread_.join();
+            }
+        }
+
+        // Starts writing data, which must stay valid until the next call to post,
+        // write or wait. Without a writer thread, the write completes before return.
+        void post(const void* data, std::size_t length)
+        {
+            if (!thread_.joinable())
+            {
+                write(data, length, nullptr, 0);
+                return;
+            }
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                cv_.wait(lock, [this]() { return pending_ == nullptr; });
+                if (ec_)
+                {
+                    return;
+                }
+                pending_ = data;
+                pending_length_ = length;
+            }
+            cv_.notify_all();
+        }
+
+        // Writes data1 followed by data2 on the calling thread, in one system call
+        // when the descriptor accepts it all
+        void write(const void* data1, std::size_t length1, const void* data2, std::size_t length2)
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            cv_.wait(lock, [this]() { return pending_ == nullptr; });
+            if (ec_)
+            {
+                return;
+            }
+            struct iovec iov[2];
+            iov[0].iov_base = const_cast<void*>(data1);
+            iov[0].iov_len = length1;
+            iov[1].iov_base = const_cast<void*>(data2);
+            iov[1].iov_len = length2;
+            ec_ = write_all(fd_, iov, 2);
+        }
+
+        // Blocks until a posted write has completed
+        void wait()
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            cv_.wait(lock, [this]() { return pending_ == nullptr; });
+        }
+
+        std::error_code error_code()
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            return ec_;
+        }
+
+    private:
+        void run()
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            while (true)
+            {
+                cv_.wait(lock, [this]() { return stopping_ || pending_ != nullptr; });
+                if (pending_ == nullptr)
+                {
+                    return;
+                }
+                struct iovec iov;
+                iov.iov_base = const_cast<void*>(pending_);
+                iov.iov_len = pending_length_;
+                lock.unlock();
+                std::error_code ec = write_all(fd_, &iov, 1);
+                lock.lock();
+                ec_ = ec;
+                pending_ = nullptr;
+                cv_.notify_all();
+            }
+        }
+    };
+
+    // The buffering shared by fd_sink and binary_fd_sink. With a writer thread
+    // there are two buffers, one is filled while the other is being written.
+
+    template <class T>
+    class basic_fd_sink
+    {
+    public:
+        using value_type = T;
+
+        static constexpr size_t default_buffer_length = 1048576;
+    private:
+        std::unique_ptr<fd_writer> writer_;
+        std::vector<T> buffer_;
+        std::vector<T> spare_;
+        T* begin_buffer_;
+        const T* end_buffer_;
+        T* p_;
+
+        // Noncopyable
+        basic_fd_sink(const basic_fd_sink&) = delete;
+        basic_fd_sink& operator=(const basic_fd_sink&) = delete;
+
+    public:
+        basic_fd_sink(basic_fd_sink&&) = default;
+
+        basic_fd_sink(int fd, std::size_t buflen, fd_write_mode mode)
+            : writer_(new fd_writer(fd, mode)),
+              buffer_(buflen > 0 ? buflen : 1),
+              spare_(mode == fd_write_mode::writer_thread ? buffer_.size() : 0),
+              begin_buffer_(buffer_.data()),
+              end_buffer_(begin_buffer_+buffer_.size()),
+              p_(begin_buffer_)
+        {
+        }
+
+        ~basic_fd_sink() noexcept
+        {
+            if (writer_)
+            {
+                flush();
+            }
+        }
+
+        // Movable
+        basic_fd_sink& operator=(basic_fd_sink&& other) noexcept
+        {
+            if (this != &other)
+            {
+                if (writer_)
+                {
+                    flush();
+                }
+                writer_ = std::move(other.writer_);
+                buffer_ = std::move(other.buffer_);
+                spare_ = std::move(other.spare_);
+                begin_buffer_ = other.begin_buffer_;
+                end_buffer_ = other.end_buffer_;
+                p_ = other.p_;
+            }
+            return *this;
+        }
+
+        // Hands the buffered data to the operating system. This does not
+        // synchronize the file with the device, use fsync for that.
+        void flush()
+        {
+            write_buffer();
+            writer_->wait();
+        }
+
+        void append(const T* s, std::size_t length)
+        {
+            std::size_t diff = end_buffer_ - p_;
+            if (diff >= length)
+            {
+                std::memcpy(p_, s, length*sizeof(T));
+                p_ += length;
+            }
+            else
+            {
+                writer_->write(begin_buffer_, buffer_length()*sizeof(T), s, length*sizeof(T));
+                p_ = begin_buffer_;
+            }
+        }
+
+        void push_back(T ch)
+        {
+            if (p_ < end_buffer_)
+            {
+                *p_++ = ch;
+            }
+            else
+            {
+                write_buffer();
+                *p_++ = ch;
+            }
+        }
+
+        bool is_error() const
+        {
+            return static_cast<bool>(writer_->error_code());
+        }
+
+        // The first error returned by write or writev, data written after a
+        // failure is discarded. Call flush first to see the errors of all writes.
+        std::error_code error_code() const
+        {
+            return writer_->error_code();
+        }
+
+    private:
+        void write_buffer()
+        {
+            std::size_t length = buffer_length();
+            if (length == 0)
+            {
+                return;
+            }
+            writer_->post(begin_buffer_, length*sizeof(T));
+            if (!spare_.empty())
+            {
+                buffer_.swap(spare_);
+                begin_buffer_ = buffer_.data();
+                end_buffer_ = begin_buffer_ + buffer_.size();
+            }
+            p_ = begin_buffer_;
+        }
+
+        std::size_t buffer_length() const
+        {
+            return p_ - begin_buffer_;
+        }
+    };
+
+    template <class T>
+    constexpr size_t basic_fd_sink<T>::default_buffer_length;
+
+} // namespace detail
+
+    // fd_sink
+
+    template <class CharT>
+    class fd_sink : public detail::basic_fd_sink<CharT>
+    {
+        using base_type = detail::basic_fd_sink<CharT>;
+    public:
+        using value_type = CharT;
+        using container_type = int;
+
+        fd_sink(fd_sink&&) = default;
+
+        // The caller keeps ownership of fd, it is not closed by the sink
+        fd_sink(int fd)
+            : base_type(fd, base_type::default_buffer_length, fd_write_mode::direct)
+        {
+        }
+        fd_sink(int fd, std::size_t buflen)
+            : base_type(fd, buflen, fd_write_mode::direct)
+        {
+        }
+        fd_sink(int fd, std::size_t buflen, fd_write_mode mode)
+            : base_type(fd, buflen, mode)
+        {
+        }
+
+        fd_sink& operator=(fd_sink&&) = default;
+    };
+
+    // binary_fd_sink
+
+    class binary_fd_sink : public detail::basic_fd_sink<uint8_t>
+    {
+        using base_type = detail::basic_fd_sink<uint8_t>;
+    public:
+        typedef uint8_t value_type;
+        using container_type = int;
+
+        binary_fd_sink(binary_fd_sink&&) = default;
+
+        // The caller keeps ownership of fd, it is not closed by the sink
+        binary_fd_sink(int fd)
+            : base_type(fd, base_type::default_buffer_length, fd_write_mode::direct)
+        {
+        }
+        binary_fd_sink(int fd, std::size_t buflen)
+            : base_type(fd, buflen, fd_write_mode::direct)
+        {
+        }
+        binary_fd_sink(int fd, std::size_t buflen, fd_write_mode mode)
+            : base_type(fd, buflen, mode)
+        {
+        }
+
+        binary_fd_sink& operator=(binary_fd_sink&&) = default;
+    };
+
+} // namespace jsoncons
+
+#endif // defined(JSONCONS_HAS_FD_SINK)
+
+#endif // JSONCONS_FD_SINK_HPP
@@ -0,0 +1,1091 @@
+// Copyright 2021 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_FROZEN_JSON_HPP
+#define JSONCONS_FROZEN_JSON_HPP
+
+#include <algorithm> // std::stable_sort, std::lower_bound
+#include <cstddef>
+#include <cstdint>
+#include <cstring> // std::memcpy
+#include <functional> // std::function
+#include <istream>
+#include <iterator>
+#include <memory> // std::allocator_traits
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <vector>
+#include <jsoncons/config/jsoncons_config.hpp>
+#include <jsoncons/basic_json.hpp>
+#include <jsoncons/json_decoder.hpp>
+#include <jsoncons/json_encoder.hpp>
+#include <jsoncons/json_reader.hpp>
+
+namespace jsoncons {
+
+namespace detail {
+
+    // A frozen document is a tape of 64 bit words. Every value starts with a header
+    // word that holds its json_type in the top 8 bits, its semantic_tag in the next 8 bits,
+    // and a 48 bit payload.
+    //
+    // null, bool      header, payload 0 or 1
+    // int64, uint64,  header, value word
+    //   double
+    // string          header with length in characters, characters padded to a whole word
+    // byte string     header with length in bytes, ext tag word, bytes padded to a whole word
+    // array           header with size, table position word, elements,
+    //                 table of element positions
+    // object          header with size, table position word, keys and values,
+    //                 table of (key position, value position) pairs in document order,
+    //                 member numbers sorted by key
+
+    struct frozen_tape
+    {
+        static constexpr int type_shift = 56;
+        static constexpr int tag_shift = 48;
+        static constexpr uint64_t payload_mask = (uint64_t(1) << 48) - 1;
+
+        static uint64_t header(json_type type, semantic_tag tag, uint64_t payload) noexcept
+        {
+            return (static_cast<uint64_t>(type) << type_shift) | (static_cast<uint64_t>(tag) << tag_shift) | payload;
+        }
+
+        static json_type type(uint64_t word) noexcept
+        {
+            return static_cast<json_type>(word >> type_shift);
+        }
+
+        static semantic_tag tag(uint64_t word) noexcept
+        {
+            return static_cast<semantic_tag>((word >> tag_shift) & 0xff);
+        }
+
+        static std::size_t payload(uint64_t word) noexcept
+        {
+            return static_cast<std::size_t>(word & payload_mask);
+        }
+
+        static std::size_t words_for(std::size_t bytes) noexcept
+        {
+            return (bytes + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+        }
+    };
+
+} // namespace detail
+
+    // basic_frozen_json_builder is a visitor that packs the events it receives into the tape
+    // of a basic_frozen_json
+
+    template <class CharT,class Allocator=std::allocator<char>>
+    class basic_frozen_json_builder : public basic_json_visitor<CharT>
+    {
+    public:
+        using char_type = CharT;
+        using typename basic_json_visitor<CharT>::string_view_type;
+        using allocator_type = Allocator;
+        using word_allocator_type = typename std::allocator_traits<allocator_type>:: template rebind_alloc<uint64_t>;
+        using tape_type = std::vector<uint64_t,word_allocator_type>;
+    private:
+        using tape = jsoncons::detail::frozen_tape;
+
+        struct frame
+        {
+            std::size_t header;
+            std::size_t first_child;
+            bool is_object;
+        };
+        using frame_allocator_type = typename std::allocator_traits<allocator_type>:: template rebind_alloc<frame>;
+
+        tape_type tape_;
+        tape_type children_;
+        std::vector<frame,frame_allocator_type> stack_;
+        bool is_valid_;
+
+        // Noncopyable and nonmoveable
+        basic_frozen_json_builder(const basic_frozen_json_builder&) = delete;
+        basic_frozen_json_builder& operator=(const basic_frozen_json_builder&) = delete;
+    public:
+        basic_frozen_json_builder(const allocator_type& alloc = allocator_type())
+            : tape_(word_allocator_type(alloc)),
+              children_(word_allocator_type(alloc)),
+              stack_(frame_allocator_type(alloc)),
+              is_valid_(false)
+        {
+        }
+
+        bool is_valid() const
+        {
+            return is_valid_;
+        }
+
+        void reset()
+        {
+            tape_.clear();
+            children_.clear();
+            stack_.clear();
+            is_valid_ = false;
+        }
+
+        // Moves the tape out of the builder
+        tape_type get_result()
+        {
+            JSONCONS_ASSERT(is_valid_);
+            is_valid_ = false;
+            return std::move(tape_);
+        }
+
+    private:
+        void visit_flush() override
+        {
+        }
+
+        bool visit_begin_object(semantic_tag tag, const ser_context&, std::error_code&) override
+        {
+            begin_container(json_type::object_value, tag);
+            return true;
+        }
+
+        bool visit_end_object(const ser_context&, std::error_code&) override
+        {
+            JSONCONS_ASSERT(!stack_.empty() && stack_.back().is_object);
+            const frame& f = stack_.back();
+            std::size_t count = (children_.size() - f.first_child) / 2;
+            std::size_t table = tape_.size();
+            tape_.insert(tape_.end(), children_.begin() + f.first_child, children_.end());
+
+            std::size_t order = tape_.size();
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                tape_.push_back(i);
+            }
+            const uint64_t* pairs = tape_.data() + table;
+            const uint64_t* words = tape_.data();
+            std::stable_sort(tape_.begin() + order, tape_.end(),
+                             [pairs,words](uint64_t a, uint64_t b) -> bool
+                             {
+                                 return key_at(words, pairs[2*a]).compare(key_at(words, pairs[2*b])) < 0;
+                             });
+            end_container(f, count, table);
+            return true;
+        }
+
+        bool visit_begin_array(semantic_tag tag, const ser_context&, std::error_code&) override
+        {
+            begin_container(json_type::array_value, tag);
+            return true;
+        }
+
+        bool visit_end_array(const ser_context&, std::error_code&) override
+        {
+            JSONCONS_ASSERT(!stack_.empty() && !stack_.back().is_object);
+            const frame& f = stack_.back();
+            std::size_t count = children_.size() - f.first_child;
+            std::size_t table = tape_.size();
+            tape_.insert(tape_.end(), children_.begin() + f.first_child, children_.end());
+            end_container(f, count, table);
+            return true;
+        }
+
+        bool visit_key(const string_view_type& name, const ser_context&, std::error_code&) override
+        {
+            children_.push_back(tape_.size());
+            append_chars(name.data(), name.size(), semantic_tag::none);
+            return true;
+        }
+
+        bool visit_null(semantic_tag tag, const ser_context&, std::error_code&) override
+        {
+            begin_value();
+            tape_.push_back(tape::header(json_type::null_value, tag, 0));
+            end_value();
+            return true;
+        }
+
+        bool visit_bool(bool value, semantic_tag tag, const ser_context&, std::error_code&) override
+        {
+            begin_value();
+            tape_.push_back(tape::header(json_type::bool_value, tag, value ? 1 : 0));
+            end_value();
+            return true;
+        }
+
+        bool visit_string(const string_view_type& value, semantic_tag tag, const ser_context&, std::error_code&) override
+        {
+            begin_value();
+            append_chars(value.data(), value.size(), tag);
+            end_value();
+            return true;
+        }
+
+        bool visit_byte_string(const byte_string_view& value, semantic_tag tag, const ser_context&, std::error_code&) override
+        {
+            begin_value();
+            append_bytes(value, tag, 0);
+            end_value();
+            return true;
+        }
+
+        bool visit_byte_string(const byte_string_view& value, uint64_t ext_tag, const ser_context&, std::error_code&) override
+        {
+            begin_value();
+            append_bytes(value, semantic_tag::ext, ext_tag);
+            end_value();
+            return true;
+        }
+
+        bool visit_uint64(uint64_t value, semantic_tag tag, const ser_context&, std::error_code&) override
+        {
+            begin_value();
+            tape_.push_back(tape::header(json_type::uint64_value, tag, 0));
+            tape_.push_back(value);
+            end_value();
+            return true;
+        }
+
+        bool visit_int64(int64_t value, semantic_tag tag, const ser_context&, std::error_code&) override
+        {
+            begin_value();
+            tape_.push_back(tape::header(json_type::int64_value, tag, 0));
+            tape_.push_back(static_cast<uint64_t>(value));
+            end_value();
+            return true;
+        }
+
+        bool visit_double(double value, semantic_tag tag, const ser_context&, std::error_code&) override
+        {
+            begin_value();
+            uint64_t bits;
+            std::memcpy(&bits, &value, sizeof(bits));
+            tape_.push_back(tape::header(json_type::double_value, tag, 0));
+            tape_.push_back(bits);
+            end_value();
+            return true;
+        }
+
+        void begin_value()
+        {
+            if (stack_.empty())
+            {
+                tape_.clear();
+                children_.clear();
+                is_valid_ = false;
+            }
+            else
+            {
+                children_.push_back(tape_.size());
+            }
+        }
+
+        void end_value()
+        {
+            if (stack_.empty())
+            {
+                is_valid_ = true;
+            }
+        }
+
+        void begin_container(json_type type, semantic_tag tag)
+        {
+            begin_value();
+            stack_.push_back(frame{tape_.size(), children_.size(), type == json_type::object_value});
+            tape_.push_back(tape::header(type, tag, 0));
+            tape_.push_back(0);
+        }
+
+        void end_container(const frame& f, std::size_t count, std::size_t table)
+        {
+            tape_[f.header] |= static_cast<uint64_t>(count);
+            tape_[f.header + 1] = table;
+            children_.resize(f.first_child);
+            stack_.pop_back();
+            end_value();
+        }
+
+        void append_chars(const char_type* data, std::size_t length, semantic_tag tag)
+        {
+            std::size_t pos = tape_.size();
+            tape_.push_back(tape::header(json_type::string_value, tag, length));
+            tape_.resize(pos + 1 + tape::words_for(length*sizeof(char_type)), 0);
+            if (length > 0)
+            {
+                std::memcpy(tape_.data() + pos + 1, data, length*sizeof(char_type));
+            }
+        }
+
+        void append_bytes(const byte_string_view& value, semantic_tag tag, uint64_t ext_tag)
+        {
+            std::size_t pos = tape_.size();
+            tape_.push_back(tape::header(json_type::byte_string_value, tag, value.size()));
+            tape_.push_back(ext_tag);
+            tape_.resize(pos + 2 + tape::words_for(value.size()), 0);
+            if (value.size() > 0)
+            {
+                std::memcpy(tape_.data() + pos + 2, value.data(), value.size());
+            }
+        }
+
+        static string_view_type key_at(const uint64_t* words, uint64_t pos)
+        {
+            return string_view_type(reinterpret_cast<const char_type*>(words + pos + 1), tape::payload(words[pos]));
+        }
+    };
+
+    // basic_frozen_json_view is a read-only reference to a value in a frozen document.
+    // It is valid as long as the document is.
+
+    template <class CharT>
+    class basic_frozen_json_view
+    {
+    public:
+        using char_type = CharT;
+        using string_view_type = jsoncons::basic_string_view<char_type>;
+        using string_type = std::basic_string<char_type>;
+
+        class member
+        {
+            friend class basic_frozen_json_view;
+
+            const uint64_t* words_;
+            std::size_t key_pos_;
+            std::size_t value_pos_;
+        public:
+            member()
+                : words_(nullptr), key_pos_(0), value_pos_(0)
+            {
+            }
+
+            member(const uint64_t* words, std::size_t key_pos, std::size_t value_pos)
+                : words_(words), key_pos_(key_pos), value_pos_(value_pos)
+            {
+            }
+
+            string_view_type key() const
+            {
+                return basic_frozen_json_view(words_, key_pos_).as_string_view();
+            }
+
+            basic_frozen_json_view value() const
+            {
+                return basic_frozen_json_view(words_, value_pos_);
+            }
+        };
+
+        class object_iterator
+        {
+            friend class basic_frozen_json_view;
+
+            const uint64_t* words_;
+            const uint64_t* pairs_;
+            std::size_t index_;
+            mutable member current_;
+
+            object_iterator(const uint64_t* words, const uint64_t* pairs, std::size_t index)
+                : words_(words), pairs_(pairs), index_(index)
+            {
+            }
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = member;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const member*;
+            using reference = const member&;
+
+            object_iterator()
+                : words_(nullptr), pairs_(nullptr), index_(0)
+            {
+            }
+
+            reference operator*() const
+            {
+                current_ = member(words_, static_cast<std::size_t>(pairs_[2*index_]), static_cast<std::size_t>(pairs_[2*index_+1]));
+                return current_;
+            }
+
+            pointer operator->() const
+            {
+                return &(**this);
+            }
+
+            object_iterator& operator++()
+            {
+                ++index_;
+                return *this;
+            }
+
+            object_iterator operator++(int)
+            {
+                object_iterator temp(*this);
+                ++index_;
+                return temp;
+            }
+
+            friend bool operator==(const object_iterator& lhs, const object_iterator& rhs)
+            {
+                return lhs.pairs_ == rhs.pairs_ && lhs.index_ == rhs.index_;
+            }
+
+            friend bool operator!=(const object_iterator& lhs, const object_iterator& rhs)
+            {
+                return !(lhs == rhs);
+            }
+        };
+
+        class array_iterator
+        {
+            friend class basic_frozen_json_view;
+
+            const uint64_t* words_;
+            const uint64_t* positions_;
+            std::size_t index_;
+            mutable basic_frozen_json_view current_;
+
+            array_iterator(const uint64_t* words, const uint64_t* positions, std::size_t index)
+                : words_(words), positions_(positions), index_(index)
+            {
+            }
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = basic_frozen_json_view;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const basic_frozen_json_view*;
+            using reference = const basic_frozen_json_view&;
+
+            array_iterator()
+                : words_(nullptr), positions_(nullptr), index_(0)
+            {
+            }
+
+            reference operator*() const
+            {
+                current_ = basic_frozen_json_view(words_, static_cast<std::size_t>(positions_[index_]));
+                return current_;
+            }
+
+            pointer operator->() const
+            {
+                return &(**this);
+            }
+
+            array_iterator& operator++()
+            {
+                ++index_;
+                return *this;
+            }
+
+            array_iterator operator++(int)
+            {
+                array_iterator temp(*this);
+                ++index_;
+                return temp;
+            }
+
+            friend bool operator==(const array_iterator& lhs, const array_iterator& rhs)
+            {
+                return lhs.positions_ == rhs.positions_ && lhs.index_ == rhs.index_;
+            }
+
+            friend bool operator!=(const array_iterator& lhs, const array_iterator& rhs)
+            {
+                return !(lhs == rhs);
+            }
+        };
+
+        using object_range_type = range<object_iterator,object_iterator>;
+        using array_range_type = range<array_iterator,array_iterator>;
+    private:
+        using tape = jsoncons::detail::frozen_tape;
+
+        const uint64_t* words_;
+        std::size_t pos_;
+    public:
+        basic_frozen_json_view() noexcept
+            : words_(nullptr), pos_(0)
+        {
+        }
+
+        basic_frozen_json_view(const uint64_t* words, std::size_t pos) noexcept
+            : words_(words), pos_(pos)
+        {
+        }
+
+        json_type type() const noexcept
+        {
+            return tape::type(header());
+        }
+
+        semantic_tag tag() const noexcept
+        {
+            return tape::tag(header());
+        }
+
+        bool is_null() const noexcept
+        {
+            return type() == json_type::null_value;
+        }
+
+        bool is_bool() const noexcept
+        {
+            return type() == json_type::bool_value;
+        }
+
+        bool is_int64() const noexcept
+        {
+            return type() == json_type::int64_value;
+        }
+
+        bool is_uint64() const noexcept
+        {
+            return type() == json_type::uint64_value;
+        }
+
+        bool is_double() const noexcept
+        {
+            return type() == json_type::double_value;
+        }
+
+        bool is_number() const noexcept
+        {
+            switch (type())
+            {
+                case json_type::int64_value:
+                case json_type::uint64_value:
+                case json_type::double_value:
+                    return true;
+                default:
+                    return false;
+            }
+        }
+
+        bool is_string() const noexcept
+        {
+            return type() == json_type::string_value;
+        }
+
+        bool is_byte_string() const noexcept
+        {
+            return type() == json_type::byte_string_value;
+        }
+
+        bool is_array() const noexcept
+        {
+            return type() == json_type::array_value;
+        }
+
+        bool is_object() const noexcept
+        {
+            return type() == json_type::object_value;
+        }
+
+        std::size_t size() const noexcept
+        {
+            switch (type())
+            {
+                case json_type::array_value:
+                case json_type::object_value:
+                    return tape::payload(header());
+                default:
+                    return 0;
+            }
+        }
+
+        bool empty() const noexcept
+        {
+            switch (type())
+            {
+                case json_type::string_value:
+                case json_type::byte_string_value:
+                case json_type::array_value:
+                case json_type::object_value:
+                    return tape::payload(header()) == 0;
+                default:
+                    return false;
+            }
+        }
+
+        bool contains(const string_view_type& name) const noexcept
+        {
+            return is_object() && find_member(name) < size();
+        }
+
+        object_iterator find(const string_view_type& name) const
+        {
+            if (!is_object())
+            {
+                JSONCONS_THROW(not_an_object(name.data(),name.length()));
+            }
+            return object_iterator(words_, table(), find_member(name));
+        }
+
+        basic_frozen_json_view at(const string_view_type& name) const
+        {
+            if (!is_object())
+            {
+                JSONCONS_THROW(not_an_object(name.data(),name.length()));
+            }
+            std::size_t i = find_member(name);
+            if (i == size())
+            {
+                JSONCONS_THROW(key_not_found(name.data(),name.length()));
+            }
+            return basic_frozen_json_view(words_, static_cast<std::size_t>(table()[2*i+1]));
+        }
+
+        basic_frozen_json_view at(std::size_t i) const
+        {
+            if (!is_array())
+            {
+                JSONCONS_THROW(json_runtime_error<std::domain_error>("Index on non-array value not supported"));
+            }
+            if (i >= size())
+            {
+                JSONCONS_THROW(json_runtime_error<std::out_of_range>("Invalid array subscript"));
+            }
+            return basic_frozen_json_view(words_, static_cast<std::size_t>(table()[i]));
+        }
+
+        basic_frozen_json_view operator[](const string_view_type& name) const
+        {
+            return at(name);
+        }
+
+        basic_frozen_json_view operator[](std::size_t i) const
+        {
+            return at(i);
+        }
+
+        object_range_type object_range() const
+        {
+            if (!is_object())
+            {
+                JSONCONS_THROW(json_runtime_error<std::domain_error>("Not an object"));
+            }
+            return object_range_type(object_iterator(words_, table(), 0), object_iterator(words_, table(), size()));
+        }
+
+        array_range_type array_range() const
+        {
+            if (!is_array())
+            {
+                JSONCONS_THROW(json_runtime_error<std::domain_error>("Not an array"));
+            }
+            return array_range_type(array_iterator(words_, table(), 0), array_iterator(words_, table(), size()));
+        }
+
+        bool as_bool() const
+        {
+            switch (type())
+            {
+                case json_type::bool_value:
+                    return tape::payload(header()) != 0;
+                case json_type::int64_value:
+                case json_type::uint64_value:
+                    return words_[pos_+1] != 0;
+                default:
+                    JSONCONS_THROW(json_runtime_error<std::domain_error>("Not a bool"));
+            }
+        }
+
+        template <class IntegerType>
+        IntegerType as_integer() const
+        {
+            switch (type())
+            {
+                case json_type::string_value:
+                {
+                    auto result = jsoncons::detail::to_integer<IntegerType>(as_string_view().data(), as_string_view().length());
+                    if (!result)
+                    {
+                        JSONCONS_THROW(json_runtime_error<std::runtime_error>(result.error_code().message()));
+                    }
+                    return result.value();
+                }
+                case json_type::double_value:
+                    return static_cast<IntegerType>(double_value());
+                case json_type::int64_value:
+                    return static_cast<IntegerType>(static_cast<int64_t>(words_[pos_+1]));
+                case json_type::uint64_value:
+                    return static_cast<IntegerType>(words_[pos_+1]);
+                case json_type::bool_value:
+                    return static_cast<IntegerType>(tape::payload(header()) != 0 ? 1 : 0);
+                default:
+                    JSONCONS_THROW(json_runtime_error<std::domain_error>("Not an integer"));
+            }
+        }
+
+        double as_double() const
+        {
+            switch (type())
+            {
+                case json_type::string_value:
+                {
+                    jsoncons::detail::to_double_t to_double;
+                    string_type s(as_string_view());
+                    return to_double(s.c_str(), s.length());
+                }
+                case json_type::double_value:
+                    return double_value();
+                case json_type::int64_value:
+                    return static_cast<double>(static_cast<int64_t>(words_[pos_+1]));
+                case json_type::uint64_value:
+                    return static_cast<double>(words_[pos_+1]);
+                default:
+                    JSONCONS_THROW(json_runtime_error<std::invalid_argument>("Not a double"));
+            }
+        }
+
+        string_view_type as_string_view() const
+        {
+            if (!is_string())
+            {
+                JSONCONS_THROW(json_runtime_error<std::domain_error>("Not a string"));
+            }
+            return string_view_type(reinterpret_cast<const char_type*>(words_ + pos_ + 1), tape::payload(header()));
+        }
+
+        byte_string_view as_byte_string_view() const
+        {
+            if (!is_byte_string())
+            {
+                JSONCONS_THROW(json_runtime_error<std::domain_error>("Not a byte string"));
+            }
+            return byte_string_view(reinterpret_cast<const uint8_t*>(words_ + pos_ + 2), tape::payload(header()));
+        }
+
+        string_type as_string() const
+        {
+            if (is_string())
+            {
+                return string_type(as_string_view());
+            }
+            return to_json<basic_json<char_type>>().as_string();
+        }
+
+        // Types without a direct accessor are converted through basic_json
+
+        template <class T>
+        typename std::enable_if<std::is_same<T,bool>::value,T>::type
+        as() const
+        {
+            return as_bool();
+        }
+
+        template <class T>
+        typename std::enable_if<!std::is_same<T,bool>::value && std::is_integral<T>::value,T>::type
+        as() const
+        {
+            return as_integer<T>();
+        }
+
+        template <class T>
+        typename std::enable_if<std::is_floating_point<T>::value,T>::type
+        as() const
+        {
+            return static_cast<T>(as_double());
+        }
+
+        template <class T>
+        typename std::enable_if<std::is_same<T,string_view_type>::value,T>::type
+        as() const
+        {
+            return as_string_view();
+        }
+
+        template <class T>
+        typename std::enable_if<std::is_same<T,string_type>::value,T>::type
+        as() const
+        {
+            return as_string();
+        }
+
+        template <class T>
+        typename std::enable_if<!std::is_integral<T>::value && !std::is_floating_point<T>::value &&
+                                !std::is_same<T,string_view_type>::value && !std::is_same<T,string_type>::value,T>::type
+        as() const
+        {
+            return to_json<basic_json<char_type>>().template as<T>();
+        }
+
+        template <class Json>
+        Json to_json() const
+        {
+            json_decoder<Json> decoder;
+            dump(decoder);
+            return decoder.get_result();
+        }
+
+        void dump(basic_json_visitor<char_type>& visitor) const
+        {
+            std::error_code ec;
+            dump(visitor, ec);
+            if (ec)
+            {
+                JSONCONS_THROW(ser_error(ec));
+            }
+        }
+
+        void dump(basic_json_visitor<char_type>& visitor, std::error_code& ec) const
+        {
+            dump_noflush(visitor, ec);
+            visitor.flush();
+        }
+
+        void dump(std::basic_string<char_type>& s) const
+        {
+            basic_compact_json_encoder<char_type,jsoncons::string_sink<std::basic_string<char_type>>> encoder(s);
+            dump(encoder);
+        }
+
+        void dump(std::basic_ostream<char_type>& os) const
+        {
+            basic_compact_json_encoder<char_type> encoder(os);
+            dump(encoder);
+        }
+
+        friend bool operator==(const basic_frozen_json_view& lhs, const basic_frozen_json_view& rhs) noexcept
+        {
+            return lhs.words_ == rhs.words_ && lhs.pos_ == rhs.pos_;
+        }
+
+        friend bool operator!=(const basic_frozen_json_view& lhs, const basic_frozen_json_view& rhs) noexcept
+        {
+            return !(lhs == rhs);
+        }
+    protected:
+        void reset(const uint64_t* words) noexcept
+        {
+            words_ = words;
+            pos_ = 0;
+        }
+    private:
+        uint64_t header() const noexcept
+        {
+            return words_[pos_];
+        }
+
+        const uint64_t* table() const noexcept
+        {
+            return words_ + words_[pos_+1];
+        }
+
+        double double_value() const noexcept
+        {
+            double value;
+            std::memcpy(&value, words_ + pos_ + 1, sizeof(value));
+            return value;
+        }
+
+        // Returns the number of the member with the name in document order, or size()
+        std::size_t find_member(const string_view_type& name) const noexcept
+        {
+            std::size_t count = size();
+            const uint64_t* pairs = table();
+            const uint64_t* first = pairs + 2*count;
+            const uint64_t* last = first + count;
+            const uint64_t* words = words_;
+            auto it = std::lower_bound(first, last, name,
+                                       [pairs,words](uint64_t i, const string_view_type& k) -> bool
+                                       {
+                                           return basic_frozen_json_view(words, static_cast<std::size_t>(pairs[2*i])).as_string_view().compare(k) < 0;
+                                       });
+            if (it != last && basic_frozen_json_view(words, static_cast<std::size_t>(pairs[2*(*it)])).as_string_view() == name)
+            {
+                return static_cast<std::size_t>(*it);
+            }
+            return count;
+        }
+
+        bool dump_noflush(basic_json_visitor<char_type>& visitor, std::error_code& ec) const
+        {
+            const ser_context context{};
+            switch (type())
+            {
+                case json_type::null_value:
+                    return visitor.null_value(tag(), context, ec);
+                case json_type::bool_value:
+                    return visitor.bool_value(tape::payload(header()) != 0, tag(), context, ec);
+                case json_type::int64_value:
+                    return visitor.int64_value(static_cast<int64_t>(words_[pos_+1]), tag(), context, ec);
+                case json_type::uint64_value:
+                    return visitor.uint64_value(words_[pos_+1], tag(), context, ec);
+                case json_type::double_value:
+                    return visitor.double_value(double_value(), tag(), context, ec);
+                case json_type::string_value:
+                    return visitor.string_value(as_string_view(), tag(), context, ec);
+                case json_type::byte_string_value:
+                    if (tag() == semantic_tag::ext)
+                    {
+                        return visitor.byte_string_value(as_byte_string_view(), words_[pos_+1], context, ec);
+                    }
+                    return visitor.byte_string_value(as_byte_string_view(), tag(), context, ec);
+                case json_type::array_value:
+                {
+                    bool more = visitor.begin_array(size(), tag(), context, ec);
+                    for (std::size_t i = 0; more && i < size(); ++i)
+                    {
+                        more = basic_frozen_json_view(words_, static_cast<std::size_t>(table()[i])).dump_noflush(visitor, ec);
+                    }
+                    if (more)
+                    {
+                        more = visitor.end_array(context, ec);
+                    }
+                    return more;
+                }
+                case json_type::object_value:
+                {
+                    bool more = visitor.begin_object(size(), tag(), context, ec);
+                    const uint64_t* pairs = table();
+                    for (std::size_t i = 0; more && i < size(); ++i)
+                    {
+                        more = visitor.key(basic_frozen_json_view(words_, static_cast<std::size_t>(pairs[2*i])).as_string_view(), context, ec);
+                        if (more)
+                        {
+                            more = basic_frozen_json_view(words_, static_cast<std::size_t>(pairs[2*i+1])).dump_noflush(visitor, ec);
+                        }
+                    }
+                    if (more)
+                    {
+                        more = visitor.end_object(context, ec);
+                    }
+                    return more;
+                }
+                default:
+                    return true;
+            }
+        }
+    };
+
+    // basic_frozen_json is an immutable document packed into one contiguous buffer.
+    // It offers the read-only part of the basic_json interface, through its root view.
+
+    template <class CharT,class Allocator=std::allocator<char>>
+    class basic_frozen_json : public basic_frozen_json_view<CharT>
+    {
+    public:
+        using char_type = CharT;
+        using allocator_type = Allocator;
+        using view_type = basic_frozen_json_view<CharT>;
+        using string_view_type = typename view_type::string_view_type;
+        using builder_type = basic_frozen_json_builder<CharT,Allocator>;
+    private:
+        using word_allocator_type = typename builder_type::word_allocator_type;
+        using tape_type = typename builder_type::tape_type;
+
+        tape_type words_;
+    public:
+        // Constructs a frozen null value
+        basic_frozen_json(const allocator_type& alloc = allocator_type())
+            : words_(1, jsoncons::detail::frozen_tape::header(json_type::null_value, semantic_tag::none, 0), word_allocator_type(alloc))
+        {
+            this->reset(words_.data());
+        }
+
+        template <class Json>
+        explicit basic_frozen_json(const Json& j, const allocator_type& alloc = allocator_type(),
+                                   typename std::enable_if<is_basic_json<Json>::value,int>::type = 0)
+            : words_(word_allocator_type(alloc))
+        {
+            builder_type builder(alloc);
+            j.dump(builder);
+            words_ = builder.get_result();
+            this->reset(words_.data());
+        }
+
+        explicit basic_frozen_json(builder_type& builder)
+            : words_(builder.get_result())
+        {
+            this->reset(words_.data());
+        }
+
+        basic_frozen_json(const basic_frozen_json& other)
+            : view_type(), words_(other.words_)
+        {
+            this->reset(words_.data());
+        }
+
+        basic_frozen_json(basic_frozen_json&& other) noexcept
+            : view_type(), words_(std::move(other.words_))
+        {
+            this->reset(words_.data());
+            other.words_.clear();
+            other.reset(nullptr);
+        }
+
+        basic_frozen_json& operator=(const basic_frozen_json& other)
+        {
+            if (this != &other)
+            {
+                words_ = other.words_;
+                this->reset(words_.data());
+            }
+            return *this;
+        }
+
+        basic_frozen_json& operator=(basic_frozen_json&& other) noexcept
+        {
+            if (this != &other)
+            {
+                words_.swap(other.words_);
+                this->reset(words_.data());
+                other.reset(other.words_.empty() ? nullptr : other.words_.data());
+            }
+            return *this;
+        }
+
+        static basic_frozen_json parse(const string_view_type& s,
+                                       const basic_json_decode_options<char_type>& options = basic_json_decode_options<char_type>(),
+                                       std::function<bool(json_errc,const ser_context&)> err_handler = default_json_parsing())
+        {
+            builder_type builder;
+            basic_json_reader<char_type,string_source<char_type>> reader(s, builder, options, err_handler);
+            reader.read_next();
+            reader.check_done();
+            if (!builder.is_valid())
+            {
+                JSONCONS_THROW(json_runtime_error<std::runtime_error>("Failed to parse json string"));
+            }
+            return basic_frozen_json(builder);
+        }
+
+        static basic_frozen_json parse(std::basic_istream<char_type>& is,
+                                       const basic_json_decode_options<char_type>& options = basic_json_decode_options<char_type>(),
+                                       std::function<bool(json_errc,const ser_context&)> err_handler = default_json_parsing())
+        {
+            builder_type builder;
+            basic_json_reader<char_type,stream_source<char_type>> reader(is, builder, options, err_handler);
+            reader.read_next();
+            reader.check_done();
+            if (!builder.is_valid())
+            {
+                JSONCONS_THROW(json_runtime_error<std::runtime_error>("Failed to parse json stream"));
+            }
+            return basic_frozen_json(builder);
+        }
+
+        view_type root() const noexcept
+        {
+            return *this;
+        }
+
+        // Size of the buffer in bytes
+        std::size_t buffer_size() const noexcept
+        {
+            return words_.size()*sizeof(uint64_t);
+        }
+
+        allocator_type get_allocator() const
+        {
+            return words_.get_allocator();
+        }
+    };
+
+    using frozen_json = basic_frozen_json<char>;
+    using wfrozen_json = basic_frozen_json<wchar_t>;
+
+} // namespace jsoncons
+
+#endif // JSONCONS_FROZEN_JSON_HPP
@@ -21,6 +21,7 @@
 #include <type_traits> // std::enable_if
 #include <jsoncons/json_exception.hpp>
 #include <jsoncons/allocator_holder.hpp>
+#include <jsoncons/detail/member_index.hpp>
 
 namespace jsoncons {
 
@@ -83,8 +84,9 @@ namespace jsoncons {
         }
         json_array(const json_array& val, const allocator_type& alloc)
             : allocator_holder<allocator_type>(alloc), 
-              elements_(val.elements_,value_allocator_type(alloc))
+              elements_(value_allocator_type(alloc))
         {
+            copy_elements(val, alloc);
         }
 
         json_array(json_array&& val) noexcept
@@ -94,8 +96,16 @@ namespace jsoncons {
         }
         json_array(json_array&& val, const allocator_type& alloc)
             : allocator_holder<allocator_type>(alloc), 
-              elements_(std::move(val.elements_),value_allocator_type(alloc))
+              elements_(value_allocator_type(alloc))
         {
+            if (val.get_allocator() == alloc)
+            {
+                elements_ = std::move(val.elements_);
+            }
+            else
+            {
+                copy_elements(val, alloc);
+            }
         }
 
         json_array(const std::initializer_list<Json>& init, 
@@ -280,6 +290,17 @@ namespace jsoncons {
 
         json_array& operator=(const json_array<Json>&) = delete;
 
+        // Copies the elements into alloc all the way down, a plain copy 
+        // of an element would keep the allocator of the element
+        void copy_elements(const json_array& val, const allocator_type& alloc)
+        {
+            elements_.reserve(val.elements_.size());
+            for (const auto& item : val.elements_)
+            {
+                elements_.emplace_back(item, alloc);
+            }
+        }
+
         void destroy() noexcept
         {
             while (!elements_.empty())
@@ -324,6 +345,12 @@ namespace jsoncons {
         explicit sorted_unique_range_tag() = default; 
     };
 
+    // The members have unique keys, and a permutation that puts them in key order is supplied
+    struct unique_key_order_tag
+    {
+        explicit unique_key_order_tag() = default; 
+    };
+
     // json_object
 
     // key_value
@@ -384,6 +411,11 @@ namespace jsoncons {
         {
         }
 
+        key_value(const key_value& member, const allocator_type& alloc)
+            : key_(member.key_, alloc), value_(member.value_, alloc)
+        {
+        }
+
         const key_type& key() const
         {
             return key_;
@@ -520,6 +552,39 @@ namespace jsoncons {
         explicit preserve_key_order() = default; 
     };
 
+    // Selects a hash index over the object members, for policies that define key_index
+    struct hash_key_index
+    {
+        explicit hash_key_index() = default; 
+    };
+
+    template <class Policy,class Enable = void>
+    struct is_hash_key_indexed : std::false_type
+    {
+    };
+
+    template <class Policy>
+    struct is_hash_key_indexed<Policy,typename std::enable_if<std::is_same<typename Policy::key_index,hash_key_index>::value>::type> : std::true_type
+    {
+    };
+
+    // Selects reference counted array and object storage that is copied on first
+    // mutation, for policies that define container_sharing
+    struct copy_on_write_sharing
+    {
+        explicit copy_on_write_sharing() = default; 
+    };
+
+    template <class Policy,class Enable = void>
+    struct is_copy_on_write : std::false_type
+    {
+    };
+
+    template <class Policy>
+    struct is_copy_on_write<Policy,typename std::enable_if<std::is_same<typename Policy::container_sharing,copy_on_write_sharing>::value>::type> : std::true_type
+    {
+    };
+
     template <class KeyT,class Json,class Enable = void>
     class json_object
     {
@@ -527,7 +592,8 @@ namespace jsoncons {
 
     // Sort keys
     template <class KeyT,class Json>
-    class json_object<KeyT,Json,typename std::enable_if<std::is_same<typename Json::implementation_policy::key_order,sort_key_order>::value>::type> : 
+    class json_object<KeyT,Json,typename std::enable_if<std::is_same<typename Json::implementation_policy::key_order,sort_key_order>::value &&
+                                                        !is_hash_key_indexed<typename Json::implementation_policy>::value>::type> : 
         public allocator_holder<typename Json::allocator_type>
     {
     public:
@@ -573,13 +639,22 @@ namespace jsoncons {
 
         json_object(const json_object& val, const allocator_type& alloc) 
             : allocator_holder<allocator_type>(alloc), 
-              members_(val.members_,key_value_allocator_type(alloc))
+              members_(key_value_allocator_type(alloc))
         {
+            copy_members(val, alloc);
         }
 
         json_object(json_object&& val,const allocator_type& alloc) 
-            : allocator_holder<allocator_type>(alloc), members_(std::move(val.members_),key_value_allocator_type(alloc))
+            : allocator_holder<allocator_type>(alloc), members_(key_value_allocator_type(alloc))
         {
+            if (val.get_allocator() == alloc)
+            {
+                members_ = std::move(val.members_);
+            }
+            else
+            {
+                copy_members(val, alloc);
+            }
         }
 
         template<class InputIt>
@@ -758,6 +833,22 @@ namespace jsoncons {
             members_.erase(it, members_.end());
         }
 
+        template<class InputIt, class Convert>
+        void insert(unique_key_order_tag, InputIt first, InputIt last, const uint32_t* order, Convert convert)
+        {
+            if (!members_.empty())
+            {
+                insert(first, last, convert);
+                return;
+            }
+            std::size_t count = std::distance(first,last);
+            members_.reserve(count);
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                members_.emplace_back(convert(*(first + order[i])));
+            }
+        }
+
         template<class InputIt, class Convert>
         void insert(sorted_unique_range_tag, InputIt first, InputIt last, Convert convert)
         {
@@ -1187,6 +1278,15 @@ namespace jsoncons {
             return members_ < rhs.members_;
         }
     private:
+        // Copies the members into alloc all the way down
+        void copy_members(const json_object& val, const allocator_type& alloc)
+        {
+            members_.reserve(val.members_.size());
+            for (const auto& kv : val.members_)
+            {
+                members_.emplace_back(kv, alloc);
+            }
+        }
 
         void destroy() noexcept
         {
@@ -1209,7 +1309,8 @@ namespace jsoncons {
 
     // Preserve order
     template <class KeyT,class Json>
-    class json_object<KeyT,Json,typename std::enable_if<std::is_same<typename Json::implementation_policy::key_order,preserve_key_order>::value>::type> : 
+    class json_object<KeyT,Json,typename std::enable_if<std::is_same<typename Json::implementation_policy::key_order,preserve_key_order>::value &&
+                                                        !is_hash_key_indexed<typename Json::implementation_policy>::value>::type> : 
         public allocator_holder<typename Json::allocator_type>
     {
     public:
@@ -1260,16 +1361,27 @@ namespace jsoncons {
 
         json_object(const json_object& val, const allocator_type& alloc) 
             : allocator_holder<allocator_type>(alloc), 
-              members_(val.members_,key_value_allocator_type(alloc)),
+              members_(key_value_allocator_type(alloc)),
               index_(val.index_,index_allocator_type(alloc))
         {
+            copy_members(val, alloc);
         }
 
         json_object(json_object&& val,const allocator_type& alloc) 
             : allocator_holder<allocator_type>(alloc), 
-              members_(std::move(val.members_),key_value_allocator_type(alloc)),
-              index_(std::move(val.index_),index_allocator_type(alloc))
+              members_(key_value_allocator_type(alloc)),
+              index_(index_allocator_type(alloc))
         {
+            if (val.get_allocator() == alloc)
+            {
+                members_ = std::move(val.members_);
+                index_ = std::move(val.index_);
+            }
+            else
+            {
+                copy_members(val, alloc);
+                index_.assign(val.index_.begin(), val.index_.end());
+            }
         }
 
         template<class InputIt>
@@ -1530,6 +1642,23 @@ namespace jsoncons {
             build_index();
         }
 
+        template<class InputIt, class Convert>
+        void insert(unique_key_order_tag, InputIt first, InputIt last, const uint32_t* order, Convert convert)
+        {
+            if (!members_.empty())
+            {
+                insert(first, last, convert);
+                return;
+            }
+            std::size_t count = std::distance(first,last);
+            members_.reserve(count);
+            for (auto s = first; s != last; ++s)
+            {
+                members_.emplace_back(convert(*s));
+            }
+            index_.assign(order, order + count);
+        }
+
         template<class InputIt, class Convert>
         void insert(sorted_unique_range_tag, InputIt first, InputIt last, Convert convert)
         {
@@ -1879,6 +2008,15 @@ namespace jsoncons {
             return members_ < rhs.members_;
         }
     private:
+        // Copies the members into alloc all the way down
+        void copy_members(const json_object& val, const allocator_type& alloc)
+        {
+            members_.reserve(val.members_.size());
+            for (const auto& kv : val.members_)
+            {
+                members_.emplace_back(kv, alloc);
+            }
+        }
 
         void destroy() noexcept
         {
@@ -1981,6 +2119,606 @@ namespace jsoncons {
         json_object& operator=(const json_object&) = delete;
     };
 
+    // Hash indexed, in key order or insertion order
+    template <class KeyT,class Json>
+    class json_object<KeyT,Json,typename std::enable_if<is_hash_key_indexed<typename Json::implementation_policy>::value>::type> : 
+        public allocator_holder<typename Json::allocator_type>
+    {
+    public:
+        using allocator_type = typename Json::allocator_type;
+        using char_type = typename Json::char_type;
+        using key_type = KeyT;
+        using string_view_type = typename Json::string_view_type;
+        using key_value_type = key_value<KeyT,Json>;
+    private:
+        using implementation_policy = typename Json::implementation_policy;
+        using key_order = typename implementation_policy::key_order;
+        using key_value_allocator_type = typename std::allocator_traits<allocator_type>:: template rebind_alloc<key_value_type>;                       
+        using key_value_container_type = typename implementation_policy::template sequence_container_type<key_value_type,key_value_allocator_type>;
+        using index_type = jsoncons::detail::member_index<allocator_type>;
+
+        // Smaller objects are searched linearly and have no index
+        static constexpr std::size_t min_index_size = 8;
+
+        key_value_container_type members_;
+        index_type index_;
+    public:
+        using iterator = typename key_value_container_type::iterator;
+        using const_iterator = typename key_value_container_type::const_iterator;
+
+        using allocator_holder<allocator_type>::get_allocator;
+
+        json_object()
+        {
+        }
+
+        explicit json_object(const allocator_type& alloc)
+            : allocator_holder<allocator_type>(alloc), 
+              members_(key_value_allocator_type(alloc)), 
+              index_(alloc)
+        {
+        }
+
+        json_object(const json_object& val)
+            : allocator_holder<allocator_type>(val.get_allocator()), 
+              members_(val.members_),
+              index_(val.index_)
+        {
+        }
+
+        json_object(json_object&& val)
+            : allocator_holder<allocator_type>(val.get_allocator()), 
+              members_(std::move(val.members_)),
+              index_(std::move(val.index_))
+        {
+        }
+
+        json_object(const json_object& val, const allocator_type& alloc) 
+            : allocator_holder<allocator_type>(alloc), 
+              members_(key_value_allocator_type(alloc)),
+              index_(val.index_, alloc)
+        {
+            copy_members(val, alloc);
+        }
+
+        json_object(json_object&& val,const allocator_type& alloc) 
+            : allocator_holder<allocator_type>(alloc), 
+              members_(key_value_allocator_type(alloc)),
+              index_(alloc)
+        {
+            if (val.get_allocator() == alloc)
+            {
+                members_ = std::move(val.members_);
+                index_ = std::move(val.index_);
+            }
+            else
+            {
+                copy_members(val, alloc);
+                index_ = index_type(val.index_, alloc);
+            }
+        }
+
+        template<class InputIt>
+        json_object(InputIt first, InputIt last)
+        {
+            insert(first, last, get_key_value<KeyT,Json>());
+        }
+
+        template<class InputIt>
+        json_object(InputIt first, InputIt last, 
+                    const allocator_type& alloc)
+            : allocator_holder<allocator_type>(alloc), 
+              members_(key_value_allocator_type(alloc)), 
+              index_(alloc)
+        {
+            insert(first, last, get_key_value<KeyT,Json>());
+        }
+
+        json_object(std::initializer_list<std::pair<std::basic_string<char_type>,Json>> init, 
+                    const allocator_type& alloc = allocator_type())
+            : allocator_holder<allocator_type>(alloc), 
+              members_(key_value_allocator_type(alloc)), 
+              index_(alloc)
+        {
+            members_.reserve(init.size());
+            for (auto& item : init)
+            {
+                insert_or_assign(item.first, item.second);
+            }
+        }
+
+        ~json_object() noexcept
+        {
+            destroy();
+        }
+
+        void swap(json_object& val) noexcept
+        {
+            members_.swap(val.members_);
+            index_.swap(val.index_);
+        }
+
+        iterator begin()
+        {
+            return members_.begin();
+        }
+
+        iterator end()
+        {
+            return members_.end();
+        }
+
+        const_iterator begin() const
+        {
+            return members_.begin();
+        }
+
+        const_iterator end() const
+        {
+            return members_.end();
+        }
+
+        std::size_t size() const {return members_.size();}
+
+        std::size_t capacity() const {return members_.capacity();}
+
+        void clear() 
+        {
+            members_.clear();
+            index_.clear();
+        }
+
+        void shrink_to_fit() 
+        {
+            for (std::size_t i = 0; i < members_.size(); ++i)
+            {
+                members_[i].shrink_to_fit();
+            }
+            members_.shrink_to_fit();
+            index_ = index_type(get_allocator());
+            rebuild_index();
+        }
+
+        void reserve(std::size_t n) {members_.reserve(n);}
+
+        Json& at(std::size_t i) 
+        {
+            if (i >= members_.size())
+            {
+                JSONCONS_THROW(json_runtime_error<std::out_of_range>("Invalid array subscript"));
+            }
+            return members_[i].value();
+        }
+
+        const Json& at(std::size_t i) const 
+        {
+            if (i >= members_.size())
+            {
+                JSONCONS_THROW(json_runtime_error<std::out_of_range>("Invalid array subscript"));
+            }
+            return members_[i].value();
+        }
+
+        iterator find(const string_view_type& name) noexcept
+        {
+            return members_.begin() + find_position(name);
+        }
+
+        const_iterator find(const string_view_type& name) const noexcept
+        {
+            return members_.begin() + find_position(name);
+        }
+
+        void erase(const_iterator pos) 
+        {
+    #if defined(JSONCONS_NO_ERASE_TAKING_CONST_ITERATOR)
+            iterator it = members_.begin() + (pos - members_.begin());
+            members_.erase(it);
+    #else
+            members_.erase(pos);
+    #endif
+            rebuild_index();
+        }
+
+        void erase(const_iterator first, const_iterator last) 
+        {
+    #if defined(JSONCONS_NO_ERASE_TAKING_CONST_ITERATOR)
+            iterator it1 = members_.begin() + (first - members_.begin());
+            iterator it2 = members_.begin() + (last - members_.begin());
+            members_.erase(it1,it2);
+    #else
+            members_.erase(first,last);
+    #endif
+            rebuild_index();
+        }
+
+        void erase(const string_view_type& name) 
+        {
+            std::size_t pos = find_position(name);
+            if (pos < members_.size())
+            {
+                members_.erase(members_.begin() + pos);
+                rebuild_index();
+            }
+        }
+
+        template<class InputIt, class Convert>
+        void insert(InputIt first, InputIt last, Convert convert)
+        {
+            std::size_t count = std::distance(first,last);
+            members_.reserve(members_.size() + count);
+            for (auto s = first; s != last; ++s)
+            {
+                members_.emplace_back(convert(*s));
+            }
+            erase_duplicates(key_order());
+        }
+
+        template<class InputIt, class Convert>
+        void insert(unique_key_order_tag, InputIt first, InputIt last, const uint32_t* order, Convert convert)
+        {
+            if (!members_.empty())
+            {
+                insert(first, last, convert);
+                return;
+            }
+            std::size_t count = std::distance(first,last);
+            members_.reserve(count);
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                members_.emplace_back(convert(*(first + (is_sorted() ? order[i] : i))));
+            }
+            rebuild_index();
+        }
+
+        template<class InputIt, class Convert>
+        void insert(sorted_unique_range_tag, InputIt first, InputIt last, Convert convert)
+        {
+            if (!members_.empty())
+            {
+                insert(first, last, convert);
+                return;
+            }
+            std::size_t count = std::distance(first,last);
+            members_.reserve(count);
+            for (auto s = first; s != last; ++s)
+            {
+                members_.emplace_back(convert(*s));
+            }
+            rebuild_index();
+        }
+
+        // insert_or_assign
+
+        template <class T, class A=allocator_type>
+        typename std::enable_if<jsoncons::detail::is_stateless<A>::value,std::pair<iterator,bool>>::type
+        insert_or_assign(const string_view_type& name, T&& value)
+        {
+            std::size_t pos = find_position(name);
+            if (pos < members_.size())
+            {
+                members_[pos].value(Json(std::forward<T>(value)));
+                return std::make_pair(members_.begin() + pos, false);
+            }
+            return std::make_pair(emplace_member(insert_position(name, key_order()), name, std::forward<T>(value)), true);
+        }
+
+        template <class T, class A=allocator_type>
+        typename std::enable_if<!jsoncons::detail::is_stateless<A>::value,std::pair<iterator,bool>>::type
+        insert_or_assign(const string_view_type& name, T&& value)
+        {
+            std::size_t pos = find_position(name);
+            if (pos < members_.size())
+            {
+                members_[pos].value(Json(std::forward<T>(value), get_allocator()));
+                return std::make_pair(members_.begin() + pos, false);
+            }
+            return std::make_pair(emplace_member(insert_position(name, key_order()), name, std::forward<T>(value), get_allocator()), true);
+        }
+
+        template <class T, class A=allocator_type>
+        typename std::enable_if<jsoncons::detail::is_stateless<A>::value,iterator>::type 
+        insert_or_assign(iterator hint, const string_view_type& name, T&& value)
+        {
+            std::size_t pos = find_position(name);
+            if (pos < members_.size())
+            {
+                members_[pos].value(Json(std::forward<T>(value)));
+                return members_.begin() + pos;
+            }
+            return emplace_member(insert_position(hint, name, key_order()), name, std::forward<T>(value));
+        }
+
+        template <class T, class A=allocator_type>
+        typename std::enable_if<!jsoncons::detail::is_stateless<A>::value,iterator>::type 
+        insert_or_assign(iterator hint, const string_view_type& name, T&& value)
+        {
+            std::size_t pos = find_position(name);
+            if (pos < members_.size())
+            {
+                members_[pos].value(Json(std::forward<T>(value), get_allocator()));
+                return members_.begin() + pos;
+            }
+            return emplace_member(insert_position(hint, name, key_order()), name, std::forward<T>(value), get_allocator());
+        }
+
+        // try_emplace
+
+        template <class... Args>
+        std::pair<iterator,bool> try_emplace(const string_view_type& name, Args&&... args)
+        {
+            std::size_t pos = find_position(name);
+            if (pos < members_.size())
+            {
+                return std::make_pair(members_.begin() + pos, false);
+            }
+            return std::make_pair(emplace_member(insert_position(name, key_order()), name, std::forward<Args>(args)...), true);
+        }
+
+        template <class... Args>
+        iterator try_emplace(iterator hint, const string_view_type& name, Args&&... args)
+        {
+            std::size_t pos = find_position(name);
+            if (pos < members_.size())
+            {
+                return members_.begin() + pos;
+            }
+            return emplace_member(insert_position(hint, name, key_order()), name, std::forward<Args>(args)...);
+        }
+
+        // merge
+
+        void merge(const json_object& source)
+        {
+            for (auto it = source.begin(); it != source.end(); ++it)
+            {
+                try_emplace((*it).key(),(*it).value());
+            }
+        }
+
+        void merge(json_object&& source)
+        {
+            auto it = std::make_move_iterator(source.begin());
+            auto end = std::make_move_iterator(source.end());
+            for (; it != end; ++it)
+            {
+                try_emplace((*it).key(),std::move((*it).value()));
+            }
+        }
+
+        void merge(iterator hint, const json_object& source)
+        {
+            std::size_t pos = hint - members_.begin();
+            for (auto it = source.begin(); it != source.end(); ++it)
+            {
+                hint = try_emplace(hint, (*it).key(),(*it).value());
+                std::size_t newpos = hint - members_.begin();
+                if (newpos == pos)
+                {
+                    ++hint;
+                    pos = hint - members_.begin();
+                }
+                else
+                {
+                    hint = members_.begin() + pos;
+                }
+            }
+        }
+
+        void merge(iterator hint, json_object&& source)
+        {
+            std::size_t pos = hint - members_.begin();
+
+            auto it = std::make_move_iterator(source.begin());
+            auto end = std::make_move_iterator(source.end());
+            for (; it != end; ++it)
+            {
+                hint = try_emplace(hint, (*it).key(), std::move((*it).value()));
+                std::size_t newpos = hint - members_.begin();
+                if (newpos == pos)
+                {
+                    ++hint;
+                    pos = hint - members_.begin();
+                }
+                else
+                {
+                    hint = members_.begin() + pos;
+                }
+            }
+        }
+
+        // merge_or_update
+
+        void merge_or_update(const json_object& source)
+        {
+            for (auto it = source.begin(); it != source.end(); ++it)
+            {
+                insert_or_assign((*it).key(),(*it).value());
+            }
+        }
+
+        void merge_or_update(json_object&& source)
+        {
+            auto it = std::make_move_iterator(source.begin());
+            auto end = std::make_move_iterator(source.end());
+            for (; it != end; ++it)
+            {
+                insert_or_assign((*it).key(),std::move((*it).value()));
+            }
+        }
+
+        void merge_or_update(iterator hint, const json_object& source)
+        {
+            std::size_t pos = hint - members_.begin();
+            for (auto it = source.begin(); it != source.end(); ++it)
+            {
+                hint = insert_or_assign(hint, (*it).key(),(*it).value());
+                std::size_t newpos = hint - members_.begin();
+                if (newpos == pos)
+                {
+                    ++hint;
+                    pos = hint - members_.begin();
+                }
+                else
+                {
+                    hint = members_.begin() + pos;
+                }
+            }
+        }
+
+        void merge_or_update(iterator hint, json_object&& source)
+        {
+            std::size_t pos = hint - members_.begin();
+            auto it = std::make_move_iterator(source.begin());
+            auto end = std::make_move_iterator(source.end());
+            for (; it != end; ++it)
+            {
+                hint = insert_or_assign(hint, (*it).key(), std::move((*it).value()));
+                std::size_t newpos = hint - members_.begin();
+                if (newpos == pos)
+                {
+                    ++hint;
+                    pos = hint - members_.begin();
+                }
+                else
+                {
+                    hint = members_.begin() + pos;
+                }
+            }
+        }
+
+        bool operator==(const json_object& rhs) const
+        {
+            return members_ == rhs.members_;
+        }
+     
+        bool operator<(const json_object& rhs) const
+        {
+            return members_ < rhs.members_;
+        }
+    private:
+        static constexpr bool is_sorted()
+        {
+            return std::is_same<key_order,sort_key_order>::value;
+        }
+
+        // Copies the members into alloc all the way down
+        void copy_members(const json_object& val, const allocator_type& alloc)
+        {
+            members_.reserve(val.members_.size());
+            for (const auto& kv : val.members_)
+            {
+                members_.emplace_back(kv, alloc);
+            }
+        }
+
+        void destroy() noexcept
+        {
+            if (!members_.empty())
+            {
+                json_array<Json> temp(get_allocator());
+
+                for (auto&& kv : members_)
+                {
+                    if (kv.value().size() > 0)
+                    {
+                        temp.emplace_back(std::move(kv.value()));
+                    }
+                }
+            }
+        }
+
+        std::size_t find_position(const string_view_type& name) const noexcept
+        {
+            if (!index_.empty())
+            {
+                return index_.find(members_, name.data(), name.size());
+            }
+            for (std::size_t i = 0; i < members_.size(); ++i)
+            {
+                if (members_[i].key() == name)
+                {
+                    return i;
+                }
+            }
+            return members_.size();
+        }
+
+        std::size_t insert_position(const string_view_type& name, sort_key_order) const
+        {
+            auto it = std::lower_bound(members_.begin(),members_.end(), name, 
+                                       [](const key_value_type& a, const string_view_type& k) -> bool {return string_view_type(a.key()).compare(k) < 0;});        
+            return it - members_.begin();
+        }
+
+        std::size_t insert_position(const string_view_type&, preserve_key_order) const
+        {
+            return members_.size();
+        }
+
+        std::size_t insert_position(iterator, const string_view_type& name, sort_key_order) const
+        {
+            return insert_position(name, sort_key_order());
+        }
+
+        std::size_t insert_position(iterator hint, const string_view_type&, preserve_key_order) const
+        {
+            return hint - members_.begin();
+        }
+
+        // Inserts a member with a key that is not present, and indexes it
+        template <class... Args>
+        iterator emplace_member(std::size_t pos, const string_view_type& name, Args&&... args)
+        {
+            members_.emplace(members_.begin() + pos, 
+                             key_type(name.begin(),name.end(), get_allocator()), 
+                             std::forward<Args>(args)...);
+            if (!index_.empty())
+            {
+                index_.insert(members_, pos);
+            }
+            else if (members_.size() >= min_index_size)
+            {
+                index_.build(members_);
+            }
+            return members_.begin() + pos;
+        }
+
+        void rebuild_index()
+        {
+            if (members_.size() >= min_index_size)
+            {
+                index_.build(members_);
+            }
+            else
+            {
+                index_.clear();
+            }
+        }
+
+        // Keeps the first of members with the same key
+        void erase_duplicates(sort_key_order)
+        {
+            std::stable_sort(members_.begin(),members_.end(),
+                             [](const key_value_type& a, const key_value_type& b) -> bool {return a.key().compare(b.key()) < 0;});
+            auto it = std::unique(members_.begin(), members_.end(),
+                                  [](const key_value_type& a, const key_value_type& b) -> bool { return !(a.key().compare(b.key()));});
+            members_.erase(it, members_.end());
+            rebuild_index();
+        }
+
+        void erase_duplicates(preserve_key_order)
+        {
+            index_.build_unique(members_);
+            if (members_.size() < min_index_size)
+            {
+                index_.clear();
+            }
+        }
+
+        json_object& operator=(const json_object&) = delete;
+    };
+
 } // namespace jsoncons
 
 #endif
@@ -14,6 +14,7 @@
 #include <system_error>
 #include <ios>
 #include <istream> // std::basic_istream
+#include <utility> // std::forward
 #include <jsoncons/byte_string.hpp>
 #include <jsoncons/config/jsoncons_config.hpp>
 #include <jsoncons/json_visitor.hpp>
@@ -58,7 +59,7 @@ public:
                       std::function<bool(json_errc,const ser_context&)> err_handler = default_json_parsing(),
                       const Allocator& alloc = Allocator(),
                       typename std::enable_if<!std::is_constructible<jsoncons::basic_string_view<CharT>,Source>::value>::type* = 0)
-       : source_(source),
+       : source_(std::forward<Source>(source)),
          parser_(options,err_handler,alloc),
          cursor_visitor_(accept_all),
          buffer_(alloc),
@@ -145,7 +146,7 @@ public:
                       std::function<bool(json_errc,const ser_context&)> err_handler,
                       std::error_code& ec,
                       typename std::enable_if<!std::is_constructible<jsoncons::basic_string_view<CharT>,Source>::value>::type* = 0)
-       : source_(source),
+       : source_(std::forward<Source>(source)),
          parser_(options,err_handler,alloc),
          cursor_visitor_(accept_all),
          buffer_(alloc),
@@ -244,8 +245,111 @@ public:
         read_next(ec);
     }
 
+    using basic_staj_cursor<CharT>::next_batch;
+
+    // Strings that the parser reads in place from a string or memory mapped input are 
+    // referred to by the batch, not copied. Strings in buffer_ are copied before it is refilled.
+    void next_batch(basic_staj_event_batch<CharT>& batch, std::error_code& ec) override
+    {
+        batch.clear();
+        if (done())
+        {
+            return;
+        }
+        auto input = parser_.input();
+        batch.borrow(input.data(), input.data()+input.size());
+        batch.push_back(current());
+        {
+            // The parser stops when the batch is full or at the end of the input
+            jsoncons::detail::staj_batch_guard<CharT> guard(cursor_visitor_, batch);
+            read_next(ec);
+        }
+        if (parsing_buffer())
+        {
+            batch.copy_borrowed();
+        }
+    }
+
+    void skip() override
+    {
+        std::error_code ec;
+        skip(ec);
+        if (ec)
+        {
+            JSONCONS_THROW(ser_error(ec,parser_.line(),parser_.column()));
+        }
+    }
+
+    // Passes over the contents of an object or array by matching quotes and brackets
+    // in the input, without parsing them
+    void skip(std::error_code& ec) override
+    {
+        if (current().event_type() == staj_event_type::begin_object || 
+            current().event_type() == staj_event_type::begin_array)
+        {
+            while (!parser_.skip_container() && !eof_)
+            {
+                if (source_.eof())
+                {
+                    eof_ = true;
+                }
+                else
+                {
+                    read_buffer(ec);
+                    if (ec) return;
+                }
+            }
+            // Consume the end of the object or array without reporting it
+            basic_default_json_visitor<CharT> end_visitor(false);
+            read_next(end_visitor, ec);
+            if (ec) return;
+        }
+        read_next(ec);
+    }
+
     void read_buffer(std::error_code& ec)
     {
+        read_buffer(ec, is_contiguous_source<Src>());
+    }
+
+    // The source content is already in memory, parse it in place
+    void read_buffer(std::error_code& ec, std::true_type)
+    {
+        auto s = source_.read_buffer();
+        if (s.size() == 0)
+        {
+            eof_ = true;
+        }
+        else if (begin_)
+        {
+            auto result = unicons::skip_bom(s.begin(), s.end());
+            if (result.ec != unicons::encoding_errc())
+            {
+                ec = result.ec;
+                return;
+            }
+            std::size_t offset = result.it - s.begin();
+            parser_.update(s.data()+offset,s.size()-offset);
+            begin_ = false;
+        }
+        else
+        {
+            parser_.update(s.data(),s.size());
+        }
+        basic_staj_event_batch<CharT>* batch = cursor_visitor_.batch();
+        if (batch != nullptr)
+        {
+            batch->borrow(s.data(), s.data()+s.size());
+        }
+    }
+
+    void read_buffer(std::error_code& ec, std::false_type)
+    {
+        basic_staj_event_batch<CharT>* batch = cursor_visitor_.batch();
+        if (batch != nullptr && parsing_buffer())
+        {
+            batch->copy_borrowed();
+        }
         buffer_.clear();
         buffer_.resize(buffer_length_);
         std::size_t count = source_.read(buffer_.data(), buffer_length_);
@@ -270,6 +374,17 @@ public:
         {
             parser_.update(buffer_.data(),buffer_.size());
         }
+        if (batch != nullptr)
+        {
+            batch->borrow(buffer_.data(), buffer_.data()+buffer_.size());
+        }
+    }
+
+    // True if the parser is reading from buffer_, which is overwritten by the next read
+    bool parsing_buffer() const
+    {
+        const CharT* p = parser_.input().data();
+        return !buffer_.empty() && p >= buffer_.data() && p <= buffer_.data()+buffer_.size();
     }
 
     void check_done()
@@ -339,11 +454,11 @@ public:
         return parser_.column();
     }
 
+    template <class Pred>
     friend
-    basic_staj_filter_view<CharT> operator|(basic_json_cursor& cursor, 
-                                      std::function<bool(const basic_staj_event<CharT>&, const ser_context&)> pred)
+    jsoncons::detail::staj_filter_view_t<CharT,Pred> operator|(basic_json_cursor& cursor, Pred&& pred)
     {
-        return basic_staj_filter_view<CharT>(cursor, pred);
+        return jsoncons::detail::staj_filter_view_t<CharT,Pred>(cursor, std::forward<Pred>(pred));
     }
 
 #if !defined(JSONCONS_NO_DEPRECATED)
@@ -356,7 +471,7 @@ public:
                       std::function<bool(json_errc,const ser_context&)> err_handler = default_json_parsing(),
                       const Allocator& alloc = Allocator(),
                       typename std::enable_if<!std::is_constructible<jsoncons::basic_string_view<CharT>,Source>::value>::type* = 0)
-       : source_(source),
+       : source_(std::forward<Source>(source)),
          parser_(options,err_handler,alloc),
          cursor_visitor_(filter),
          buffer_(alloc),
@@ -452,7 +567,7 @@ public:
                       std::function<bool(json_errc,const ser_context&)> err_handler,
                       std::error_code& ec,
                       typename std::enable_if<!std::is_constructible<jsoncons::basic_string_view<CharT>,Source>::value>::type* = 0)
-       : source_(source),
+       : source_(std::forward<Source>(source)),
          parser_(options,err_handler,alloc),
          cursor_visitor_(filter),
          buffer_(alloc),
@@ -15,12 +15,15 @@
 #include <utility> // std::move
 #include <jsoncons/json_exception.hpp>
 #include <jsoncons/json_visitor.hpp>
+#include <jsoncons/detail/key_intern_table.hpp>
+#include <jsoncons/json_container_types.hpp> // unique_key_order_tag
 
 namespace jsoncons {
 
 template <class Json,class TempAllocator=std::allocator<char>>
 class json_decoder final : public basic_json_visitor<typename Json::char_type>
 {
+    friend struct jsoncons::detail::json_visitor_access;
 public:
     using char_type = typename Json::char_type;
     using typename basic_json_visitor<char_type>::string_view_type;
@@ -70,6 +73,7 @@ private:
     using temp_allocator_type = TempAllocator;
     typedef typename std::allocator_traits<temp_allocator_type>:: template rebind_alloc<stack_item> stack_item_allocator_type;
     typedef typename std::allocator_traits<temp_allocator_type>:: template rebind_alloc<structure_info> structure_info_allocator_type;
+    typedef typename std::allocator_traits<temp_allocator_type>:: template rebind_alloc<uint32_t> key_id_allocator_type;
  
     result_allocator_type result_allocator_;
     temp_allocator_type temp_allocator_;
@@ -79,6 +83,9 @@ private:
     key_type name_;
     std::vector<stack_item,stack_item_allocator_type> item_stack_;
     std::vector<structure_info,structure_info_allocator_type> structure_stack_;
+    bool intern_keys_;
+    jsoncons::detail::key_intern_table<char_type,temp_allocator_type> key_table_;
+    std::vector<uint32_t,key_id_allocator_type> key_ids_;
     bool is_valid_;
 
 public:
@@ -89,6 +96,9 @@ public:
           name_(result_allocator_),
           item_stack_(temp_allocator_),
           structure_stack_(temp_allocator_),
+          intern_keys_(false),
+          key_table_(temp_allocator_),
+          key_ids_(temp_allocator_),
           is_valid_(false) 
     {
         item_stack_.reserve(1000);
@@ -104,6 +114,9 @@ public:
           name_(result_allocator_),
           item_stack_(),
           structure_stack_(),
+          intern_keys_(false),
+          key_table_(),
+          key_ids_(),
           is_valid_(false)
     {
         item_stack_.reserve(1000);
@@ -120,6 +133,9 @@ public:
           name_(result_allocator_),
           item_stack_(temp_allocator_),
           structure_stack_(temp_allocator_),
+          intern_keys_(false),
+          key_table_(temp_allocator_),
+          key_ids_(temp_allocator_),
           is_valid_(false)
     {
         item_stack_.reserve(1000);
@@ -133,6 +149,21 @@ public:
         item_stack_.clear();
         structure_stack_.clear();
         structure_stack_.emplace_back(structure_type::root_t, 0);
+        key_ids_.clear();
+    }
+
+    // When true, object keys are interned, and objects that have the same keys
+    // in the same order as an earlier object reuse its key order instead of being
+    // sorted and checked for duplicates. Pays off for arrays of records.
+    // Set before decoding starts.
+    void intern_keys(bool value)
+    {
+        intern_keys_ = value;
+    }
+
+    bool intern_keys() const
+    {
+        return intern_keys_;
     }
 
     bool is_valid() const
@@ -166,6 +197,7 @@ private:
         if (structure_stack_.back().type_ == structure_type::root_t)
         {
             item_stack_.clear();
+            key_ids_.clear();
             is_valid_ = false;
         }
         item_stack_.emplace_back(std::forward<key_type>(name_), json_object_arg, tag, result_allocator_);
@@ -182,11 +214,30 @@ private:
         const size_t count = item_stack_.size() - (structure_index + 1);
         auto first = item_stack_.begin() + (structure_index+1);
         auto last = first + count;
-        item_stack_[structure_index].value_.object_value().insert(
-            std::make_move_iterator(first),
-            std::make_move_iterator(last),
-            [](stack_item&& val){return key_value_type(std::move(val.name_), std::move(val.value_));}
-        );
+        auto convert = [](stack_item&& val){return key_value_type(std::move(val.name_), std::move(val.value_));};
+        const uint32_t* order = nullptr;
+        if (intern_keys_ && count > 0 && key_ids_.size() >= count)
+        {
+            order = key_table_.find_order(key_ids_.data() + (key_ids_.size() - count), count);
+            key_ids_.resize(key_ids_.size() - count);
+        }
+        if (order != nullptr)
+        {
+            item_stack_[structure_index].value_.object_value().insert(unique_key_order_tag(),
+                std::make_move_iterator(first),
+                std::make_move_iterator(last),
+                order,
+                convert
+            );
+        }
+        else
+        {
+            item_stack_[structure_index].value_.object_value().insert(
+                std::make_move_iterator(first),
+                std::make_move_iterator(last),
+                convert
+            );
+        }
         item_stack_.erase(item_stack_.begin()+structure_index+1, item_stack_.end());
         structure_stack_.pop_back();
         if (structure_stack_.back().type_ == structure_type::root_t)
@@ -204,6 +255,7 @@ private:
         if (structure_stack_.back().type_ == structure_type::root_t)
         {
             item_stack_.clear();
+            key_ids_.clear();
             is_valid_ = false;
         }
         item_stack_.emplace_back(std::forward<key_type>(name_), json_array_arg, tag, result_allocator_);
@@ -249,6 +301,10 @@ private:
     bool visit_key(const string_view_type& name, const ser_context&, std::error_code&) override
     {
         name_ = key_type(name.data(),name.length(),result_allocator_);
+        if (intern_keys_)
+        {
+            key_ids_.push_back(key_table_.intern(name.data(), name.length()));
+        }
         return true;
     }
 
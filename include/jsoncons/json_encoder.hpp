@@ -23,6 +23,7 @@
 #include <jsoncons/json_visitor.hpp>
 #include <jsoncons/sink.hpp>
 #include <jsoncons/detail/write_number.hpp>
+#include <jsoncons/detail/simd_scan.hpp>
 
 namespace jsoncons { 
 namespace detail {
@@ -45,10 +46,22 @@ namespace detail {
                          Sink& sink)
     {
         std::size_t count = 0;
-        const CharT* begin = s;
         const CharT* end = s + length;
-        for (const CharT* it = begin; it != end; ++it)
+        const CharT* it = s;
+        while (it != end)
         {
+            // Runs of characters that need no escaping go to the sink in one piece
+            const CharT* next = jsoncons::detail::find_escape_special(it, end, escape_solidus, escape_all_non_ascii);
+            if (next != it)
+            {
+                sink.append(it, static_cast<std::size_t>(next - it));
+                count += static_cast<std::size_t>(next - it);
+                it = next;
+                if (it == end)
+                {
+                    break;
+                }
+            }
             CharT c = *it;
             switch (c)
             {
@@ -150,6 +163,7 @@ namespace detail {
                     }
                     break;
             }
+            ++it;
         }
         return count;
     }
@@ -191,6 +205,7 @@ namespace detail {
     template<class CharT,class Sink=jsoncons::stream_sink<CharT>,class Allocator=std::allocator<char>>
     class basic_json_encoder final : public basic_json_visitor<CharT>
     {
+        friend struct jsoncons::detail::json_visitor_access;
         static const std::array<CharT, 4>& null_k()
         {
             static constexpr std::array<CharT,4> k{'n','u','l','l'};
@@ -593,6 +608,31 @@ namespace detail {
         }
 
         bool visit_key(const string_view_type& name, const ser_context&, std::error_code&) override
+        {
+            begin_key();
+            sink_.push_back('\"');
+            std::size_t length = jsoncons::detail::escape_string(name.data(), name.length(),options_.escape_all_non_ascii(),options_.escape_solidus(),sink_);
+            sink_.push_back('\"');
+            sink_.append(colon_str_.data(),colon_str_.length());
+            column_ += (length+2+colon_str_.length());
+            return true;
+        }
+
+        bool visit_key(const string_view_type& name, const string_view_type& quoted_name, 
+                       const ser_context& context, std::error_code& ec) override
+        {
+            if (quoted_name.empty())
+            {
+                return visit_key(name, context, ec);
+            }
+            begin_key();
+            sink_.append(quoted_name.data(),quoted_name.length());
+            sink_.append(colon_str_.data(),colon_str_.length());
+            column_ += (quoted_name.length()+colon_str_.length());
+            return true;
+        }
+
+        void begin_key()
         {
             JSONCONS_ASSERT(!stack_.empty());
             if (stack_.back().count() > 0)
@@ -616,12 +656,6 @@ namespace detail {
             {
                 stack_.back().set_position(column_);
             }
-            sink_.push_back('\"');
-            std::size_t length = jsoncons::detail::escape_string(name.data(), name.length(),options_.escape_all_non_ascii(),options_.escape_solidus(),sink_);
-            sink_.push_back('\"');
-            sink_.append(colon_str_.data(),colon_str_.length());
-            column_ += (length+2+colon_str_.length());
-            return true;
         }
 
         bool visit_null(semantic_tag, const ser_context&, std::error_code&) override
@@ -1037,6 +1071,7 @@ namespace detail {
     template<class CharT,class Sink=jsoncons::stream_sink<CharT>,class Allocator=std::allocator<char>>
     class basic_compact_json_encoder final : public basic_json_visitor<CharT>
     {
+        friend struct jsoncons::detail::json_visitor_access;
         static const std::array<CharT, 4>& null_k()
         {
             static constexpr std::array<CharT,4> k{'n','u','l','l'};
@@ -1215,6 +1250,22 @@ namespace detail {
             return true;
         }
 
+        bool visit_key(const string_view_type& name, const string_view_type& quoted_name, 
+                       const ser_context& context, std::error_code& ec) override
+        {
+            if (quoted_name.empty())
+            {
+                return visit_key(name, context, ec);
+            }
+            if (!stack_.empty() && stack_.back().count() > 0)
+            {
+                sink_.push_back(',');
+            }
+            sink_.append(quoted_name.data(),quoted_name.length());
+            sink_.push_back(':');
+            return true;
+        }
+
         bool visit_null(semantic_tag, const ser_context&, std::error_code&) override
         {
             if (!stack_.empty() && stack_.back().is_array() && stack_.back().count() > 0)
@@ -0,0 +1,778 @@
+// Copyright 2021 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_JSON_INDEX_PARSER_HPP
+#define JSONCONS_JSON_INDEX_PARSER_HPP
+
+#include <memory> // std::allocator
+#include <string>
+#include <vector>
+#include <system_error>
+#include <algorithm> // std::find_if
+#include <limits> // std::numeric_limits
+#include <jsoncons/json_exception.hpp>
+#include <jsoncons/json_options.hpp>
+#include <jsoncons/json_visitor.hpp>
+#include <jsoncons/json_error.hpp>
+#include <jsoncons/unicode_traits.hpp>
+#include <jsoncons/detail/parse_number.hpp>
+#include <jsoncons/detail/simd_scan.hpp>
+#include <jsoncons/detail/structural_index.hpp>
+
+namespace jsoncons {
+
+enum class json_index_parse_state : uint8_t
+{
+    start,
+    expect_comma_or_end,
+    expect_member_name_or_end,
+    expect_member_name,
+    expect_colon,
+    expect_value_or_end,
+    expect_value,
+    before_done,
+    done
+};
+
+// basic_json_index_parser is a two-stage parser for UTF-8 text that is entirely in memory.
+// Stage 1 builds an index of the structural characters of the whole input, stage 2 walks
+// the index and emits visitor events. It accepts strict JSON only, comments and error
+// recovery are left to basic_json_parser.
+
+template <class CharT, class TempAllocator = std::allocator<char>>
+class basic_json_index_parser : public ser_context
+{
+    static_assert(sizeof(CharT) == sizeof(char), "basic_json_index_parser requires a char type of size one");
+public:
+    using char_type = CharT;
+    using string_view_type = typename basic_json_visitor<CharT>::string_view_type;
+private:
+    struct string_maps_to_double
+    {
+        string_view_type s;
+
+        bool operator()(const std::pair<std::basic_string<CharT>,double>& val) const
+        {
+            return string_view_type(val.first) == s;
+        }
+    };
+
+    enum class container_kind : uint8_t {object, array};
+
+    using temp_allocator_type = TempAllocator;
+    using char_allocator_type = typename std::allocator_traits<temp_allocator_type>:: template rebind_alloc<CharT>;
+    using offset_allocator_type = typename std::allocator_traits<temp_allocator_type>:: template rebind_alloc<uint32_t>;
+    using kind_allocator_type = typename std::allocator_traits<temp_allocator_type>:: template rebind_alloc<container_kind>;
+
+    basic_json_decode_options<CharT> options_;
+
+    const CharT* input_;
+    std::size_t length_;
+    bool indexed_;
+    std::size_t index_pos_;
+    std::size_t position_;
+    json_index_parse_state state_;
+    bool more_;
+
+    // Cache for computing line and column on demand
+    mutable std::size_t line_cache_position_;
+    mutable std::size_t line_cache_line_;
+    mutable std::size_t line_cache_mark_;
+
+    std::vector<uint32_t,offset_allocator_type> index_;
+    std::vector<container_kind,kind_allocator_type> stack_;
+    std::basic_string<CharT,std::char_traits<CharT>,char_allocator_type> string_buffer_;
+    jsoncons::detail::to_double_t to_double_;
+    std::vector<std::pair<std::basic_string<CharT>,double>> string_double_map_;
+
+    // Noncopyable and nonmoveable
+    basic_json_index_parser(const basic_json_index_parser&) = delete;
+    basic_json_index_parser& operator=(const basic_json_index_parser&) = delete;
+
+public:
+    basic_json_index_parser(const TempAllocator& alloc = TempAllocator())
+        : basic_json_index_parser(basic_json_decode_options<CharT>(), alloc)
+    {
+    }
+
+    basic_json_index_parser(const basic_json_decode_options<CharT>& options,
+                            const TempAllocator& alloc = TempAllocator())
+       : options_(options),
+         input_(nullptr),
+         length_(0),
+         indexed_(false),
+         index_pos_(0),
+         position_(0),
+         state_(json_index_parse_state::start),
+         more_(true),
+         line_cache_position_(0),
+         line_cache_line_(1),
+         line_cache_mark_(0),
+         index_(alloc),
+         stack_(alloc),
+         string_buffer_(alloc)
+    {
+        if (options_.enable_str_to_nan())
+        {
+            string_double_map_.emplace_back(options_.nan_to_str(),std::nan(""));
+        }
+        if (options_.enable_str_to_inf())
+        {
+            string_double_map_.emplace_back(options_.inf_to_str(),std::numeric_limits<double>::infinity());
+        }
+        if (options_.enable_str_to_neginf())
+        {
+            string_double_map_.emplace_back(options_.neginf_to_str(),-std::numeric_limits<double>::infinity());
+        }
+    }
+
+    void update(const string_view_type sv)
+    {
+        update(sv.data(),sv.length());
+    }
+
+    // The input must remain valid until parsing is done
+    void update(const CharT* data, std::size_t length)
+    {
+        input_ = data;
+        length_ = length;
+        indexed_ = false;
+        index_pos_ = 0;
+        line_cache_position_ = 0;
+        line_cache_line_ = 1;
+        line_cache_mark_ = 0;
+    }
+
+    void reset()
+    {
+        stack_.clear();
+        index_pos_ = 0;
+        position_ = 0;
+        state_ = json_index_parse_state::start;
+        more_ = true;
+    }
+
+    void restart()
+    {
+        more_ = true;
+    }
+
+    bool done() const
+    {
+        return state_ == json_index_parse_state::done;
+    }
+
+    bool stopped() const
+    {
+        return !more_;
+    }
+
+    // The number of structural characters found by stage 1
+    std::size_t structural_count() const
+    {
+        return index_.size();
+    }
+
+    void parse(basic_json_visitor<CharT>& visitor)
+    {
+        std::error_code ec;
+        parse(visitor, ec);
+        if (ec)
+        {
+            JSONCONS_THROW(ser_error(ec,line(),column()));
+        }
+    }
+
+    // Parses the whole input, or until the visitor returns false
+    void parse(basic_json_visitor<CharT>& visitor, std::error_code& ec)
+    {
+        if (!indexed_)
+        {
+            if (!jsoncons::detail::build_structural_index(reinterpret_cast<const char*>(input_), length_, index_))
+            {
+                position_ = length_;
+                ec = json_errc::unexpected_eof;
+                more_ = false;
+                return;
+            }
+            indexed_ = true;
+        }
+        walk_index(visitor, ec);
+    }
+
+    std::size_t line() const override
+    {
+        update_line_cache();
+        return line_cache_line_;
+    }
+
+    std::size_t column() const override
+    {
+        update_line_cache();
+        return (position_ - line_cache_mark_) + 1;
+    }
+
+    std::size_t position() const override
+    {
+        return position_;
+    }
+
+private:
+
+    void update_line_cache() const
+    {
+        if (position_ < line_cache_position_)
+        {
+            line_cache_position_ = 0;
+            line_cache_line_ = 1;
+            line_cache_mark_ = 0;
+        }
+        for (; line_cache_position_ < position_ && line_cache_position_ < length_; ++line_cache_position_)
+        {
+            const CharT c = input_[line_cache_position_];
+            if (c == '\n' || (c == '\r' && (line_cache_position_+1 == length_ || input_[line_cache_position_+1] != '\n')))
+            {
+                ++line_cache_line_;
+                line_cache_mark_ = line_cache_position_ + 1;
+            }
+        }
+    }
+
+    void fail(json_errc errc, std::size_t position, std::error_code& ec)
+    {
+        position_ = position;
+        ec = errc;
+        more_ = false;
+    }
+
+    void walk_index(basic_json_visitor<CharT>& visitor, std::error_code& ec)
+    {
+        const std::size_t count = index_.size();
+
+        while (state_ != json_index_parse_state::done)
+        {
+            if (state_ == json_index_parse_state::before_done)
+            {
+                if (index_pos_ != count)
+                {
+                    fail(json_errc::extra_character, index_[index_pos_], ec);
+                    return;
+                }
+                visitor.flush();
+                state_ = json_index_parse_state::done;
+                more_ = false;
+                return;
+            }
+            if (!more_)
+            {
+                return;
+            }
+            if (index_pos_ == count)
+            {
+                fail(json_errc::unexpected_eof, length_, ec);
+                return;
+            }
+
+            const std::size_t offset = index_[index_pos_++];
+            position_ = offset;
+            const CharT c = input_[offset];
+
+            switch (state_)
+            {
+                case json_index_parse_state::start:
+                case json_index_parse_state::expect_value:
+                    parse_value(c, offset, visitor, ec);
+                    break;
+                case json_index_parse_state::expect_value_or_end:
+                    if (c == ']')
+                    {
+                        end_container(container_kind::array, visitor, ec);
+                    }
+                    else
+                    {
+                        parse_value(c, offset, visitor, ec);
+                    }
+                    break;
+                case json_index_parse_state::expect_member_name_or_end:
+                    if (c == '}')
+                    {
+                        end_container(container_kind::object, visitor, ec);
+                    }
+                    else if (c == '\"')
+                    {
+                        parse_string(offset, true, visitor, ec);
+                    }
+                    else
+                    {
+                        fail(json_errc::expected_key, offset, ec);
+                    }
+                    break;
+                case json_index_parse_state::expect_member_name:
+                    if (c == '\"')
+                    {
+                        parse_string(offset, true, visitor, ec);
+                    }
+                    else
+                    {
+                        fail(c == '}' ? json_errc::extra_comma : json_errc::expected_key, offset, ec);
+                    }
+                    break;
+                case json_index_parse_state::expect_colon:
+                    if (c == ':')
+                    {
+                        state_ = json_index_parse_state::expect_value;
+                    }
+                    else
+                    {
+                        fail(json_errc::expected_colon, offset, ec);
+                    }
+                    break;
+                case json_index_parse_state::expect_comma_or_end:
+                    switch (c)
+                    {
+                        case ',':
+                            state_ = stack_.back() == container_kind::object
+                                ? json_index_parse_state::expect_member_name
+                                : json_index_parse_state::expect_value;
+                            break;
+                        case '}':
+                            end_container(container_kind::object, visitor, ec);
+                            break;
+                        case ']':
+                            end_container(container_kind::array, visitor, ec);
+                            break;
+                        default:
+                            fail(stack_.back() == container_kind::object
+                                 ? json_errc::expected_comma_or_right_brace
+                                 : json_errc::expected_comma_or_right_bracket, offset, ec);
+                            break;
+                    }
+                    break;
+                default:
+                    JSONCONS_UNREACHABLE();
+            }
+            if (ec)
+            {
+                return;
+            }
+        }
+    }
+
+    void parse_value(CharT c, std::size_t offset, basic_json_visitor<CharT>& visitor, std::error_code& ec)
+    {
+        switch (c)
+        {
+            case '{':
+                begin_container(container_kind::object, visitor, ec);
+                break;
+            case '[':
+                begin_container(container_kind::array, visitor, ec);
+                break;
+            case '\"':
+                parse_string(offset, false, visitor, ec);
+                break;
+            case '-':case '0':case '1':case '2':case '3':case '4':case '5':case '6':case '7':case '8':case '9':
+                parse_number(offset, visitor, ec);
+                break;
+            case 't':
+                parse_literal(offset, "true", 4, visitor, ec);
+                break;
+            case 'f':
+                parse_literal(offset, "false", 5, visitor, ec);
+                break;
+            case 'n':
+                parse_literal(offset, "null", 4, visitor, ec);
+                break;
+            case '}':
+                fail(json_errc::unexpected_right_brace, offset, ec);
+                break;
+            case ']':
+                fail(state_ == json_index_parse_state::expect_value ? json_errc::extra_comma : json_errc::unexpected_right_bracket, offset, ec);
+                break;
+            default:
+                fail(json_errc::expected_value, offset, ec);
+                break;
+        }
+    }
+
+    void begin_container(container_kind kind, basic_json_visitor<CharT>& visitor, std::error_code& ec)
+    {
+        if (JSONCONS_UNLIKELY(static_cast<int>(stack_.size()) >= options_.max_nesting_depth()))
+        {
+            fail(json_errc::max_nesting_depth_exceeded, position_, ec);
+            return;
+        }
+        stack_.push_back(kind);
+        if (kind == container_kind::object)
+        {
+            state_ = json_index_parse_state::expect_member_name_or_end;
+            more_ = visitor.begin_object(semantic_tag::none, *this, ec);
+        }
+        else
+        {
+            state_ = json_index_parse_state::expect_value_or_end;
+            more_ = visitor.begin_array(semantic_tag::none, *this, ec);
+        }
+    }
+
+    void end_container(container_kind kind, basic_json_visitor<CharT>& visitor, std::error_code& ec)
+    {
+        if (stack_.empty() || stack_.back() != kind)
+        {
+            if (kind == container_kind::object)
+            {
+                fail(stack_.empty() ? json_errc::unexpected_right_brace : json_errc::expected_comma_or_right_bracket, position_, ec);
+            }
+            else
+            {
+                fail(stack_.empty() ? json_errc::unexpected_right_bracket : json_errc::expected_comma_or_right_brace, position_, ec);
+            }
+            return;
+        }
+        stack_.pop_back();
+        if (kind == container_kind::object)
+        {
+            more_ = visitor.end_object(*this, ec);
+        }
+        else
+        {
+            more_ = visitor.end_array(*this, ec);
+        }
+        after_value();
+    }
+
+    void after_value()
+    {
+        state_ = stack_.empty() ? json_index_parse_state::before_done : json_index_parse_state::expect_comma_or_end;
+    }
+
+    bool is_delimiter(std::size_t offset) const
+    {
+        if (offset >= length_)
+        {
+            return true;
+        }
+        return jsoncons::detail::structural_char_class(static_cast<uint8_t>(input_[offset])) & 3;
+    }
+
+    void parse_literal(std::size_t offset, const char* literal, std::size_t length,
+                       basic_json_visitor<CharT>& visitor, std::error_code& ec)
+    {
+        if (length_ - offset < length || !std::equal(literal, literal+length, input_+offset) || !is_delimiter(offset+length))
+        {
+            fail(json_errc::invalid_value, offset, ec);
+            return;
+        }
+        switch (literal[0])
+        {
+            case 't':
+                more_ = visitor.bool_value(true, semantic_tag::none, *this, ec);
+                break;
+            case 'f':
+                more_ = visitor.bool_value(false, semantic_tag::none, *this, ec);
+                break;
+            default:
+                more_ = visitor.null_value(semantic_tag::none, *this, ec);
+                break;
+        }
+        after_value();
+    }
+
+    static bool is_digit(CharT c)
+    {
+        return c >= '0' && c <= '9';
+    }
+
+    void parse_number(std::size_t offset, basic_json_visitor<CharT>& visitor, std::error_code& ec)
+    {
+        const CharT* first = input_ + offset;
+        const CharT* last = input_ + length_;
+        const CharT* p = first;
+        bool is_integer = true;
+
+        if (*p == '-')
+        {
+            ++p;
+        }
+        if (p == last || !is_digit(*p))
+        {
+            fail(json_errc::invalid_number, offset, ec);
+            return;
+        }
+        if (*p == '0')
+        {
+            ++p;
+            if (p != last && is_digit(*p))
+            {
+                fail(json_errc::leading_zero, offset, ec);
+                return;
+            }
+        }
+        else
+        {
+            while (p != last && is_digit(*p))
+            {
+                ++p;
+            }
+        }
+        if (p != last && *p == '.')
+        {
+            is_integer = false;
+            ++p;
+            if (p == last || !is_digit(*p))
+            {
+                fail(json_errc::invalid_number, offset, ec);
+                return;
+            }
+            while (p != last && is_digit(*p))
+            {
+                ++p;
+            }
+        }
+        if (p != last && (*p == 'e' || *p == 'E'))
+        {
+            is_integer = false;
+            ++p;
+            if (p != last && (*p == '+' || *p == '-'))
+            {
+                ++p;
+            }
+            if (p == last || !is_digit(*p))
+            {
+                fail(json_errc::invalid_number, offset, ec);
+                return;
+            }
+            while (p != last && is_digit(*p))
+            {
+                ++p;
+            }
+        }
+        if (!is_delimiter(p - input_))
+        {
+            fail(json_errc::invalid_number, offset, ec);
+            return;
+        }
+
+        const std::size_t length = p - first;
+        if (is_integer)
+        {
+            if (*first == '-')
+            {
+                auto result = jsoncons::detail::to_integer_unchecked<int64_t>(first, length);
+                if (result)
+                {
+                    more_ = visitor.int64_value(result.value(), semantic_tag::none, *this, ec);
+                }
+                else // Must be overflow
+                {
+                    more_ = visitor.string_value(string_view_type(first, length), semantic_tag::bigint, *this, ec);
+                }
+            }
+            else
+            {
+                auto result = jsoncons::detail::to_integer_unchecked<uint64_t>(first, length);
+                if (result)
+                {
+                    more_ = visitor.uint64_value(result.value(), semantic_tag::none, *this, ec);
+                }
+                else // Must be overflow
+                {
+                    more_ = visitor.string_value(string_view_type(first, length), semantic_tag::bigint, *this, ec);
+                }
+            }
+        }
+        else if (options_.lossless_number())
+        {
+            more_ = visitor.string_value(string_view_type(first, length), semantic_tag::bigdec, *this, ec);
+        }
+        else
+        {
+            // to_double_ needs a null terminated string with the locale's decimal point
+            string_buffer_.assign(first, length);
+            const CharT decimal_point = static_cast<CharT>(to_double_.get_decimal_point());
+            if (decimal_point != '.')
+            {
+                std::replace(string_buffer_.begin(), string_buffer_.end(), static_cast<CharT>('.'), decimal_point);
+            }
+            double d = to_double_(string_buffer_.c_str(), string_buffer_.length());
+            more_ = visitor.double_value(d, semantic_tag::none, *this, ec);
+        }
+        after_value();
+    }
+
+    bool parse_hex4(const CharT*& p, const CharT* last, uint32_t& cp)
+    {
+        if (last - p < 4)
+        {
+            return false;
+        }
+        cp = 0;
+        for (int i = 0; i < 4; ++i, ++p)
+        {
+            const CharT c = *p;
+            cp *= 16;
+            if (c >= '0' && c <= '9')
+            {
+                cp += c - '0';
+            }
+            else if (c >= 'a' && c <= 'f')
+            {
+                cp += c - 'a' + 10;
+            }
+            else if (c >= 'A' && c <= 'F')
+            {
+                cp += c - 'A' + 10;
+            }
+            else
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void parse_string(std::size_t offset, bool is_key, basic_json_visitor<CharT>& visitor, std::error_code& ec)
+    {
+        const CharT* last = input_ + length_;
+        const CharT* sb = input_ + offset + 1;
+        const CharT* p = sb;
+        bool has_escapes = false;
+
+        for (;;)
+        {
+            p = jsoncons::detail::find_string_special(p, last);
+            if (p == last)
+            {
+                fail(json_errc::unexpected_eof, length_, ec);
+                return;
+            }
+            if (*p == '\"')
+            {
+                break;
+            }
+            if (*p != '\\')
+            {
+                fail(*p == '\n' || *p == '\r' || *p == '\t' ? json_errc::illegal_character_in_string : json_errc::illegal_control_character, p - input_, ec);
+                return;
+            }
+            if (!has_escapes)
+            {
+                string_buffer_.clear();
+                has_escapes = true;
+            }
+            string_buffer_.append(sb, p - sb);
+            ++p;
+            if (p == last)
+            {
+                fail(json_errc::unexpected_eof, length_, ec);
+                return;
+            }
+            switch (*p)
+            {
+                case '\"': string_buffer_.push_back('\"'); ++p; break;
+                case '\\': string_buffer_.push_back('\\'); ++p; break;
+                case '/': string_buffer_.push_back('/'); ++p; break;
+                case 'b': string_buffer_.push_back('\b'); ++p; break;
+                case 'f': string_buffer_.push_back('\f'); ++p; break;
+                case 'n': string_buffer_.push_back('\n'); ++p; break;
+                case 'r': string_buffer_.push_back('\r'); ++p; break;
+                case 't': string_buffer_.push_back('\t'); ++p; break;
+                case 'u':
+                {
+                    ++p;
+                    uint32_t cp;
+                    if (!parse_hex4(p, last, cp))
+                    {
+                        fail(json_errc::invalid_unicode_escape_sequence, p - input_, ec);
+                        return;
+                    }
+                    if (unicons::is_high_surrogate(cp))
+                    {
+                        uint32_t cp2;
+                        if (last - p < 2 || p[0] != '\\' || p[1] != 'u')
+                        {
+                            fail(json_errc::expected_codepoint_surrogate_pair, p - input_, ec);
+                            return;
+                        }
+                        p += 2;
+                        if (!parse_hex4(p, last, cp2))
+                        {
+                            fail(json_errc::invalid_unicode_escape_sequence, p - input_, ec);
+                            return;
+                        }
+                        cp = 0x10000 + ((cp & 0x3FF) << 10) + (cp2 & 0x3FF);
+                    }
+                    unicons::convert(&cp, &cp + 1, std::back_inserter(string_buffer_));
+                    break;
+                }
+                default:
+                    fail(json_errc::illegal_escaped_character, p - input_, ec);
+                    return;
+            }
+            sb = p;
+        }
+
+        string_view_type sv;
+        if (has_escapes)
+        {
+            string_buffer_.append(sb, p - sb);
+            sv = string_view_type(string_buffer_.data(), string_buffer_.length());
+        }
+        else
+        {
+            sv = string_view_type(sb, p - sb);
+        }
+
+        auto result = unicons::validate(sv.data(), sv.data() + sv.length());
+        if (result.ec != unicons::conv_errc())
+        {
+            fail(translate_conv_errc(result.ec), offset, ec);
+            return;
+        }
+
+        if (is_key)
+        {
+            more_ = visitor.key(sv, *this, ec);
+            state_ = json_index_parse_state::expect_colon;
+        }
+        else
+        {
+            auto it = std::find_if(string_double_map_.begin(), string_double_map_.end(), string_maps_to_double{ sv });
+            if (it != string_double_map_.end())
+            {
+                more_ = visitor.double_value(it->second, semantic_tag::none, *this, ec);
+            }
+            else
+            {
+                more_ = visitor.string_value(sv, semantic_tag::none, *this, ec);
+            }
+            after_value();
+        }
+    }
+
+    static json_errc translate_conv_errc(unicons::conv_errc result)
+    {
+        switch (result)
+        {
+            case unicons::conv_errc::over_long_utf8_sequence:
+                return json_errc::over_long_utf8_sequence;
+            case unicons::conv_errc::unpaired_high_surrogate:
+                return json_errc::unpaired_high_surrogate;
+            case unicons::conv_errc::expected_continuation_byte:
+                return json_errc::expected_continuation_byte;
+            case unicons::conv_errc::illegal_surrogate_value:
+                return json_errc::illegal_surrogate_value;
+            default:
+                return json_errc::illegal_codepoint;
+        }
+    }
+};
+
+using json_index_parser = basic_json_index_parser<char>;
+
+}
+
+#endif
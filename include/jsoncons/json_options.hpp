@@ -40,6 +40,8 @@ enum class byte_string_chars_format : uint8_t {none=0,base16,base64,base64url};
 
 enum class spaces_option : uint8_t {no_spaces=0,space_after,space_before,space_before_and_after};
 
+enum class json_parse_engine : uint8_t {state_machine=0,structural_index};
+
 template <class CharT>
 class basic_json_options;
 
@@ -325,9 +327,13 @@ public:
     using typename super_type::string_type;
 private:
     bool lossless_number_:1;
+    bool intern_keys_:1;
+    json_parse_engine parse_engine_;
 public:
     basic_json_decode_options()
-        : lossless_number_(false)
+        : lossless_number_(false),
+          intern_keys_(false),
+          parse_engine_(json_parse_engine::state_machine)
     {
     }
 
@@ -335,7 +341,9 @@ public:
 
     basic_json_decode_options(basic_json_decode_options&& other)
         : super_type(std::forward<basic_json_decode_options>(other)),
-                     lossless_number_(other.lossless_number_)
+                     lossless_number_(other.lossless_number_),
+                     intern_keys_(other.intern_keys_),
+                     parse_engine_(other.parse_engine_)
     {
     }
 
@@ -346,6 +354,16 @@ public:
         return lossless_number_;
     }
 
+    bool intern_keys() const 
+    {
+        return intern_keys_;
+    }
+
+    json_parse_engine parse_engine() const 
+    {
+        return parse_engine_;
+    }
+
 #if !defined(JSONCONS_NO_DEPRECATED)
     JSONCONS_DEPRECATED_MSG("Instead, use lossless_number()")
     bool dec_to_str() const 
@@ -544,6 +562,8 @@ public:
     using basic_json_decode_options<CharT>::neginf_to_num;
 
     using basic_json_decode_options<CharT>::lossless_number;
+    using basic_json_decode_options<CharT>::intern_keys;
+    using basic_json_decode_options<CharT>::parse_engine;
 
     using basic_json_encode_options<CharT>::byte_string_format;
     using basic_json_encode_options<CharT>::bigint_format;
@@ -725,6 +745,18 @@ public:
         return *this;
     }
 
+    basic_json_options& intern_keys(bool value) 
+    {
+        this->intern_keys_ = value;
+        return *this;
+    }
+
+    basic_json_options& parse_engine(json_parse_engine value) 
+    {
+        this->parse_engine_ = value;
+        return *this;
+    }
+
     basic_json_options& line_length_limit(std::size_t value)
     {
         this->line_length_limit_ = value;
@@ -21,6 +21,7 @@
 #include <jsoncons/json_visitor.hpp>
 #include <jsoncons/json_error.hpp>
 #include <jsoncons/detail/parse_number.hpp>
+#include <jsoncons/detail/simd_scan.hpp>
 
 #define JSONCONS_ILLEGAL_CONTROL_CHARACTER \
         case 0x00:case 0x01:case 0x02:case 0x03:case 0x04:case 0x05:case 0x06:case 0x07:case 0x08:case 0x0b: \
@@ -124,12 +125,14 @@ private:
     {
         string_view_type s;
 
-        bool operator()(const std::pair<string_view_type,double>& val) const
+        bool operator()(const std::pair<std::basic_string<CharT>,double>& val) const
         {
-            return val.first == s;
+            return string_view_type(val.first) == s;
         }
     };
 
+    using visitor_access = jsoncons::detail::json_visitor_access;
+
     using temp_allocator_type = TempAllocator;
     using char_allocator_type = typename std::allocator_traits<temp_allocator_type>:: template rebind_alloc<CharT>;
     using parse_state_allocator_type = typename std::allocator_traits<temp_allocator_type>:: template rebind_alloc<json_parse_state>;
@@ -154,12 +157,15 @@ private:
     json_parse_state state_;
     bool more_;
     bool done_;
+    int skip_depth_;
+    bool skip_in_string_;
+    bool skip_escaped_;
 
     std::basic_string<CharT,std::char_traits<CharT>,char_allocator_type> string_buffer_;
     jsoncons::detail::to_double_t to_double_;
 
     std::vector<json_parse_state,parse_state_allocator_type> state_stack_;
-    std::vector<std::pair<string_view_type,double>> string_double_map_;
+    std::vector<std::pair<std::basic_string<CharT>,double>> string_double_map_;
 
     // Noncopyable and nonmoveable
     basic_json_parser(const basic_json_parser&) = delete;
@@ -202,6 +208,9 @@ public:
          state_(json_parse_state::start),
          more_(true),
          done_(false),
+         skip_depth_(0),
+         skip_in_string_(false),
+         skip_escaped_(false),
          string_buffer_(alloc),
          state_stack_(alloc)
     {
@@ -263,9 +272,12 @@ public:
             {
                 case ' ':
                 case '\t':
-                    ++input_ptr_;
-                    ++position_;
+                {
+                    const CharT* p = jsoncons::detail::skip_blanks(input_ptr_+1, local_input_end);
+                    position_ += (p - input_ptr_);
+                    input_ptr_ = p;
                     break;
+                }
                 case '\r': 
                     push_state(state_);
                     ++input_ptr_;
@@ -326,7 +338,8 @@ public:
         }
     }
 
-    void begin_object(basic_json_visitor<CharT>& visitor, std::error_code& ec)
+    template <class Visitor>
+    void begin_object(Visitor& visitor, std::error_code& ec)
     {
         if (JSONCONS_UNLIKELY(++nesting_depth_ > options_.max_nesting_depth()))
         {
@@ -340,10 +353,11 @@ public:
 
         push_state(json_parse_state::object);
         state_ = json_parse_state::expect_member_name_or_end;
-        more_ = visitor.begin_object(semantic_tag::none, *this, ec);
+        more_ = visitor_access::begin_object(visitor, semantic_tag::none, *this, ec);
     }
 
-    void end_object(basic_json_visitor<CharT>& visitor, std::error_code& ec)
+    template <class Visitor>
+    void end_object(Visitor& visitor, std::error_code& ec)
     {
         if (JSONCONS_UNLIKELY(nesting_depth_ < 1))
         {
@@ -356,7 +370,7 @@ public:
         state_ = pop_state();
         if (state_ == json_parse_state::object)
         {
-            more_ = visitor.end_object(*this, ec);
+            more_ = visitor_access::end_object(visitor, *this, ec);
         }
         else if (state_ == json_parse_state::array)
         {
@@ -383,7 +397,8 @@ public:
         }
     }
 
-    void begin_array(basic_json_visitor<CharT>& visitor, std::error_code& ec)
+    template <class Visitor>
+    void begin_array(Visitor& visitor, std::error_code& ec)
     {
         if (++nesting_depth_ > options_.max_nesting_depth())
         {
@@ -397,10 +412,11 @@ public:
 
         push_state(json_parse_state::array);
         state_ = json_parse_state::expect_value_or_end;
-        more_ = visitor.begin_array(semantic_tag::none, *this, ec);
+        more_ = visitor_access::begin_array(visitor, semantic_tag::none, *this, ec);
     }
 
-    void end_array(basic_json_visitor<CharT>& visitor, std::error_code& ec)
+    template <class Visitor>
+    void end_array(Visitor& visitor, std::error_code& ec)
     {
         if (nesting_depth_ < 1)
         {
@@ -413,7 +429,7 @@ public:
         state_ = pop_state();
         if (state_ == json_parse_state::array)
         {
-            more_ = visitor.end_array(*this, ec);
+            more_ = visitor_access::end_array(visitor, *this, ec);
         }
         else if (state_ == json_parse_state::object)
         {
@@ -451,6 +467,7 @@ public:
         position_ = 0;
         mark_position_ = 0;
         nesting_depth_ = 0;
+        skip_depth_ = 0;
     }
 
     void restart()
@@ -458,6 +475,73 @@ public:
         more_ = true;
     }
 
+    // Skips the members or elements of the object or array that the last event began,
+    // without emitting events, and leaves the input at its closing brace or bracket, which
+    // the next call to parse_some reports as usual. Only quotes and brackets are matched,
+    // the skipped text is not otherwise checked. Returns false if the input is exhausted
+    // first, call again after update() to continue.
+    bool skip_container()
+    {
+        if (skip_depth_ == 0)
+        {
+            skip_depth_ = 1;
+            skip_in_string_ = false;
+            skip_escaped_ = false;
+        }
+        const CharT* p = input_ptr_;
+        const CharT* local_input_end = input_end_;
+        while (p != local_input_end)
+        {
+            if (skip_escaped_)
+            {
+                skip_escaped_ = false;
+                ++p;
+                continue;
+            }
+            p = skip_in_string_ ? jsoncons::detail::find_string_special(p, local_input_end)
+                                : jsoncons::detail::find_nesting_special(p, local_input_end);
+            if (p == local_input_end)
+            {
+                break;
+            }
+            switch (*p)
+            {
+                case '\"':
+                    skip_in_string_ = !skip_in_string_;
+                    break;
+                case '\\':
+                    skip_escaped_ = true;
+                    break;
+                case '\n':
+                    ++line_;
+                    mark_position_ = position_ + (p - input_ptr_) + 1;
+                    break;
+                case '{':
+                case '[':
+                    if (!skip_in_string_)
+                    {
+                        ++skip_depth_;
+                    }
+                    break;
+                case '}':
+                case ']':
+                    if (!skip_in_string_ && --skip_depth_ == 0)
+                    {
+                        position_ += (p - input_ptr_);
+                        input_ptr_ = p;
+                        return true;
+                    }
+                    break;
+                default:
+                    break;
+            }
+            ++p;
+        }
+        position_ += (p - input_ptr_);
+        input_ptr_ = p;
+        return false;
+    }
+
     void check_done()
     {
         std::error_code ec;
@@ -497,6 +581,12 @@ public:
         return state_;
     }
 
+    // The content passed to the last call to update
+    string_view_type input() const
+    {
+        return string_view_type(begin_input_, input_end_ - begin_input_);
+    }
+
     void update(const string_view_type sv)
     {
         update(sv.data(),sv.length());
@@ -509,7 +599,11 @@ public:
         input_ptr_ = begin_input_;
     }
 
-    void parse_some(basic_json_visitor<CharT>& visitor)
+    // Visitor is basic_json_visitor<CharT> or a class derived from it. The parser calls 
+    // its visit_ functions through detail::json_visitor_access, so when it is a final class
+    // such as json_decoder or one of the encoders, the calls are resolved at compile time.
+    template <class Visitor>
+    void parse_some(Visitor& visitor)
     {
         std::error_code ec;
         parse_some(visitor, ec);
@@ -519,12 +613,14 @@ public:
         }
     }
 
-    void parse_some(basic_json_visitor<CharT>& visitor, std::error_code& ec)
+    template <class Visitor>
+    void parse_some(Visitor& visitor, std::error_code& ec)
     {
         parse_some_(visitor, ec);
     }
 
-    void finish_parse(basic_json_visitor<CharT>& visitor)
+    template <class Visitor>
+    void finish_parse(Visitor& visitor)
     {
         std::error_code ec;
         finish_parse(visitor, ec);
@@ -534,7 +630,8 @@ public:
         }
     }
 
-    void finish_parse(basic_json_visitor<CharT>& visitor, std::error_code& ec)
+    template <class Visitor>
+    void finish_parse(Visitor& visitor, std::error_code& ec)
     {
         while (!finished())
         {
@@ -542,11 +639,12 @@ public:
         }
     }
 
-    void parse_some_(basic_json_visitor<CharT>& visitor, std::error_code& ec)
+    template <class Visitor>
+    void parse_some_(Visitor& visitor, std::error_code& ec)
     {
         if (state_ == json_parse_state::before_done)
         {
-            visitor.flush();
+            visitor_access::flush(visitor);
             done_ = true;
             state_ = json_parse_state::done;
             more_ = false;
@@ -572,7 +670,7 @@ public:
                     if (ec) return;
                     break;
                 case json_parse_state::before_done:
-                    visitor.flush();
+                    visitor_access::flush(visitor);
                     done_ = true;
                     state_ = json_parse_state::done;
                     more_ = false;
@@ -596,7 +694,7 @@ public:
             switch (state_)
             {
                 case json_parse_state::before_done:
-                    visitor.flush();
+                    visitor_access::flush(visitor);
                     done_ = true;
                     state_ = json_parse_state::done;
                     more_ = false;
@@ -1335,7 +1433,7 @@ public:
                     switch (*input_ptr_)
                     {
                         case 'e':
-                            more_ = visitor.bool_value(true,  semantic_tag::none, *this, ec);
+                            more_ = visitor_access::bool_value(visitor, true,  semantic_tag::none, *this, ec);
                             if (parent() == json_parse_state::root)
                             {
                                 state_ = json_parse_state::before_done;
@@ -1403,7 +1501,7 @@ public:
                     switch (*input_ptr_)
                     {
                         case 'e':
-                            more_ = visitor.bool_value(false, semantic_tag::none, *this, ec);
+                            more_ = visitor_access::bool_value(visitor, false, semantic_tag::none, *this, ec);
                             if (parent() == json_parse_state::root)
                             {
                                 state_ = json_parse_state::before_done;
@@ -1456,7 +1554,7 @@ public:
                     switch (*input_ptr_)
                     {
                     case 'l':
-                        more_ = visitor.null_value(semantic_tag::none, *this, ec);
+                        more_ = visitor_access::null_value(visitor, semantic_tag::none, *this, ec);
                         if (parent() == json_parse_state::root)
                         {
                             state_ = json_parse_state::before_done;
@@ -1576,14 +1674,15 @@ public:
         }
     }
 
-    void parse_true(basic_json_visitor<CharT>& visitor, std::error_code& ec)
+    template <class Visitor>
+    void parse_true(Visitor& visitor, std::error_code& ec)
     {
         saved_position_ = position_;
         if (JSONCONS_LIKELY(input_end_ - input_ptr_ >= 4))
         {
             if (*(input_ptr_+1) == 'r' && *(input_ptr_+2) == 'u' && *(input_ptr_+3) == 'e')
             {
-                more_ = visitor.bool_value(true, semantic_tag::none, *this, ec);
+                more_ = visitor_access::bool_value(visitor, true, semantic_tag::none, *this, ec);
                 input_ptr_ += 4;
                 position_ += 4;
                 if (parent() == json_parse_state::root)
@@ -1611,14 +1710,15 @@ public:
         }
     }
 
-    void parse_null(basic_json_visitor<CharT>& visitor, std::error_code& ec)
+    template <class Visitor>
+    void parse_null(Visitor& visitor, std::error_code& ec)
     {
         saved_position_ = position_;
         if (JSONCONS_LIKELY(input_end_ - input_ptr_ >= 4))
         {
             if (*(input_ptr_+1) == 'u' && *(input_ptr_+2) == 'l' && *(input_ptr_+3) == 'l')
             {
-                more_ = visitor.null_value(semantic_tag::none, *this, ec);
+                more_ = visitor_access::null_value(visitor, semantic_tag::none, *this, ec);
                 input_ptr_ += 4;
                 position_ += 4;
                 if (parent() == json_parse_state::root)
@@ -1646,14 +1746,15 @@ public:
         }
     }
 
-    void parse_false(basic_json_visitor<CharT>& visitor, std::error_code& ec)
+    template <class Visitor>
+    void parse_false(Visitor& visitor, std::error_code& ec)
     {
         saved_position_ = position_;
         if (JSONCONS_LIKELY(input_end_ - input_ptr_ >= 5))
         {
             if (*(input_ptr_+1) == 'a' && *(input_ptr_+2) == 'l' && *(input_ptr_+3) == 's' && *(input_ptr_+4) == 'e')
             {
-                more_ = visitor.bool_value(false, semantic_tag::none, *this, ec);
+                more_ = visitor_access::bool_value(visitor, false, semantic_tag::none, *this, ec);
                 input_ptr_ += 5;
                 position_ += 5;
                 if (parent() == json_parse_state::root)
@@ -1681,7 +1782,8 @@ public:
         }
     }
 
-    void parse_number(basic_json_visitor<CharT>& visitor, std::error_code& ec)
+    template <class Visitor>
+    void parse_number(Visitor& visitor, std::error_code& ec)
     {
         saved_position_ = position_ - 1;
         const CharT* local_input_end = input_end_;
@@ -2099,7 +2201,8 @@ exp3:
         JSONCONS_UNREACHABLE();               
     }
 
-    void parse_string(basic_json_visitor<CharT>& visitor, std::error_code& ec)
+    template <class Visitor>
+    void parse_string(Visitor& visitor, std::error_code& ec)
     {
         saved_position_ = position_ - 1;
         const CharT* local_input_end = input_end_;
@@ -2138,6 +2241,12 @@ exp3:
 string_u1:
         while (input_ptr_ < local_input_end)
         {
+            // Skip over the run of characters that need no special handling
+            input_ptr_ = jsoncons::detail::find_string_special(input_ptr_, local_input_end);
+            if (input_ptr_ == local_input_end)
+            {
+                break;
+            }
             switch (*input_ptr_)
             {
                 JSONCONS_ILLEGAL_CONTROL_CHARACTER:
@@ -2217,6 +2326,7 @@ string_u1:
                 {
                     if (string_buffer_.length() == 0)
                     {
+                        // No escapes and not split across buffers, refer to the input directly
                         end_string_value(sb,input_ptr_-sb, visitor, ec);
                         if (ec) {return;}
                     }
@@ -2606,7 +2716,8 @@ escape_u8:
     }
 private:
 
-    void end_integer_value(basic_json_visitor<CharT>& visitor, std::error_code& ec)
+    template <class Visitor>
+    void end_integer_value(Visitor& visitor, std::error_code& ec)
     {
         if (string_buffer_[0] == '-')
         {
@@ -2618,46 +2729,49 @@ private:
         }
     }
 
-    void end_negative_value(basic_json_visitor<CharT>& visitor, std::error_code& ec)
+    template <class Visitor>
+    void end_negative_value(Visitor& visitor, std::error_code& ec)
     {
         auto result = jsoncons::detail::to_integer_unchecked<int64_t>(string_buffer_.data(), string_buffer_.length());
         if (result)
         {
-            more_ = visitor.int64_value(result.value(), semantic_tag::none, *this, ec);
+            more_ = visitor_access::int64_value(visitor, result.value(), semantic_tag::none, *this, ec);
         }
         else // Must be overflow
         {
-            more_ = visitor.string_value(string_buffer_, semantic_tag::bigint, *this, ec);
+            more_ = visitor_access::string_value(visitor, string_buffer_, semantic_tag::bigint, *this, ec);
         }
         after_value(ec);
     }
 
-    void end_positive_value(basic_json_visitor<CharT>& visitor, std::error_code& ec)
+    template <class Visitor>
+    void end_positive_value(Visitor& visitor, std::error_code& ec)
     {
         auto result = jsoncons::detail::to_integer_unchecked<uint64_t>(string_buffer_.data(), string_buffer_.length());
         if (result)
         {
-            more_ = visitor.uint64_value(result.value(), semantic_tag::none, *this, ec);
+            more_ = visitor_access::uint64_value(visitor, result.value(), semantic_tag::none, *this, ec);
         }
         else // Must be overflow
         {
-            more_ = visitor.string_value(string_buffer_, semantic_tag::bigint, *this, ec);
+            more_ = visitor_access::string_value(visitor, string_buffer_, semantic_tag::bigint, *this, ec);
         }
         after_value(ec);
     }
 
-    void end_fraction_value(basic_json_visitor<CharT>& visitor, std::error_code& ec)
+    template <class Visitor>
+    void end_fraction_value(Visitor& visitor, std::error_code& ec)
     {
         JSONCONS_TRY
         {
             if (options_.lossless_number())
             {
-                more_ = visitor.string_value(string_buffer_, semantic_tag::bigdec, *this, ec);
+                more_ = visitor_access::string_value(visitor, string_buffer_, semantic_tag::bigdec, *this, ec);
             }
             else
             {
                 double d = to_double_(string_buffer_.c_str(), string_buffer_.length());
-                more_ = visitor.double_value(d, semantic_tag::none, *this, ec);
+                more_ = visitor_access::double_value(visitor, d, semantic_tag::none, *this, ec);
             }
         }
         JSONCONS_CATCH(...)
@@ -2668,13 +2782,14 @@ private:
                 ec = json_errc::invalid_number;
                 return;
             }
-            more_ = visitor.null_value(semantic_tag::none, *this, ec); // recovery
+            more_ = visitor_access::null_value(visitor, semantic_tag::none, *this, ec); // recovery
         }
 
         after_value(ec);
     }
 
-    void end_string_value(const CharT* s, std::size_t length, basic_json_visitor<CharT>& visitor, std::error_code& ec) 
+    template <class Visitor>
+    void end_string_value(const CharT* s, std::size_t length, Visitor& visitor, std::error_code& ec) 
     {
         string_view_type sv(s, length);
         auto result = unicons::validate(s,s+length);
@@ -2687,7 +2802,7 @@ private:
         switch (parent())
         {
         case json_parse_state::member_name:
-            more_ = visitor.key(sv, *this, ec);
+            more_ = visitor_access::key(visitor, sv, *this, ec);
             pop_state();
             state_ = json_parse_state::expect_colon;
             break;
@@ -2697,11 +2812,11 @@ private:
             auto it = std::find_if(string_double_map_.begin(), string_double_map_.end(), string_maps_to_double{ sv });
             if (it != string_double_map_.end())
             {
-                more_ = visitor.double_value(it->second, semantic_tag::none, *this, ec);
+                more_ = visitor_access::double_value(visitor, it->second, semantic_tag::none, *this, ec);
             }
             else
             {
-                more_ = visitor.string_value(sv, semantic_tag::none, *this, ec);
+                more_ = visitor_access::string_value(visitor, sv, semantic_tag::none, *this, ec);
             }
             state_ = json_parse_state::expect_comma_or_end;
             break;
@@ -2711,11 +2826,11 @@ private:
             auto it = std::find_if(string_double_map_.begin(),string_double_map_.end(),string_maps_to_double{sv});
             if (it != string_double_map_.end())
             {
-                more_ = visitor.double_value(it->second, semantic_tag::none, *this, ec);
+                more_ = visitor_access::double_value(visitor, it->second, semantic_tag::none, *this, ec);
             }
             else
             {
-                more_ = visitor.string_value(sv, semantic_tag::none, *this, ec);
+                more_ = visitor_access::string_value(visitor, sv, semantic_tag::none, *this, ec);
             }
             state_ = json_parse_state::before_done;
             break;
@@ -13,6 +13,7 @@
 #include <stdexcept>
 #include <system_error>
 #include <ios>
+#include <type_traits> // std::enable_if
 #include <utility> // std::move
 #include <jsoncons/source.hpp>
 #include <jsoncons/json_exception.hpp>
@@ -338,6 +339,29 @@ public:
     }
 
     void read_next(std::error_code& ec)
+    {
+        read_next(visitor_, ec);
+    }
+
+    // Reads the next JSON text with visitor in place of the visitor passed to the 
+    // constructor. The parser is instantiated for Visitor, so when it is a final 
+    // class, such as json_decoder or one of the encoders, its event functions are 
+    // called without virtual dispatch.
+    template <class Visitor>
+    typename std::enable_if<std::is_base_of<basic_json_visitor<CharT>,Visitor>::value>::type
+    read_next(Visitor& visitor)
+    {
+        std::error_code ec;
+        read_next(visitor, ec);
+        if (ec)
+        {
+            JSONCONS_THROW(ser_error(ec,parser_.line(),parser_.column()));
+        }
+    }
+
+    template <class Visitor>
+    typename std::enable_if<std::is_base_of<basic_json_visitor<CharT>,Visitor>::value>::type
+    read_next(Visitor& visitor, std::error_code& ec)
     {
         if (source_.is_error())
         {
@@ -359,7 +383,7 @@ public:
                     eof_ = true;
                 }
             }
-            parser_.parse_some(visitor_, ec);
+            parser_.parse_some(visitor, ec);
             if (ec) return;
         }
         
@@ -462,6 +486,26 @@ public:
         }
     }
 
+    // Same as read(), but with visitor in place of the visitor passed to the constructor
+    template <class Visitor>
+    typename std::enable_if<std::is_base_of<basic_json_visitor<CharT>,Visitor>::value>::type
+    read(Visitor& visitor)
+    {
+        read_next(visitor);
+        check_done();
+    }
+
+    template <class Visitor>
+    typename std::enable_if<std::is_base_of<basic_json_visitor<CharT>,Visitor>::value>::type
+    read(Visitor& visitor, std::error_code& ec)
+    {
+        read_next(visitor, ec);
+        if (!ec)
+        {
+            check_done(ec);
+        }
+    }
+
 #if !defined(JSONCONS_NO_DEPRECATED)
 
     JSONCONS_DEPRECATED_MSG("Instead, use buffer_length()")
@@ -481,6 +525,37 @@ public:
 private:
 
     void read_buffer(std::error_code& ec)
+    {
+        read_buffer(ec, is_contiguous_source<Src>());
+    }
+
+    // The source content is already in memory, parse it in place
+    void read_buffer(std::error_code& ec, std::true_type)
+    {
+        auto s = source_.read_buffer();
+        if (s.size() == 0)
+        {
+            eof_ = true;
+        }
+        else if (begin_)
+        {
+            auto result = unicons::skip_bom(s.begin(), s.end());
+            if (result.ec != unicons::encoding_errc())
+            {
+                ec = result.ec;
+                return;
+            }
+            std::size_t offset = result.it - s.begin();
+            parser_.update(s.data()+offset,s.size()-offset);
+            begin_ = false;
+        }
+        else
+        {
+            parser_.update(s.data(),s.size());
+        }
+    }
+
+    void read_buffer(std::error_code& ec, std::false_type)
     {
         buffer_.clear();
         buffer_.resize(buffer_length_);
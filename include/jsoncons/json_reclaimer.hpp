@@ -0,0 +1,177 @@
+// Copyright 2021 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_JSON_RECLAIMER_HPP
+#define JSONCONS_JSON_RECLAIMER_HPP
+
+#include <cstddef>
+#include <condition_variable>
+#include <deque>
+#include <memory> // std::unique_ptr
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility> // std::move
+#include <vector>
+#include <jsoncons/config/jsoncons_config.hpp>
+#include <jsoncons/basic_json.hpp>
+#include <jsoncons/arena_allocator.hpp>
+
+namespace jsoncons {
+
+    // json_reclaimer destroys values on background threads, so that dropping a large
+    // document does not stall the thread that owned it.
+
+    class json_reclaimer
+    {
+        struct item
+        {
+            virtual ~item() noexcept = default;
+        };
+
+        template <class T>
+        struct owned_item : public item
+        {
+            T value;
+
+            owned_item(T&& val)
+                : value(std::move(val))
+            {
+            }
+        };
+
+        template <class T,class Enable = void>
+        struct is_arena_json : std::false_type
+        {
+        };
+
+        template <class T>
+        struct is_arena_json<T,typename std::enable_if<is_basic_json<T>::value &&
+                                                       std::is_same<typename T::allocator_type,arena_allocator<char>>::value>::type>
+            : std::true_type
+        {
+        };
+
+        std::vector<std::thread> workers_;
+        std::deque<std::unique_ptr<item>> queue_;
+        std::mutex mutex_;
+        std::condition_variable ready_;
+        std::condition_variable idle_;
+        std::size_t busy_;
+        bool stopping_;
+
+        // Noncopyable and nonmoveable
+        json_reclaimer(const json_reclaimer&) = delete;
+        json_reclaimer& operator=(const json_reclaimer&) = delete;
+    public:
+        // The number of worker threads, at least one
+        explicit json_reclaimer(std::size_t thread_count = 1)
+            : busy_(0), stopping_(false)
+        {
+            if (thread_count == 0)
+            {
+                thread_count = 1;
+            }
+            workers_.reserve(thread_count);
+            for (std::size_t i = 0; i < thread_count; ++i)
+            {
+                workers_.emplace_back([this]() { run(); });
+            }
+        }
+
+        // Destroys the values still queued, then joins the worker threads
+        ~json_reclaimer() noexcept
+        {
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                stopping_ = true;
+            }
+            ready_.notify_all();
+            for (auto& worker : workers_)
+            {
+                worker.join();
+            }
+        }
+
+        // Takes ownership of val. A basic_json allocated from an arena is moved into
+        // its arena and never destroyed, its memory is freed in one step when the arena
+        // is released. Anything else is destroyed on a worker thread.
+        template <class T>
+        void reclaim(T&& val)
+        {
+            static_assert(!std::is_lvalue_reference<T>::value, "reclaim takes ownership of its argument, pass an rvalue");
+            reclaim(std::move(val), is_arena_json<T>());
+        }
+
+        // Blocks until all values passed to reclaim have been destroyed
+        void wait()
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            idle_.wait(lock, [this]() { return queue_.empty() && busy_ == 0; });
+        }
+
+        // The number of values that have not yet been destroyed
+        std::size_t pending()
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            return queue_.size() + busy_;
+        }
+
+    private:
+        template <class T>
+        void reclaim(T&& val, std::true_type)
+        {
+            arena* a = val.get_allocator().get_arena();
+            if (a != nullptr)
+            {
+                void* p = a->allocate(sizeof(T), alignof(T));
+                ::new(p) T(std::move(val));
+            }
+            else
+            {
+                reclaim(std::move(val), std::false_type());
+            }
+        }
+
+        template <class T>
+        void reclaim(T&& val, std::false_type)
+        {
+            std::unique_ptr<item> p(new owned_item<T>(std::move(val)));
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                queue_.push_back(std::move(p));
+            }
+            ready_.notify_one();
+        }
+
+        void run()
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            while (true)
+            {
+                ready_.wait(lock, [this]() { return stopping_ || !queue_.empty(); });
+                if (queue_.empty())
+                {
+                    return;
+                }
+                std::unique_ptr<item> p = std::move(queue_.front());
+                queue_.pop_front();
+                ++busy_;
+                lock.unlock();
+                p.reset();
+                lock.lock();
+                --busy_;
+                if (queue_.empty() && busy_ == 0)
+                {
+                    idle_.notify_all();
+                }
+            }
+        }
+    };
+
+} // namespace jsoncons
+
+#endif // JSONCONS_JSON_RECLAIMER_HPP
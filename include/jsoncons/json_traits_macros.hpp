@@ -13,10 +13,13 @@
 #include <jsoncons/detail/more_type_traits.hpp>
 #include <jsoncons/json_visitor.hpp>
 #include <limits> // std::numeric_limits
+#include <stdexcept> // std::invalid_argument
 #include <string>
 #include <type_traits> // std::enable_if
 #include <utility>
 #include <jsoncons/json_type_traits.hpp>
+#include <jsoncons/decode_traits.hpp>
+#include <jsoncons/encode_traits.hpp>
 
 namespace jsoncons
 {
@@ -91,6 +94,323 @@ namespace jsoncons
             j.try_emplace(key, val); 
         } 
     };
+
+    // Reads the members of an object from a staj cursor into a type declared
+    // with the json traits macros
+
+    template <class CharT>
+    struct json_traits_decode_helper
+    {
+        using string_view_type = basic_string_view<CharT>;
+
+        // Members usually arrive in the order they were declared, so the search
+        // starts at hint, one past the last member found
+        static std::size_t find_member(const string_view_type* names, std::size_t count,
+                                       const string_view_type& key, std::size_t hint)
+        {
+            for (std::size_t i = hint; i < count; ++i)
+            {
+                if (names[i] == key)
+                {
+                    return i;
+                }
+            }
+            for (std::size_t i = 0; i < hint && i < count; ++i)
+            {
+                if (names[i] == key)
+                {
+                    return i;
+                }
+            }
+            return count;
+        }
+
+        // Calls read_member with the position of each member in names. read_member
+        // returns false if it did not read the value, and then the value is skipped,
+        // as are the values of unknown members. The first num_mandatory members must
+        // be present. Returns false if the value cannot be converted, either because
+        // it is not an object, a mandatory member is missing, or read_member cleared 
+        // valid. The value is then still read to its end, as json_decoder would, so 
+        // that the caller can throw a convert_error and a staj_array_iterator can 
+        // go on to the next value. ec is only set for errors in the input.
+        template <std::size_t N,class Json,class TempAllocator,class ReadMember>
+        static bool read_object(basic_staj_cursor<CharT>& cursor, 
+                                json_decoder<Json,TempAllocator>& decoder,
+                                const string_view_type (&names)[N], 
+                                std::size_t num_mandatory,
+                                ReadMember read_member,
+                                std::error_code& ec)
+        {
+            if (cursor.current().event_type() != staj_event_type::begin_object)
+            {
+                decoder.reset();
+                cursor.read_to(decoder, ec);
+                return false;
+            }
+            bool valid = true;
+            bool found[N] = {};
+            std::size_t hint = 0;
+            cursor.next(ec);
+            while (!ec && cursor.current().event_type() != staj_event_type::end_object)
+            {
+                if (cursor.current().event_type() != staj_event_type::key)
+                {
+                    ec = json_errc::expected_key;
+                    return false;
+                }
+                std::size_t index = find_member(names, N, cursor.current().template get<string_view_type>(ec), hint);
+                if (ec) return false;
+                cursor.next(ec);
+                if (ec) return false;
+                if (index < N)
+                {
+                    found[index] = true;
+                    hint = index + 1;
+                    if (read_member(index, valid))
+                    {
+                        if (ec) return false;
+                        cursor.next(ec);
+                        continue;
+                    }
+                }
+                cursor.skip(ec);
+            }
+            if (ec) return false;
+            for (std::size_t i = 0; i < num_mandatory && i < N; ++i)
+            {
+                if (!found[i])
+                {
+                    return false;
+                }
+            }
+            return valid;
+        }
+
+        // Decodes a U, clearing valid if the value cannot be converted to one. The cursor 
+        // is then left at the end of the value if the value is a scalar, if U is read from
+        // a single event, or if U is a type declared with the traits macros, otherwise
+        // the error is passed on.
+        template <class U,class Json,class TempAllocator>
+        static U decode_member(basic_staj_cursor<CharT>& cursor, json_decoder<Json,TempAllocator>& decoder, 
+                               bool& valid, std::error_code& ec)
+        {
+            const staj_event_type event_type = cursor.current().event_type();
+            const bool scalar = event_type != staj_event_type::begin_object && event_type != staj_event_type::begin_array;
+            if (!scalar && (detail::is_primitive<U>::value || detail::is_basic_string<U>::value))
+            {
+                decoder.reset();
+                cursor.read_to(decoder, ec);
+                valid = false;
+                return U();
+            }
+            JSONCONS_TRY
+            {
+                U val = decode_traits<U,CharT>::decode(cursor, decoder, ec);
+                if (ec && scalar && ec.category() == convert_error_category())
+                {
+                    ec = std::error_code();
+                    valid = false;
+                }
+                return val;
+            }
+            JSONCONS_CATCH(const convert_error&)
+            {
+                if (!(scalar || json_traits_macro_decoder<U>::value))
+                {
+                    JSONCONS_RETHROW;
+                }
+                valid = false;
+                return U();
+            }
+            // A string that is not a number
+            JSONCONS_CATCH(const std::invalid_argument&)
+            {
+                if (!scalar)
+                {
+                    JSONCONS_RETHROW;
+                }
+                valid = false;
+                return U();
+            }
+        }
+
+        template <class Json,class TempAllocator,class U>
+        static bool read_member(basic_staj_cursor<CharT>& cursor, json_decoder<Json,TempAllocator>& decoder, 
+                                U& val, bool& valid, std::error_code& ec)
+        {
+            val = decode_member<U>(cursor, decoder, valid, ec);
+            return true;
+        }
+
+        template <class Json,class TempAllocator,class U>
+        static bool read_member(basic_staj_cursor<CharT>&, json_decoder<Json,TempAllocator>&, 
+                                const U&, bool&, std::error_code&)
+        {
+            return false;
+        }
+
+        // Reads a T, which must satisfy match, and assigns from(T) to val
+        template <class T,class Json,class TempAllocator,class Match,class From,class U>
+        static bool read_member_as(basic_staj_cursor<CharT>& cursor, json_decoder<Json,TempAllocator>& decoder, 
+                                   Match match, From from, U& val, bool& valid, std::error_code& ec)
+        {
+            bool converted = true;
+            T v = decode_member<T>(cursor, decoder, converted, ec);
+            if (ec) return true;
+            if (!converted || !match(v))
+            {
+                valid = false;
+                return true;
+            }
+            val = from(std::move(v));
+            return true;
+        }
+
+        template <class T,class Json,class TempAllocator,class Match,class From,class U>
+        static bool read_member_as(basic_staj_cursor<CharT>&, json_decoder<Json,TempAllocator>&, 
+                                   Match, From, const U&, bool&, std::error_code&)
+        {
+            return false;
+        }
+    };
+
+    // Writes the members of a type declared with the json traits macros to a 
+    // json visitor
+
+    template <class CharT>
+    struct json_traits_encode_helper
+    {
+        using string_view_type = basic_string_view<CharT>;
+        using string_type = std::basic_string<CharT>;
+
+        // The member names of a type, with their quoted JSON text, and the order
+        // in which the members are written. Built once per type.
+        template <std::size_t N>
+        struct member_table
+        {
+            const string_view_type* names;
+            string_type quoted_names[N];
+            std::size_t declared_order[N];
+            std::size_t declared_count;
+            std::size_t sorted_order[N];
+            std::size_t sorted_count;
+
+            member_table(const string_view_type (&member_names)[N])
+                : names(member_names), declared_count(0), sorted_count(0)
+            {
+                for (std::size_t i = 0; i < N; ++i)
+                {
+                    quoted_names[i] = quote_name(names[i]);
+                    sorted_order[i] = i;
+                }
+                // A name that appears more than once is written for its first member only
+                for (std::size_t i = 0; i < N; ++i)
+                {
+                    if (std::find(names, names + i, names[i]) == names + i)
+                    {
+                        declared_order[declared_count++] = i;
+                    }
+                }
+                std::stable_sort(sorted_order, sorted_order + N, 
+                                 [&](std::size_t a, std::size_t b) {return names[a].compare(names[b]) < 0;});
+                for (std::size_t i = 0; i < N; ++i)
+                {
+                    if (i == 0 || names[sorted_order[i]] != names[sorted_order[sorted_count-1]])
+                    {
+                        sorted_order[sorted_count++] = sorted_order[i];
+                    }
+                }
+            }
+        };
+
+        // name in quotes if there is nothing in it that an encoder could escape, 
+        // otherwise empty
+        static string_type quote_name(const string_view_type& name)
+        {
+            string_type s;
+            for (auto c : name)
+            {
+                if (c < 0x20 || c > 0x7e || c == '\"' || c == '\\' || c == '/')
+                {
+                    return string_type();
+                }
+            }
+            s.reserve(name.size() + 2);
+            s.push_back('\"');
+            s.append(name.data(), name.size());
+            s.push_back('\"');
+            return s;
+        }
+
+        // Writes the members in the order that Json keeps them, the members for 
+        // which present is false are left out. write_value writes the value of 
+        // the member at an index.
+        template <std::size_t N,class Json,class WriteValue>
+        static void write_object(basic_json_visitor<CharT>& encoder,
+                                 const member_table<N>& table, 
+                                 const bool (&present)[N],
+                                 const Json&,
+                                 WriteValue write_value,
+                                 std::error_code& ec)
+        {
+            const bool sorted = std::is_same<typename Json::implementation_policy::key_order,sort_key_order>::value;
+            const std::size_t* order = sorted ? table.sorted_order : table.declared_order;
+            const std::size_t count = sorted ? table.sorted_count : table.declared_count;
+
+            std::size_t length = 0;
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                if (present[order[i]])
+                {
+                    ++length;
+                }
+            }
+            encoder.begin_object(length, semantic_tag::none, ser_context(), ec);
+            if (ec) return;
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                std::size_t index = order[i];
+                if (!present[index])
+                {
+                    continue;
+                }
+                encoder.key(table.names[index], table.quoted_names[index], ser_context(), ec);
+                if (ec) return;
+                write_value(index);
+                if (ec) return;
+            }
+            encoder.end_object(ser_context(), ec);
+        }
+
+        template <class Json,class U>
+        static void write_value(const U& val, basic_json_visitor<CharT>& encoder, const Json& proto, std::error_code& ec)
+        {
+            encode_traits<U,CharT>::encode(val, encoder, proto, ec);
+        }
+
+        // Optional members are left out when they have no value
+
+        template <class U>
+        static bool has_value(const std::shared_ptr<U>& val)
+        {
+            return val ? true : false;
+        }
+        template <class U>
+        static bool has_value(const std::unique_ptr<U>& val)
+        {
+            return val ? true : false;
+        }
+        template <class U>
+        static bool has_value(const jsoncons::optional<U>& val)
+        {
+            return val.has_value();
+        }
+        template <class U>
+        static bool has_value(const U&)
+        {
+            return true;
+        }
+    };
 }
 
 #if defined(_MSC_VER)
@@ -165,10 +485,19 @@ namespace jsoncons
 
 #define JSONCONS_TYPE_TRAITS_FRIEND \
     template <class JSON,class T,class Enable> \
-    friend struct jsoncons::json_type_traits;
+    friend struct jsoncons::json_type_traits; \
+    template <class T,class Enable> \
+    friend struct jsoncons::json_traits_macro_decoder; \
+    template <class T,class Enable> \
+    friend struct jsoncons::json_traits_macro_encoder;
 
 #define JSONCONS_EXPAND_CALL2(Call, Expr, Id) JSONCONS_EXPAND(Call(Expr, Id))
 
+// Calls Call##N(Count, elements of Seq), where N is the number of elements in Seq
+#define JSONCONS_SEQ_ARGS(...) __VA_ARGS__
+#define JSONCONS_CALL_WITH_ARGS(Call, Args) Call Args
+#define JSONCONS_CALL_WITH_SEQ(Call, Count, Seq) JSONCONS_EXPAND(JSONCONS_CALL_WITH_ARGS(JSONCONS_CONCAT(Call,JSONCONS_NARGS Seq), (Count, JSONCONS_SEQ_ARGS Seq)))
+
 #define JSONCONS_REP_OF_N(Call, Expr, Pre, App, Count)  JSONCONS_REP_OF_ ## Count(Call, Expr, Pre, App)
 
 #define JSONCONS_REP_OF_50(Call, Expr, Pre, App)     Pre JSONCONS_EXPAND_CALL2(Call, Expr, 50) JSONCONS_REP_OF_49(Call, Expr, , App)
@@ -259,6 +588,111 @@ namespace jsoncons
 #define JSONCONS_ALL_TO_JSON_LAST(Prefix, P2, P3, Member, Count) \
     ajson.try_emplace(json_traits_macro_names<char_type,value_type>::Member##_str(char_type{}), aval.Member);
 
+#define JSONCONS_OBJECT_ENCODER(NameView, Value, NumTemplateParams, ValueType, NumMandatoryParams, ...) \
+    template <JSONCONS_GENERATE_TPL_PARAMS(JSONCONS_GENERATE_TPL_PARAM, NumTemplateParams)> \
+    struct json_traits_macro_encoder<ValueType JSONCONS_GENERATE_TPL_ARGS(JSONCONS_GENERATE_TPL_ARG, NumTemplateParams)> : public std::true_type \
+    { \
+        using value_type = ValueType JSONCONS_GENERATE_TPL_ARGS(JSONCONS_GENERATE_TPL_ARG, NumTemplateParams); \
+        constexpr static size_t num_params = JSONCONS_NARGS(__VA_ARGS__); \
+        constexpr static size_t num_mandatory_params = NumMandatoryParams; \
+        template <class CharT,class Json> \
+        static void encode(const value_type& aval, basic_json_visitor<CharT>& encoder, const Json& proto, std::error_code& ec) \
+        { \
+            using string_view_type = basic_string_view<CharT>; \
+            using helper = json_traits_encode_helper<CharT>; \
+            static const string_view_type names[] = {JSONCONS_VARIADIC_REP_N(NameView, ,,, __VA_ARGS__)}; \
+            static const typename helper::template member_table<num_params> table(names); \
+            const bool present[] = {JSONCONS_VARIADIC_REP_N(JSONCONS_ENCODER_PRESENT, Value,,, __VA_ARGS__)}; \
+            helper::write_object(encoder, table, present, proto, [&](std::size_t index) \
+            { \
+                switch (index) \
+                { \
+                    JSONCONS_VARIADIC_REP_N(JSONCONS_ENCODER_WRITE, Value,,, __VA_ARGS__) \
+                    default: break; \
+                } \
+            }, ec); \
+        } \
+    }; \
+  /**/
+
+#define JSONCONS_ENCODER_PRESENT(Value, P2, P3, Member, Count) JSONCONS_ENCODER_PRESENT_LAST(Value, P2, P3, Member, Count),
+#define JSONCONS_ENCODER_PRESENT_LAST(Value, P2, P3, Member, Count) (num_params-Count) < num_mandatory_params || helper::has_value(Value(Member))
+
+#define JSONCONS_ENCODER_WRITE(Value, P2, P3, Member, Count) JSONCONS_ENCODER_WRITE_LAST(Value, P2, P3, Member, Count)
+#define JSONCONS_ENCODER_WRITE_LAST(Value, P2, P3, Member, Count) case num_params-Count: helper::write_value(Value(Member), encoder, proto, ec); break;
+
+#define JSONCONS_MEMBER_VALUE(Member) aval.Member
+
+#define JSONCONS_MEMBER_DECODER(NameView, Read, NumTemplateParams, ValueType, NumMandatoryParams, ...) \
+    template <JSONCONS_GENERATE_TPL_PARAMS(JSONCONS_GENERATE_TPL_PARAM, NumTemplateParams)> \
+    struct json_traits_macro_decoder<ValueType JSONCONS_GENERATE_TPL_ARGS(JSONCONS_GENERATE_TPL_ARG, NumTemplateParams)> : public std::true_type \
+    { \
+        using value_type = ValueType JSONCONS_GENERATE_TPL_ARGS(JSONCONS_GENERATE_TPL_ARG, NumTemplateParams); \
+        constexpr static size_t num_params = JSONCONS_NARGS(__VA_ARGS__); \
+        constexpr static size_t num_mandatory_params = NumMandatoryParams; \
+        template <class CharT,class Json,class TempAllocator> \
+        static value_type decode(basic_staj_cursor<CharT>& cursor, json_decoder<Json,TempAllocator>& decoder, std::error_code& ec) \
+        { \
+            using string_view_type = basic_string_view<CharT>; \
+            using helper = json_traits_decode_helper<CharT>; \
+            static const string_view_type names[] = {JSONCONS_VARIADIC_REP_N(NameView, ,,, __VA_ARGS__)}; \
+            value_type aval{}; \
+            bool converted = helper::read_object(cursor, decoder, names, num_mandatory_params, [&](std::size_t index, bool& valid) -> bool \
+            { \
+                switch (index) \
+                { \
+                    JSONCONS_VARIADIC_REP_N(Read, ,,, __VA_ARGS__) \
+                    default: break; \
+                } \
+                return false; \
+            }, ec); \
+            if (!converted && !ec) \
+            { \
+                JSONCONS_THROW(convert_error(convert_errc::conversion_failed, "Not a " # ValueType)); \
+            } \
+            return aval; \
+        } \
+    }; \
+  /**/
+
+#define JSONCONS_CTOR_GETTER_DECODER(NameView, Var, Read, Arg, NumTemplateParams, ValueType, NumMandatoryParams, ...) \
+    template <JSONCONS_GENERATE_TPL_PARAMS(JSONCONS_GENERATE_TPL_PARAM, NumTemplateParams)> \
+    struct json_traits_macro_decoder<ValueType JSONCONS_GENERATE_TPL_ARGS(JSONCONS_GENERATE_TPL_ARG, NumTemplateParams)> : public std::true_type \
+    { \
+        using value_type = ValueType JSONCONS_GENERATE_TPL_ARGS(JSONCONS_GENERATE_TPL_ARG, NumTemplateParams); \
+        constexpr static size_t num_params = JSONCONS_NARGS(__VA_ARGS__); \
+        constexpr static size_t num_mandatory_params = NumMandatoryParams; \
+        template <class CharT,class Json,class TempAllocator> \
+        static value_type decode(basic_staj_cursor<CharT>& cursor, json_decoder<Json,TempAllocator>& decoder, std::error_code& ec) \
+        { \
+            using string_view_type = basic_string_view<CharT>; \
+            using helper = json_traits_decode_helper<CharT>; \
+            static const string_view_type names[] = {JSONCONS_VARIADIC_REP_N(NameView, ,,, __VA_ARGS__)}; \
+            JSONCONS_VARIADIC_REP_N(Var, ,,, __VA_ARGS__) \
+            bool converted = helper::read_object(cursor, decoder, names, num_mandatory_params, [&](std::size_t index, bool& valid) -> bool \
+            { \
+                switch (index) \
+                { \
+                    JSONCONS_VARIADIC_REP_N(Read, ,,, __VA_ARGS__) \
+                    default: break; \
+                } \
+                return false; \
+            }, ec); \
+            if (!converted && !ec) \
+            { \
+                JSONCONS_THROW(convert_error(convert_errc::conversion_failed, "Not a " # ValueType)); \
+            } \
+            return value_type ( JSONCONS_VARIADIC_REP_N(Arg, ,,, __VA_ARGS__) ); \
+        } \
+    }; \
+  /**/
+
+#define JSONCONS_MEMBER_NAME_VIEW(Prefix, P2, P3, Member, Count) JSONCONS_MEMBER_NAME_VIEW_LAST(Prefix, P2, P3, Member, Count),
+#define JSONCONS_MEMBER_NAME_VIEW_LAST(Prefix, P2, P3, Member, Count) string_view_type(json_traits_macro_names<CharT,value_type>::Member##_str(CharT{}))
+
+#define JSONCONS_MEMBER_READ(Prefix, P2, P3, Member, Count) JSONCONS_MEMBER_READ_LAST(Prefix, P2, P3, Member, Count)
+#define JSONCONS_MEMBER_READ_LAST(Prefix, P2, P3, Member, Count) case num_params-Count: return helper::read_member(cursor, decoder, aval.Member, valid, ec);
+
 #define JSONCONS_MEMBER_TRAITS_BASE(AsT,ToJ,NumTemplateParams,ValueType,NumMandatoryParams1,NumMandatoryParams2, ...)  \
 namespace jsoncons \
 { \
@@ -297,6 +731,8 @@ namespace jsoncons \
             return ajson; \
         } \
     }; \
+    JSONCONS_MEMBER_DECODER(JSONCONS_MEMBER_NAME_VIEW, JSONCONS_MEMBER_READ, NumTemplateParams, ValueType, NumMandatoryParams1, __VA_ARGS__) \
+    JSONCONS_OBJECT_ENCODER(JSONCONS_MEMBER_NAME_VIEW, JSONCONS_MEMBER_VALUE, NumTemplateParams, ValueType, NumMandatoryParams2, __VA_ARGS__) \
 } \
   /**/
 
@@ -376,6 +812,30 @@ else \
 #define JSONCONS_ALL_MEMBER_NAME_TO_JSON_5(Member, Name, Mode, Match, Into) JSONCONS_ALL_MEMBER_NAME_TO_JSON_6(Member, Name, Mode, Match, Into, )
 #define JSONCONS_ALL_MEMBER_NAME_TO_JSON_6(Member, Name, Mode, Match, Into, From) ajson.try_emplace(Name, Into(aval.Member));
 
+#define JSONCONS_NAME_VIEW(P1, P2, P3, Seq, Count) JSONCONS_NAME_VIEW_LAST(P1, P2, P3, Seq, Count),
+#define JSONCONS_NAME_VIEW_LAST(P1, P2, P3, Seq, Count) string_view_type(JSONCONS_EXPAND(JSONCONS_CONCAT(JSONCONS_NAME_VIEW_,JSONCONS_NARGS Seq) Seq))
+#define JSONCONS_NAME_VIEW_2(Member, Name) Name
+#define JSONCONS_NAME_VIEW_3(Member, Name, Mode) Name
+#define JSONCONS_NAME_VIEW_4(Member, Name, Mode, Match) Name
+#define JSONCONS_NAME_VIEW_5(Member, Name, Mode, Match, Into) Name
+#define JSONCONS_NAME_VIEW_6(Member, Name, Mode, Match, Into, From) Name
+
+#define JSONCONS_MEMBER_NAME_VALUE(Seq) JSONCONS_EXPAND(JSONCONS_CONCAT(JSONCONS_MEMBER_NAME_VALUE_,JSONCONS_NARGS Seq) Seq)
+#define JSONCONS_MEMBER_NAME_VALUE_2(Member, Name) aval.Member
+#define JSONCONS_MEMBER_NAME_VALUE_3(Member, Name, Mode) aval.Member
+#define JSONCONS_MEMBER_NAME_VALUE_4(Member, Name, Mode, Match) aval.Member
+#define JSONCONS_MEMBER_NAME_VALUE_5(Member, Name, Mode, Match, Into) Into(aval.Member)
+#define JSONCONS_MEMBER_NAME_VALUE_6(Member, Name, Mode, Match, Into, From) Into(aval.Member)
+
+#define JSONCONS_MEMBER_NAME_READ(P1, P2, P3, Seq, Count) JSONCONS_MEMBER_NAME_READ_LAST(P1, P2, P3, Seq, Count)
+#define JSONCONS_MEMBER_NAME_READ_LAST(P1, P2, P3, Seq, Count) case num_params-Count: JSONCONS_EXPAND(JSONCONS_CONCAT(JSONCONS_MEMBER_NAME_READ_,JSONCONS_NARGS Seq) Seq) break;
+#define JSONCONS_MEMBER_NAME_READ_2(Member, Name) return helper::read_member(cursor, decoder, aval.Member, valid, ec);
+#define JSONCONS_MEMBER_NAME_READ_3(Member, Name, Mode) Mode(JSONCONS_MEMBER_NAME_READ_2(Member, Name))
+#define JSONCONS_MEMBER_NAME_READ_4(Member, Name, Mode, Match) JSONCONS_MEMBER_NAME_READ_6(Member, Name, Mode, Match, , identity())
+#define JSONCONS_MEMBER_NAME_READ_5(Member, Name, Mode, Match, Into) JSONCONS_MEMBER_NAME_READ_6(Member, Name, Mode, Match, Into, identity())
+#define JSONCONS_MEMBER_NAME_READ_6(Member, Name, Mode, Match, Into, From) \
+    Mode(return helper::template read_member_as<typename std::decay<decltype(Into(((value_type*)nullptr)->Member))>::type>(cursor, decoder, Match, From, aval.Member, valid, ec);)
+
 #define JSONCONS_MEMBER_NAME_TRAITS_BASE(AsT,ToJ, NumTemplateParams, ValueType,NumMandatoryParams1,NumMandatoryParams2, ...)  \
 namespace jsoncons \
 { \
@@ -409,6 +869,8 @@ namespace jsoncons \
             return ajson; \
         } \
     }; \
+    JSONCONS_MEMBER_DECODER(JSONCONS_NAME_VIEW, JSONCONS_MEMBER_NAME_READ, NumTemplateParams, ValueType, NumMandatoryParams1, __VA_ARGS__) \
+    JSONCONS_OBJECT_ENCODER(JSONCONS_NAME_VIEW, JSONCONS_MEMBER_NAME_VALUE, NumTemplateParams, ValueType, NumMandatoryParams2, __VA_ARGS__) \
 } \
   /**/
 
@@ -449,6 +911,17 @@ else { \
   json_traits_helper<Json>::set_optional_json_member(json_traits_macro_names<char_type,value_type>::Getter##_str(char_type{}), aval.Getter(), ajson); \
 }
 
+#define JSONCONS_CTOR_GETTER_VALUE(Getter) aval.Getter()
+
+#define JSONCONS_CTOR_GETTER_VAR(Prefix, P2, P3, Getter, Count) JSONCONS_CTOR_GETTER_VAR_LAST(Prefix, P2, P3, Getter, Count)
+#define JSONCONS_CTOR_GETTER_VAR_LAST(Prefix, P2, P3, Getter, Count) typename std::decay<decltype(((value_type*)nullptr)->Getter())>::type JSONCONS_CONCAT(aval,Count){};
+
+#define JSONCONS_CTOR_GETTER_READ(Prefix, P2, P3, Getter, Count) JSONCONS_CTOR_GETTER_READ_LAST(Prefix, P2, P3, Getter, Count)
+#define JSONCONS_CTOR_GETTER_READ_LAST(Prefix, P2, P3, Getter, Count) case num_params-Count: return helper::read_member(cursor, decoder, JSONCONS_CONCAT(aval,Count), valid, ec);
+
+#define JSONCONS_CTOR_GETTER_ARG(Prefix, P2, P3, Getter, Count) JSONCONS_CTOR_GETTER_ARG_LAST(Prefix, P2, P3, Getter, Count),
+#define JSONCONS_CTOR_GETTER_ARG_LAST(Prefix, P2, P3, Getter, Count) std::move(JSONCONS_CONCAT(aval,Count))
+
 #define JSONCONS_CTOR_GETTER_TRAITS_BASE(NumTemplateParams, ValueType,NumMandatoryParams1,NumMandatoryParams2, ...)  \
 namespace jsoncons \
 { \
@@ -485,6 +958,8 @@ namespace jsoncons \
             return ajson; \
         } \
     }; \
+    JSONCONS_CTOR_GETTER_DECODER(JSONCONS_MEMBER_NAME_VIEW, JSONCONS_CTOR_GETTER_VAR, JSONCONS_CTOR_GETTER_READ, JSONCONS_CTOR_GETTER_ARG, NumTemplateParams, ValueType, NumMandatoryParams1, __VA_ARGS__) \
+    JSONCONS_OBJECT_ENCODER(JSONCONS_MEMBER_NAME_VIEW, JSONCONS_CTOR_GETTER_VALUE, NumTemplateParams, ValueType, NumMandatoryParams2, __VA_ARGS__) \
 } \
   /**/
  
@@ -553,6 +1028,44 @@ else { \
   json_traits_helper<Json>::set_optional_json_member(Name, Into(aval.Getter()), ajson); \
 }
 
+#define JSONCONS_CTOR_GETTER_NAME_VALUE(Seq) JSONCONS_EXPAND(JSONCONS_CONCAT(JSONCONS_CTOR_GETTER_NAME_VALUE_,JSONCONS_NARGS Seq) Seq)
+#define JSONCONS_CTOR_GETTER_NAME_VALUE_2(Getter, Name) aval.Getter()
+#define JSONCONS_CTOR_GETTER_NAME_VALUE_3(Getter, Name, Mode) aval.Getter()
+#define JSONCONS_CTOR_GETTER_NAME_VALUE_4(Getter, Name, Mode, Match) aval.Getter()
+#define JSONCONS_CTOR_GETTER_NAME_VALUE_5(Getter, Name, Mode, Match, Into) Into(aval.Getter())
+#define JSONCONS_CTOR_GETTER_NAME_VALUE_6(Getter, Name, Mode, Match, Into, From) Into(aval.Getter())
+
+#define JSONCONS_CTOR_GETTER_NAME_VAR(P1, P2, P3, Seq, Count) JSONCONS_CTOR_GETTER_NAME_VAR_LAST(P1, P2, P3, Seq, Count)
+#define JSONCONS_CTOR_GETTER_NAME_VAR_LAST(P1, P2, P3, Seq, Count) JSONCONS_CALL_WITH_SEQ(JSONCONS_CTOR_GETTER_NAME_VAR_, Count, Seq)
+#define JSONCONS_CTOR_GETTER_NAME_VAR_2(Count, Getter, Name) JSONCONS_CTOR_GETTER_NAME_VAR_6(Count, Getter, Name, , , , )
+#define JSONCONS_CTOR_GETTER_NAME_VAR_3(Count, Getter, Name, Mode) JSONCONS_CTOR_GETTER_NAME_VAR_6(Count, Getter, Name, Mode, , , )
+#define JSONCONS_CTOR_GETTER_NAME_VAR_4(Count, Getter, Name, Mode, Match) JSONCONS_CTOR_GETTER_NAME_VAR_6(Count, Getter, Name, Mode, Match, , )
+#define JSONCONS_CTOR_GETTER_NAME_VAR_5(Count, Getter, Name, Mode, Match, Into) JSONCONS_CTOR_GETTER_NAME_VAR_6(Count, Getter, Name, Mode, Match, Into, )
+#define JSONCONS_CTOR_GETTER_NAME_VAR_6(Count, Getter, Name, Mode, Match, Into, From) typename std::decay<decltype(((value_type*)nullptr)->Getter())>::type JSONCONS_CONCAT(aval,Count){};
+
+#define JSONCONS_CTOR_GETTER_NAME_READ(P1, P2, P3, Seq, Count) JSONCONS_CTOR_GETTER_NAME_READ_LAST(P1, P2, P3, Seq, Count)
+#define JSONCONS_CTOR_GETTER_NAME_READ_LAST(P1, P2, P3, Seq, Count) case num_params-Count: JSONCONS_CALL_WITH_SEQ(JSONCONS_CTOR_GETTER_NAME_READ_, Count, Seq) break;
+#define JSONCONS_CTOR_GETTER_NAME_READ_2(Count, Getter, Name) return helper::read_member(cursor, decoder, JSONCONS_CONCAT(aval,Count), valid, ec);
+#define JSONCONS_CTOR_GETTER_NAME_READ_3(Count, Getter, Name, Mode) Mode(JSONCONS_CTOR_GETTER_NAME_READ_2(Count, Getter, Name))
+#define JSONCONS_CTOR_GETTER_NAME_READ_4(Count, Getter, Name, Mode, Match) JSONCONS_CTOR_GETTER_NAME_READ_6(Count, Getter, Name, Mode, Match, , identity())
+#define JSONCONS_CTOR_GETTER_NAME_READ_5(Count, Getter, Name, Mode, Match, Into) JSONCONS_CTOR_GETTER_NAME_READ_6(Count, Getter, Name, Mode, Match, Into, identity())
+#define JSONCONS_CTOR_GETTER_NAME_READ_6(Count, Getter, Name, Mode, Match, Into, From) \
+    Mode(return helper::template read_member_as<typename std::decay<decltype(Into(((value_type*)nullptr)->Getter()))>::type>(cursor, decoder, Match, From, JSONCONS_CONCAT(aval,Count), valid, ec);)
+
+#define JSONCONS_CTOR_GETTER_NAME_ARG(P1, P2, P3, Seq, Count) JSONCONS_CALL_WITH_SEQ(JSONCONS_CTOR_GETTER_NAME_ARG_, Count, Seq)
+#define JSONCONS_CTOR_GETTER_NAME_ARG_2(Count, Getter, Name) JSONCONS_CTOR_GETTER_NAME_ARG_LAST_2(Count, Getter, Name) JSONCONS_COMMA
+#define JSONCONS_CTOR_GETTER_NAME_ARG_3(Count, Getter, Name, Mode) Mode(JSONCONS_CTOR_GETTER_NAME_ARG_LAST_2(Count, Getter, Name)) Mode(JSONCONS_COMMA)
+#define JSONCONS_CTOR_GETTER_NAME_ARG_4(Count, Getter, Name, Mode, Match) JSONCONS_CTOR_GETTER_NAME_ARG_6(Count, Getter, Name, Mode, Match,,)
+#define JSONCONS_CTOR_GETTER_NAME_ARG_5(Count, Getter, Name, Mode, Match, Into) JSONCONS_CTOR_GETTER_NAME_ARG_6(Count, Getter, Name, Mode, Match, Into, )
+#define JSONCONS_CTOR_GETTER_NAME_ARG_6(Count, Getter, Name, Mode, Match, Into, From) JSONCONS_CTOR_GETTER_NAME_ARG_LAST_6(Count, Getter, Name, Mode, Match, Into, From) Mode(JSONCONS_COMMA)
+
+#define JSONCONS_CTOR_GETTER_NAME_ARG_LAST(P1, P2, P3, Seq, Count) JSONCONS_CALL_WITH_SEQ(JSONCONS_CTOR_GETTER_NAME_ARG_LAST_, Count, Seq)
+#define JSONCONS_CTOR_GETTER_NAME_ARG_LAST_2(Count, Getter, Name) std::move(JSONCONS_CONCAT(aval,Count))
+#define JSONCONS_CTOR_GETTER_NAME_ARG_LAST_3(Count, Getter, Name, Mode) Mode(JSONCONS_CTOR_GETTER_NAME_ARG_LAST_2(Count, Getter, Name))
+#define JSONCONS_CTOR_GETTER_NAME_ARG_LAST_4(Count, Getter, Name, Mode, Match) JSONCONS_CTOR_GETTER_NAME_ARG_LAST_6(Count, Getter, Name, Mode, Match,,)
+#define JSONCONS_CTOR_GETTER_NAME_ARG_LAST_5(Count, Getter, Name, Mode, Match, Into) JSONCONS_CTOR_GETTER_NAME_ARG_LAST_6(Count, Getter, Name, Mode, Match, Into, )
+#define JSONCONS_CTOR_GETTER_NAME_ARG_LAST_6(Count, Getter, Name, Mode, Match, Into, From) Mode(std::move(JSONCONS_CONCAT(aval,Count)))
+
 #define JSONCONS_CTOR_GETTER_NAME_TRAITS_BASE(NumTemplateParams, ValueType,NumMandatoryParams1,NumMandatoryParams2, ...)  \
 namespace jsoncons \
 { \
@@ -584,6 +1097,8 @@ namespace jsoncons \
             return ajson; \
         } \
     }; \
+    JSONCONS_CTOR_GETTER_DECODER(JSONCONS_NAME_VIEW, JSONCONS_CTOR_GETTER_NAME_VAR, JSONCONS_CTOR_GETTER_NAME_READ, JSONCONS_CTOR_GETTER_NAME_ARG, NumTemplateParams, ValueType, NumMandatoryParams1, __VA_ARGS__) \
+    JSONCONS_OBJECT_ENCODER(JSONCONS_NAME_VIEW, JSONCONS_CTOR_GETTER_NAME_VALUE, NumTemplateParams, ValueType, NumMandatoryParams2, __VA_ARGS__) \
 } \
   /**/
                                                                        
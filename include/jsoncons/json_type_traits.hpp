@@ -42,6 +42,20 @@ namespace jsoncons {
     struct is_json_type_traits_declared : public std::false_type
     {};
 
+    // Specialized by the json traits macros with a decode function that reads 
+    // a value straight from a staj cursor, without building a basic_json first
+
+    template <class T, class Enable=void>
+    struct json_traits_macro_decoder : public std::false_type
+    {};
+
+    // Specialized by the json traits macros with an encode function that writes 
+    // a value straight to a json visitor, without building a basic_json first
+
+    template <class T, class Enable=void>
+    struct json_traits_macro_encoder : public std::false_type
+    {};
+
     #if !defined(JSONCONS_NO_DEPRECATED)
     template <class T>
     using is_json_type_traits_impl = is_json_type_traits_declared<T>;
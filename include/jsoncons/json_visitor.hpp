@@ -18,6 +18,10 @@
 
 namespace jsoncons {
 
+    namespace detail {
+        struct json_visitor_access;
+    } // namespace detail
+
     template <class CharT>
     class basic_json_visitor
     {
@@ -283,6 +287,14 @@ namespace jsoncons {
             return visit_key(name, context, ec);
         }
 
+        // quoted_name is name as it appears in JSON text, in quotes and with nothing 
+        // left to escape, or empty. JSON encoders may write it as is.
+        bool key(const string_view_type& name, const string_view_type& quoted_name, 
+                 const ser_context& context, std::error_code& ec)
+        {
+            return visit_key(name, quoted_name, context, ec);
+        }
+
         bool null_value(semantic_tag tag,
                         const ser_context& context,
                         std::error_code& ec) 
@@ -652,6 +664,14 @@ namespace jsoncons {
                              const ser_context& context, 
                              std::error_code&) = 0;
 
+        virtual bool visit_key(const string_view_type& name, 
+                               const string_view_type& /*quoted_name*/, 
+                               const ser_context& context, 
+                               std::error_code& ec)
+        {
+            return visit_key(name, context, ec);
+        }
+
         virtual bool visit_null(semantic_tag tag, 
                              const ser_context& context, 
                              std::error_code& ec) = 0;
@@ -921,6 +941,245 @@ namespace jsoncons {
         }
     };
 
+    namespace detail {
+
+    // Calls the visit_ functions of a visitor of static type Visitor. When Visitor is a final 
+    // class, such as json_decoder or one of the encoders, the calls are resolved at compile time.
+    // Visitors must declare json_visitor_access a friend for this, others are called through 
+    // the public basic_json_visitor functions.
+    struct json_visitor_access
+    {
+        template <class Visitor>
+        static void flush(Visitor& visitor)
+        {
+            flush_(visitor, 0);
+        }
+
+        template <class Visitor>
+        static bool begin_object(Visitor& visitor, semantic_tag tag, const ser_context& context, std::error_code& ec)
+        {
+            return begin_object_(visitor, tag, context, ec, 0);
+        }
+
+        template <class Visitor>
+        static bool end_object(Visitor& visitor, const ser_context& context, std::error_code& ec)
+        {
+            return end_object_(visitor, context, ec, 0);
+        }
+
+        template <class Visitor>
+        static bool begin_array(Visitor& visitor, semantic_tag tag, const ser_context& context, std::error_code& ec)
+        {
+            return begin_array_(visitor, tag, context, ec, 0);
+        }
+
+        template <class Visitor>
+        static bool end_array(Visitor& visitor, const ser_context& context, std::error_code& ec)
+        {
+            return end_array_(visitor, context, ec, 0);
+        }
+
+        template <class Visitor, class StringView>
+        static bool key(Visitor& visitor, const StringView& name, const ser_context& context, std::error_code& ec)
+        {
+            return key_(visitor, name, context, ec, 0);
+        }
+
+        template <class Visitor>
+        static bool null_value(Visitor& visitor, semantic_tag tag, const ser_context& context, std::error_code& ec)
+        {
+            return null_value_(visitor, tag, context, ec, 0);
+        }
+
+        template <class Visitor>
+        static bool bool_value(Visitor& visitor, bool value, semantic_tag tag, const ser_context& context, std::error_code& ec)
+        {
+            return bool_value_(visitor, value, tag, context, ec, 0);
+        }
+
+        template <class Visitor, class StringView>
+        static bool string_value(Visitor& visitor, const StringView& value, semantic_tag tag, const ser_context& context, std::error_code& ec)
+        {
+            return string_value_(visitor, value, tag, context, ec, 0);
+        }
+
+        template <class Visitor>
+        static bool int64_value(Visitor& visitor, int64_t value, semantic_tag tag, const ser_context& context, std::error_code& ec)
+        {
+            return int64_value_(visitor, value, tag, context, ec, 0);
+        }
+
+        template <class Visitor>
+        static bool uint64_value(Visitor& visitor, uint64_t value, semantic_tag tag, const ser_context& context, std::error_code& ec)
+        {
+            return uint64_value_(visitor, value, tag, context, ec, 0);
+        }
+
+        template <class Visitor>
+        static bool double_value(Visitor& visitor, double value, semantic_tag tag, const ser_context& context, std::error_code& ec)
+        {
+            return double_value_(visitor, value, tag, context, ec, 0);
+        }
+    private:
+        template <class Visitor>
+        static auto flush_(Visitor& visitor, int)
+            -> decltype(visitor.visit_flush())
+        {
+            visitor.visit_flush();
+        }
+
+        template <class Visitor>
+        static void flush_(Visitor& visitor, long)
+        {
+            visitor.flush();
+        }
+
+        template <class Visitor>
+        static auto begin_object_(Visitor& visitor, semantic_tag tag, const ser_context& context, std::error_code& ec, int)
+            -> decltype(visitor.visit_begin_object(tag, context, ec))
+        {
+            return visitor.visit_begin_object(tag, context, ec);
+        }
+
+        template <class Visitor>
+        static bool begin_object_(Visitor& visitor, semantic_tag tag, const ser_context& context, std::error_code& ec, long)
+        {
+            return visitor.begin_object(tag, context, ec);
+        }
+
+        template <class Visitor>
+        static auto end_object_(Visitor& visitor, const ser_context& context, std::error_code& ec, int)
+            -> decltype(visitor.visit_end_object(context, ec))
+        {
+            return visitor.visit_end_object(context, ec);
+        }
+
+        template <class Visitor>
+        static bool end_object_(Visitor& visitor, const ser_context& context, std::error_code& ec, long)
+        {
+            return visitor.end_object(context, ec);
+        }
+
+        template <class Visitor>
+        static auto begin_array_(Visitor& visitor, semantic_tag tag, const ser_context& context, std::error_code& ec, int)
+            -> decltype(visitor.visit_begin_array(tag, context, ec))
+        {
+            return visitor.visit_begin_array(tag, context, ec);
+        }
+
+        template <class Visitor>
+        static bool begin_array_(Visitor& visitor, semantic_tag tag, const ser_context& context, std::error_code& ec, long)
+        {
+            return visitor.begin_array(tag, context, ec);
+        }
+
+        template <class Visitor>
+        static auto end_array_(Visitor& visitor, const ser_context& context, std::error_code& ec, int)
+            -> decltype(visitor.visit_end_array(context, ec))
+        {
+            return visitor.visit_end_array(context, ec);
+        }
+
+        template <class Visitor>
+        static bool end_array_(Visitor& visitor, const ser_context& context, std::error_code& ec, long)
+        {
+            return visitor.end_array(context, ec);
+        }
+
+        template <class Visitor, class StringView>
+        static auto key_(Visitor& visitor, const StringView& name, const ser_context& context, std::error_code& ec, int)
+            -> decltype(visitor.visit_key(name, context, ec))
+        {
+            return visitor.visit_key(name, context, ec);
+        }
+
+        template <class Visitor, class StringView>
+        static bool key_(Visitor& visitor, const StringView& name, const ser_context& context, std::error_code& ec, long)
+        {
+            return visitor.key(name, context, ec);
+        }
+
+        template <class Visitor>
+        static auto null_value_(Visitor& visitor, semantic_tag tag, const ser_context& context, std::error_code& ec, int)
+            -> decltype(visitor.visit_null(tag, context, ec))
+        {
+            return visitor.visit_null(tag, context, ec);
+        }
+
+        template <class Visitor>
+        static bool null_value_(Visitor& visitor, semantic_tag tag, const ser_context& context, std::error_code& ec, long)
+        {
+            return visitor.null_value(tag, context, ec);
+        }
+
+        template <class Visitor>
+        static auto bool_value_(Visitor& visitor, bool value, semantic_tag tag, const ser_context& context, std::error_code& ec, int)
+            -> decltype(visitor.visit_bool(value, tag, context, ec))
+        {
+            return visitor.visit_bool(value, tag, context, ec);
+        }
+
+        template <class Visitor>
+        static bool bool_value_(Visitor& visitor, bool value, semantic_tag tag, const ser_context& context, std::error_code& ec, long)
+        {
+            return visitor.bool_value(value, tag, context, ec);
+        }
+
+        template <class Visitor, class StringView>
+        static auto string_value_(Visitor& visitor, const StringView& value, semantic_tag tag, const ser_context& context, std::error_code& ec, int)
+            -> decltype(visitor.visit_string(value, tag, context, ec))
+        {
+            return visitor.visit_string(value, tag, context, ec);
+        }
+
+        template <class Visitor, class StringView>
+        static bool string_value_(Visitor& visitor, const StringView& value, semantic_tag tag, const ser_context& context, std::error_code& ec, long)
+        {
+            return visitor.string_value(value, tag, context, ec);
+        }
+
+        template <class Visitor>
+        static auto int64_value_(Visitor& visitor, int64_t value, semantic_tag tag, const ser_context& context, std::error_code& ec, int)
+            -> decltype(visitor.visit_int64(value, tag, context, ec))
+        {
+            return visitor.visit_int64(value, tag, context, ec);
+        }
+
+        template <class Visitor>
+        static bool int64_value_(Visitor& visitor, int64_t value, semantic_tag tag, const ser_context& context, std::error_code& ec, long)
+        {
+            return visitor.int64_value(value, tag, context, ec);
+        }
+
+        template <class Visitor>
+        static auto uint64_value_(Visitor& visitor, uint64_t value, semantic_tag tag, const ser_context& context, std::error_code& ec, int)
+            -> decltype(visitor.visit_uint64(value, tag, context, ec))
+        {
+            return visitor.visit_uint64(value, tag, context, ec);
+        }
+
+        template <class Visitor>
+        static bool uint64_value_(Visitor& visitor, uint64_t value, semantic_tag tag, const ser_context& context, std::error_code& ec, long)
+        {
+            return visitor.uint64_value(value, tag, context, ec);
+        }
+
+        template <class Visitor>
+        static auto double_value_(Visitor& visitor, double value, semantic_tag tag, const ser_context& context, std::error_code& ec, int)
+            -> decltype(visitor.visit_double(value, tag, context, ec))
+        {
+            return visitor.visit_double(value, tag, context, ec);
+        }
+
+        template <class Visitor>
+        static bool double_value_(Visitor& visitor, double value, semantic_tag tag, const ser_context& context, std::error_code& ec, long)
+        {
+            return visitor.double_value(value, tag, context, ec);
+        }
+    };
+
+    } // namespace detail
+
     template <class CharT>
     class basic_default_json_visitor : public basic_json_visitor<CharT>
     {
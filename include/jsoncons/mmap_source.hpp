@@ -0,0 +1,491 @@
+// Copyright 2021 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_MMAP_SOURCE_HPP
+#define JSONCONS_MMAP_SOURCE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring> // std::memcpy
+#include <string>
+#include <system_error>
+#include <utility> // std::swap
+#include <jsoncons/config/jsoncons_config.hpp>
+#include <jsoncons/source.hpp>
+#include <jsoncons/detail/span.hpp>
+
+#if defined(_WIN32)
+#  define JSONCONS_HAS_MMAP 1
+// Keep windows.h from defining the min and max macros, and from pulling in
+// headers we do not use, without changing what the user has set.
+#  if !defined(NOMINMAX)
+#    define NOMINMAX
+#    define JSONCONS_UNDEF_NOMINMAX
+#  endif
+#  if !defined(WIN32_LEAN_AND_MEAN)
+#    define WIN32_LEAN_AND_MEAN
+#    define JSONCONS_UNDEF_WIN32_LEAN_AND_MEAN
+#  endif
+#  include <windows.h>
+#  if defined(JSONCONS_UNDEF_NOMINMAX)
+#    undef NOMINMAX
+#    undef JSONCONS_UNDEF_NOMINMAX
+#  endif
+#  if defined(JSONCONS_UNDEF_WIN32_LEAN_AND_MEAN)
+#    undef WIN32_LEAN_AND_MEAN
+#    undef JSONCONS_UNDEF_WIN32_LEAN_AND_MEAN
+#  endif
+#elif defined(__unix__) || defined(__APPLE__)
+#  define JSONCONS_HAS_MMAP 1
+#  include <fcntl.h>
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#  include <unistd.h>
+#  include <cerrno>
+#endif
+
+#if defined(JSONCONS_HAS_MMAP)
+
+namespace jsoncons {
+namespace detail {
+
+    // Read-only mapping of a whole file, noncopyable, moveable
+
+    class mapped_file
+    {
+        const uint8_t* data_;
+        std::size_t size_;
+        std::error_code ec_;
+    #if defined(_WIN32)
+        HANDLE file_;
+        HANDLE mapping_;
+    #endif
+
+        // Noncopyable
+        mapped_file(const mapped_file&) = delete;
+        mapped_file& operator=(const mapped_file&) = delete;
+    public:
+        mapped_file() noexcept
+            : data_(nullptr), size_(0)
+    #if defined(_WIN32)
+              , file_(INVALID_HANDLE_VALUE), mapping_(nullptr)
+    #endif
+        {
+        }
+
+        explicit mapped_file(const std::string& path) noexcept
+            : mapped_file()
+        {
+            open(path);
+        }
+
+        mapped_file(mapped_file&& other) noexcept
+            : mapped_file()
+        {
+            swap(other);
+        }
+
+        ~mapped_file() noexcept
+        {
+            close();
+        }
+
+        mapped_file& operator=(mapped_file&& other) noexcept
+        {
+            swap(other);
+            return *this;
+        }
+
+        const uint8_t* data() const noexcept
+        {
+            return data_;
+        }
+
+        std::size_t size() const noexcept
+        {
+            return size_;
+        }
+
+        const std::error_code& error_code() const noexcept
+        {
+            return ec_;
+        }
+
+        void swap(mapped_file& other) noexcept
+        {
+            std::swap(data_, other.data_);
+            std::swap(size_, other.size_);
+            std::swap(ec_, other.ec_);
+    #if defined(_WIN32)
+            std::swap(file_, other.file_);
+            std::swap(mapping_, other.mapping_);
+    #endif
+        }
+
+    private:
+    #if defined(_WIN32)
+        void open(const std::string& path) noexcept
+        {
+            file_ = ::CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                  FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+            if (file_ == INVALID_HANDLE_VALUE)
+            {
+                ec_ = std::error_code(static_cast<int>(::GetLastError()), std::system_category());
+                return;
+            }
+            LARGE_INTEGER file_size;
+            if (!::GetFileSizeEx(file_, &file_size))
+            {
+                ec_ = std::error_code(static_cast<int>(::GetLastError()), std::system_category());
+                return;
+            }
+            size_ = static_cast<std::size_t>(file_size.QuadPart);
+            if (size_ == 0)
+            {
+                return; // an empty file cannot be mapped
+            }
+            mapping_ = ::CreateFileMappingA(file_, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            if (mapping_ == nullptr)
+            {
+                ec_ = std::error_code(static_cast<int>(::GetLastError()), std::system_category());
+                size_ = 0;
+                return;
+            }
+            data_ = static_cast<const uint8_t*>(::MapViewOfFile(mapping_, FILE_MAP_READ, 0, 0, 0));
+            if (data_ == nullptr)
+            {
+                ec_ = std::error_code(static_cast<int>(::GetLastError()), std::system_category());
+                size_ = 0;
+            }
+        }
+
+        void close() noexcept
+        {
+            if (data_ != nullptr)
+            {
+                ::UnmapViewOfFile(data_);
+                data_ = nullptr;
+            }
+            if (mapping_ != nullptr)
+            {
+                ::CloseHandle(mapping_);
+                mapping_ = nullptr;
+            }
+            if (file_ != INVALID_HANDLE_VALUE)
+            {
+                ::CloseHandle(file_);
+                file_ = INVALID_HANDLE_VALUE;
+            }
+            size_ = 0;
+        }
+    #else
+        void open(const std::string& path) noexcept
+        {
+            int fd = ::open(path.c_str(), O_RDONLY);
+            if (fd == -1)
+            {
+                ec_ = std::error_code(errno, std::system_category());
+                return;
+            }
+            struct stat st;
+            if (::fstat(fd, &st) == -1)
+            {
+                ec_ = std::error_code(errno, std::system_category());
+                ::close(fd);
+                return;
+            }
+            size_ = static_cast<std::size_t>(st.st_size);
+            if (size_ > 0) // an empty file cannot be mapped
+            {
+                void* p = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+                if (p == MAP_FAILED)
+                {
+                    ec_ = std::error_code(errno, std::system_category());
+                    size_ = 0;
+                }
+                else
+                {
+                    data_ = static_cast<const uint8_t*>(p);
+        #if defined(MADV_SEQUENTIAL)
+                    // The parsers read front to back, ask for aggressive read-ahead
+                    ::madvise(p, size_, MADV_SEQUENTIAL);
+        #endif
+                }
+            }
+            // The mapping stays valid after the descriptor is closed
+            ::close(fd);
+        }
+
+        void close() noexcept
+        {
+            if (data_ != nullptr)
+            {
+                ::munmap(const_cast<uint8_t*>(data_), size_);
+                data_ = nullptr;
+            }
+            size_ = 0;
+        }
+    #endif
+    };
+
+} // namespace detail
+
+    // mmap_source maps a file into memory and reads it as text.
+    // A mapping failure is reported through is_error(), which the readers
+    // and cursors report as json_errc::source_error.
+
+    template <class CharT>
+    class mmap_source
+    {
+    public:
+        using value_type = CharT;
+    private:
+        jsoncons::detail::mapped_file file_;
+        const value_type* data_;
+        const value_type* current_;
+        const value_type* end_;
+
+        // Noncopyable
+        mmap_source(const mmap_source&) = delete;
+        mmap_source& operator=(const mmap_source&) = delete;
+    public:
+        mmap_source()
+            : data_(nullptr), current_(nullptr), end_(nullptr)
+        {
+        }
+
+        explicit mmap_source(const std::string& path)
+            : file_(path),
+              data_(reinterpret_cast<const value_type*>(file_.data())),
+              current_(data_),
+              end_(data_ + file_.size()/sizeof(value_type))
+        {
+        }
+
+        mmap_source(mmap_source&& other) noexcept
+            : data_(nullptr), current_(nullptr), end_(nullptr)
+        {
+            swap(other);
+        }
+
+        mmap_source& operator=(mmap_source&& other) noexcept
+        {
+            swap(other);
+            return *this;
+        }
+
+        const std::error_code& error_code() const
+        {
+            return file_.error_code();
+        }
+
+        bool eof() const
+        {
+            return current_ == end_;
+        }
+
+        bool is_error() const
+        {
+            return static_cast<bool>(file_.error_code());
+        }
+
+        std::size_t position() const
+        {
+            return (current_ - data_) + 1;
+        }
+
+        character_result<value_type> get_character()
+        {
+            if (current_ < end_)
+            {
+                return character_result<value_type>(*current_++);
+            }
+            else
+            {
+                return character_result<value_type>();
+            }
+        }
+
+        void ignore(std::size_t count)
+        {
+            std::size_t len;
+            if ((std::size_t)(end_ - current_) < count)
+            {
+                len = end_ - current_;
+            }
+            else
+            {
+                len = count;
+            }
+            current_ += len;
+        }
+
+        character_result<value_type> peek_character()
+        {
+            return current_ < end_ ? character_result<value_type>(*current_) : character_result<value_type>();
+        }
+
+        std::size_t read(value_type* p, std::size_t length)
+        {
+            std::size_t len;
+            if ((std::size_t)(end_ - current_) < length)
+            {
+                len = end_ - current_;
+            }
+            else
+            {
+                len = length;
+            }
+            std::memcpy(p, current_, len*sizeof(value_type));
+            current_  += len;
+            return len;
+        }
+
+        jsoncons::detail::span<const value_type> read_buffer()
+        {
+            jsoncons::detail::span<const value_type> s(current_, end_ - current_);
+            current_ = end_;
+            return s;
+        }
+    private:
+        void swap(mmap_source& other) noexcept
+        {
+            file_.swap(other.file_);
+            std::swap(data_,other.data_);
+            std::swap(current_,other.current_);
+            std::swap(end_,other.end_);
+        }
+    };
+
+    // binary_mmap_source maps a file into memory and reads it as bytes.
+
+    class binary_mmap_source
+    {
+    public:
+        typedef uint8_t value_type;
+    private:
+        jsoncons::detail::mapped_file file_;
+        const value_type* data_;
+        const value_type* current_;
+        const value_type* end_;
+
+        // Noncopyable
+        binary_mmap_source(const binary_mmap_source&) = delete;
+        binary_mmap_source& operator=(const binary_mmap_source&) = delete;
+    public:
+        binary_mmap_source()
+            : data_(nullptr), current_(nullptr), end_(nullptr)
+        {
+        }
+
+        explicit binary_mmap_source(const std::string& path)
+            : file_(path),
+              data_(file_.data()),
+              current_(data_),
+              end_(data_ + file_.size())
+        {
+        }
+
+        binary_mmap_source(binary_mmap_source&& other) noexcept
+            : data_(nullptr), current_(nullptr), end_(nullptr)
+        {
+            swap(other);
+        }
+
+        binary_mmap_source& operator=(binary_mmap_source&& other) noexcept
+        {
+            swap(other);
+            return *this;
+        }
+
+        const std::error_code& error_code() const
+        {
+            return file_.error_code();
+        }
+
+        bool eof() const
+        {
+            return current_ == end_;
+        }
+
+        bool is_error() const
+        {
+            return static_cast<bool>(file_.error_code());
+        }
+
+        std::size_t position() const
+        {
+            return current_ - data_ + 1;
+        }
+
+        character_result<value_type> get_character()
+        {
+            if (current_ < end_)
+            {
+                return character_result<value_type>(*current_++);
+            }
+            else
+            {
+                return character_result<value_type>();
+            }
+        }
+
+        void ignore(std::size_t count)
+        {
+            std::size_t len;
+            if ((std::size_t)(end_ - current_) < count)
+            {
+                len = end_ - current_;
+            }
+            else
+            {
+                len = count;
+            }
+            current_ += len;
+        }
+
+        character_result<value_type> peek_character()
+        {
+            return current_ < end_ ? character_result<value_type>(*current_) : character_result<value_type>();
+        }
+
+        std::size_t read(value_type* p, std::size_t length)
+        {
+            std::size_t len;
+            if ((std::size_t)(end_ - current_) < length)
+            {
+                len = end_ - current_;
+            }
+            else
+            {
+                len = length;
+            }
+            std::memcpy(p, current_, len);
+            current_  += len;
+            return len;
+        }
+
+        jsoncons::detail::span<const value_type> read_buffer()
+        {
+            jsoncons::detail::span<const value_type> s(current_, end_ - current_);
+            current_ = end_;
+            return s;
+        }
+    private:
+        void swap(binary_mmap_source& other) noexcept
+        {
+            file_.swap(other.file_);
+            std::swap(data_,other.data_);
+            std::swap(current_,other.current_);
+            std::swap(end_,other.end_);
+        }
+    };
+
+} // namespace jsoncons
+
+#endif // JSONCONS_HAS_MMAP
+
+#endif // JSONCONS_MMAP_SOURCE_HPP
@@ -0,0 +1,843 @@
+// Copyright 2021 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_ON_DEMAND_JSON_HPP
+#define JSONCONS_ON_DEMAND_JSON_HPP
+
+#include <cstddef>
+#include <iterator>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <jsoncons/config/jsoncons_config.hpp>
+#include <jsoncons/basic_json.hpp>
+#include <jsoncons/json_decoder.hpp>
+#include <jsoncons/json_error.hpp>
+#include <jsoncons/json_exception.hpp>
+#include <jsoncons/json_parser.hpp>
+#include <jsoncons/detail/parse_number.hpp>
+#include <jsoncons/detail/structural_index.hpp>
+
+namespace jsoncons {
+
+    // basic_on_demand_json is a handle to a value in JSON text that is parsed only as far as
+    // it is navigated. Looking up a member or an element scans the enclosing object or array
+    // from its start and skips the values in between without parsing them. Values are converted
+    // with as<T>() or to_json() when asked. The text must outlive the handles.
+    //
+    // Only the parts that are visited are validated, a skipped value is only checked for
+    // balanced brackets and quotes.
+
+    template <class CharT>
+    class basic_on_demand_json
+    {
+    public:
+        using char_type = CharT;
+        using string_view_type = jsoncons::basic_string_view<char_type>;
+        using string_type = std::basic_string<char_type>;
+
+        class member
+        {
+            string_type buffer_;
+            string_view_type key_;
+            basic_on_demand_json value_;
+        public:
+            member() = default;
+
+            member(const basic_on_demand_json& key, const basic_on_demand_json& value)
+                : value_(value)
+            {
+                if (key.has_escapes())
+                {
+                    buffer_ = key.as_string();
+                    key_ = buffer_;
+                }
+                else
+                {
+                    key_ = key.string_body();
+                }
+            }
+
+            member(const member& other)
+                : buffer_(other.buffer_),
+                  key_(other.buffer_.empty() ? other.key_ : string_view_type(buffer_)),
+                  value_(other.value_)
+            {
+            }
+
+            member& operator=(const member& other)
+            {
+                if (this != &other)
+                {
+                    buffer_ = other.buffer_;
+                    key_ = other.buffer_.empty() ? other.key_ : string_view_type(buffer_);
+                    value_ = other.value_;
+                }
+                return *this;
+            }
+
+            // The unescaped key
+            string_view_type key() const
+            {
+                return key_;
+            }
+
+            const basic_on_demand_json& value() const
+            {
+                return value_;
+            }
+        };
+
+        class object_iterator
+        {
+            basic_on_demand_json key_; // at the opening quote of the current key, or npos() at the end
+            mutable member current_;
+        public:
+            using iterator_category = std::input_iterator_tag;
+            using value_type = member;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const member*;
+            using reference = const member&;
+
+            object_iterator() = default;
+
+            explicit object_iterator(const basic_on_demand_json& key)
+                : key_(key)
+            {
+            }
+
+            reference operator*() const
+            {
+                current_ = member(key_, key_.member_value());
+                return current_;
+            }
+
+            pointer operator->() const
+            {
+                return &(**this);
+            }
+
+            object_iterator& operator++()
+            {
+                key_ = key_.member_value().next_member();
+                return *this;
+            }
+
+            object_iterator operator++(int)
+            {
+                object_iterator temp(*this);
+                ++(*this);
+                return temp;
+            }
+
+            bool operator==(const object_iterator& other) const
+            {
+                return key_.pos_ == other.key_.pos_;
+            }
+
+            bool operator!=(const object_iterator& other) const
+            {
+                return !(*this == other);
+            }
+        };
+
+        class array_iterator
+        {
+            basic_on_demand_json element_; // at the current element, or npos() at the end
+        public:
+            using iterator_category = std::input_iterator_tag;
+            using value_type = basic_on_demand_json;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const basic_on_demand_json*;
+            using reference = const basic_on_demand_json&;
+
+            array_iterator() = default;
+
+            explicit array_iterator(const basic_on_demand_json& element)
+                : element_(element)
+            {
+            }
+
+            reference operator*() const
+            {
+                return element_;
+            }
+
+            pointer operator->() const
+            {
+                return &element_;
+            }
+
+            array_iterator& operator++()
+            {
+                element_ = element_.next_element();
+                return *this;
+            }
+
+            array_iterator operator++(int)
+            {
+                array_iterator temp(*this);
+                ++(*this);
+                return temp;
+            }
+
+            bool operator==(const array_iterator& other) const
+            {
+                return element_.pos_ == other.element_.pos_;
+            }
+
+            bool operator!=(const array_iterator& other) const
+            {
+                return !(*this == other);
+            }
+        };
+
+        using object_range_type = range<object_iterator,object_iterator>;
+        using array_range_type = range<array_iterator,array_iterator>;
+    private:
+        const char_type* data_;
+        std::size_t length_;
+        std::size_t pos_;
+
+        basic_on_demand_json(const char_type* data, std::size_t length, std::size_t pos) noexcept
+            : data_(data), length_(length), pos_(pos)
+        {
+        }
+    public:
+        basic_on_demand_json() noexcept
+            : data_(nullptr), length_(0), pos_(0)
+        {
+        }
+
+        basic_on_demand_json(const char_type* data, std::size_t length)
+            : data_(data), length_(length), pos_(0)
+        {
+            pos_ = skip_whitespace(0);
+        }
+
+        explicit basic_on_demand_json(const string_view_type& s)
+            : basic_on_demand_json(s.data(), s.size())
+        {
+        }
+
+        json_type type() const
+        {
+            switch (current())
+            {
+                case '{':
+                    return json_type::object_value;
+                case '[':
+                    return json_type::array_value;
+                case '\"':
+                    return json_type::string_value;
+                case 't':
+                case 'f':
+                    return json_type::bool_value;
+                case 'n':
+                    return json_type::null_value;
+                case '-':
+                case '0': case '1': case '2': case '3': case '4':
+                case '5': case '6': case '7': case '8': case '9':
+                {
+                    std::size_t end = scalar_end(pos_);
+                    for (std::size_t i = pos_; i < end; ++i)
+                    {
+                        if (data_[i] == '.' || data_[i] == 'e' || data_[i] == 'E')
+                        {
+                            return json_type::double_value;
+                        }
+                    }
+                    return current() == '-' ? json_type::int64_value : json_type::uint64_value;
+                }
+                default:
+                    JSONCONS_THROW(make_error(json_errc::expected_value, pos_));
+            }
+        }
+
+        bool is_null() const
+        {
+            return type() == json_type::null_value;
+        }
+
+        bool is_bool() const
+        {
+            return type() == json_type::bool_value;
+        }
+
+        bool is_number() const
+        {
+            switch (type())
+            {
+                case json_type::int64_value:
+                case json_type::uint64_value:
+                case json_type::double_value:
+                    return true;
+                default:
+                    return false;
+            }
+        }
+
+        bool is_string() const
+        {
+            return type() == json_type::string_value;
+        }
+
+        bool is_array() const
+        {
+            return type() == json_type::array_value;
+        }
+
+        bool is_object() const
+        {
+            return type() == json_type::object_value;
+        }
+
+        // The text of the value
+        string_view_type raw() const
+        {
+            return string_view_type(data_ + pos_, value_end() - pos_);
+        }
+
+        // Counts the members or elements by skipping over them
+        std::size_t size() const
+        {
+            std::size_t count = 0;
+            switch (type())
+            {
+                case json_type::object_value:
+                {
+                    auto members = object_range();
+                    for (auto it = members.begin(); it != members.end(); ++it)
+                    {
+                        ++count;
+                    }
+                    break;
+                }
+                case json_type::array_value:
+                {
+                    auto elements = array_range();
+                    for (auto it = elements.begin(); it != elements.end(); ++it)
+                    {
+                        ++count;
+                    }
+                    break;
+                }
+                default:
+                    break;
+            }
+            return count;
+        }
+
+        bool contains(const string_view_type& name) const
+        {
+            return is_object() && find_member(name).pos_ != npos();
+        }
+
+        basic_on_demand_json at(const string_view_type& name) const
+        {
+            if (!is_object())
+            {
+                JSONCONS_THROW(not_an_object(name.data(),name.length()));
+            }
+            basic_on_demand_json value = find_member(name);
+            if (value.pos_ == npos())
+            {
+                JSONCONS_THROW(key_not_found(name.data(),name.length()));
+            }
+            return value;
+        }
+
+        basic_on_demand_json at(std::size_t i) const
+        {
+            if (!is_array())
+            {
+                JSONCONS_THROW(json_runtime_error<std::domain_error>("Index on non-array value not supported"));
+            }
+            auto elements = array_range();
+            auto it = elements.begin();
+            auto end = elements.end();
+            for (std::size_t j = 0; j < i && it != end; ++j)
+            {
+                ++it;
+            }
+            if (it == end)
+            {
+                JSONCONS_THROW(json_runtime_error<std::out_of_range>("Invalid array subscript"));
+            }
+            return *it;
+        }
+
+        basic_on_demand_json operator[](const string_view_type& name) const
+        {
+            return at(name);
+        }
+
+        basic_on_demand_json operator[](std::size_t i) const
+        {
+            return at(i);
+        }
+
+        object_range_type object_range() const
+        {
+            if (!is_object())
+            {
+                JSONCONS_THROW(json_runtime_error<std::domain_error>("Not an object"));
+            }
+            // The end is found by iterating, not by scanning ahead to the closing brace
+            return object_range_type(object_iterator(first_member()), object_iterator(at_pos(npos())));
+        }
+
+        array_range_type array_range() const
+        {
+            if (!is_array())
+            {
+                JSONCONS_THROW(json_runtime_error<std::domain_error>("Not an array"));
+            }
+            return array_range_type(array_iterator(first_element()), array_iterator(at_pos(npos())));
+        }
+
+        bool as_bool() const
+        {
+            string_view_type text(data_ + pos_, scalar_end(pos_) - pos_);
+            if (is_literal(text, "true"))
+            {
+                return true;
+            }
+            if (is_literal(text, "false"))
+            {
+                return false;
+            }
+            JSONCONS_THROW(json_runtime_error<std::domain_error>("Not a bool"));
+        }
+
+        template <class IntegerType>
+        IntegerType as_integer() const
+        {
+            switch (type())
+            {
+                case json_type::int64_value:
+                case json_type::uint64_value:
+                {
+                    auto result = jsoncons::detail::to_integer<IntegerType>(data_ + pos_, scalar_end(pos_) - pos_);
+                    if (!result)
+                    {
+                        JSONCONS_THROW(json_runtime_error<std::runtime_error>(result.error_code().message()));
+                    }
+                    return result.value();
+                }
+                case json_type::double_value:
+                    return static_cast<IntegerType>(as_double());
+                case json_type::bool_value:
+                    return static_cast<IntegerType>(as_bool() ? 1 : 0);
+                default:
+                    return to_json<basic_json<char_type>>().template as_integer<IntegerType>();
+            }
+        }
+
+        double as_double() const
+        {
+            switch (type())
+            {
+                case json_type::int64_value:
+                case json_type::uint64_value:
+                case json_type::double_value:
+                {
+                    std::string s;
+                    for (std::size_t i = pos_; i < scalar_end(pos_); ++i)
+                    {
+                        s.push_back(static_cast<char>(data_[i]));
+                    }
+                    jsoncons::detail::to_double_t to_double;
+                    return to_double(s.c_str(), s.length());
+                }
+                default:
+                    return to_json<basic_json<char_type>>().as_double();
+            }
+        }
+
+        // The text of a string without escapes, the string is not copied
+        string_view_type as_string_view() const
+        {
+            if (!is_string())
+            {
+                JSONCONS_THROW(json_runtime_error<std::domain_error>("Not a string"));
+            }
+            if (has_escapes())
+            {
+                JSONCONS_THROW(json_runtime_error<std::domain_error>("String has escapes, use as_string()"));
+            }
+            return string_body();
+        }
+
+        string_type as_string() const
+        {
+            if (is_string() && !has_escapes())
+            {
+                return string_type(string_body());
+            }
+            return to_json<basic_json<char_type>>().as_string();
+        }
+
+        // Types without a direct accessor are converted through basic_json
+
+        template <class T>
+        typename std::enable_if<std::is_same<T,bool>::value,T>::type
+        as() const
+        {
+            return as_bool();
+        }
+
+        template <class T>
+        typename std::enable_if<!std::is_same<T,bool>::value && std::is_integral<T>::value,T>::type
+        as() const
+        {
+            return as_integer<T>();
+        }
+
+        template <class T>
+        typename std::enable_if<std::is_floating_point<T>::value,T>::type
+        as() const
+        {
+            return static_cast<T>(as_double());
+        }
+
+        template <class T>
+        typename std::enable_if<std::is_same<T,string_view_type>::value,T>::type
+        as() const
+        {
+            return as_string_view();
+        }
+
+        template <class T>
+        typename std::enable_if<std::is_same<T,string_type>::value,T>::type
+        as() const
+        {
+            return as_string();
+        }
+
+        template <class T>
+        typename std::enable_if<!std::is_integral<T>::value && !std::is_floating_point<T>::value &&
+                                !std::is_same<T,string_view_type>::value && !std::is_same<T,string_type>::value,T>::type
+        as() const
+        {
+            return to_json<basic_json<char_type>>().template as<T>();
+        }
+
+        // Parses the value into a basic_json
+        template <class Json>
+        Json to_json() const
+        {
+            json_decoder<Json> decoder;
+            dump(decoder);
+            if (!decoder.is_valid())
+            {
+                JSONCONS_THROW(json_runtime_error<std::runtime_error>("Failed to parse json value"));
+            }
+            return decoder.get_result();
+        }
+
+        // Parses the value, emitting its events to the visitor
+        void dump(basic_json_visitor<char_type>& visitor) const
+        {
+            std::error_code ec;
+            dump(visitor, ec);
+            if (ec)
+            {
+                JSONCONS_THROW(ser_error(ec));
+            }
+        }
+
+        void dump(basic_json_visitor<char_type>& visitor, std::error_code& ec) const
+        {
+            basic_json_parser<char_type> parser;
+            string_view_type text = raw();
+            parser.update(text.data(), text.size());
+            parser.finish_parse(visitor, ec);
+            if (!ec)
+            {
+                parser.check_done(ec);
+            }
+        }
+
+    private:
+        static constexpr std::size_t npos() noexcept
+        {
+            return static_cast<std::size_t>(-1);
+        }
+
+        basic_on_demand_json at_pos(std::size_t pos) const noexcept
+        {
+            return basic_on_demand_json(data_, length_, pos);
+        }
+
+        char_type current() const
+        {
+            if (pos_ >= length_)
+            {
+                JSONCONS_THROW(make_error(json_errc::unexpected_eof, pos_));
+            }
+            return data_[pos_];
+        }
+
+        ser_error make_error(json_errc ec, std::size_t pos) const
+        {
+            std::size_t line = 1;
+            std::size_t column = 1;
+            for (std::size_t i = 0; i < pos && i < length_; ++i)
+            {
+                if (data_[i] == '\n')
+                {
+                    ++line;
+                    column = 1;
+                }
+                else
+                {
+                    ++column;
+                }
+            }
+            return ser_error(ec, line, column);
+        }
+
+        std::size_t skip_whitespace(std::size_t pos) const noexcept
+        {
+            while (pos < length_ && (data_[pos] == ' ' || data_[pos] == '\t' || data_[pos] == '\n' || data_[pos] == '\r'))
+            {
+                ++pos;
+            }
+            return pos;
+        }
+
+        std::size_t scalar_end(std::size_t pos) const noexcept
+        {
+            while (pos < length_)
+            {
+                switch (data_[pos])
+                {
+                    case ',': case '}': case ']': case ' ': case '\t': case '\n': case '\r':
+                        return pos;
+                    default:
+                        ++pos;
+                        break;
+                }
+            }
+            return pos;
+        }
+
+        // Returns the position of the closing quote of the string that starts at pos
+        std::size_t string_end(std::size_t pos) const
+        {
+            std::size_t i = pos + 1;
+            while (i < length_)
+            {
+                if (data_[i] == '\"')
+                {
+                    return i;
+                }
+                i += (data_[i] == '\\') ? 2 : 1;
+            }
+            JSONCONS_THROW(make_error(json_errc::unexpected_eof, length_));
+        }
+
+        std::size_t container_end(std::size_t pos) const
+        {
+            std::size_t end = find_container_end(data_, length_, pos);
+            if (end >= length_)
+            {
+                JSONCONS_THROW(make_error(json_errc::unexpected_eof, length_));
+            }
+            return end;
+        }
+
+        template <class C>
+        typename std::enable_if<sizeof(C) == sizeof(char),std::size_t>::type
+        find_container_end(const C* data, std::size_t length, std::size_t pos) const
+        {
+            return jsoncons::detail::find_container_end(reinterpret_cast<const char*>(data), length, pos);
+        }
+
+        template <class C>
+        typename std::enable_if<sizeof(C) != sizeof(char),std::size_t>::type
+        find_container_end(const C* data, std::size_t length, std::size_t pos) const
+        {
+            std::size_t depth = 0;
+            for (std::size_t i = pos; i < length; ++i)
+            {
+                switch (data[i])
+                {
+                    case '\"':
+                        i = string_end(i);
+                        break;
+                    case '[':
+                    case '{':
+                        ++depth;
+                        break;
+                    case ']':
+                    case '}':
+                        if (--depth == 0)
+                        {
+                            return i;
+                        }
+                        break;
+                    default:
+                        break;
+                }
+            }
+            return length;
+        }
+
+        // Returns the position after the value
+        std::size_t value_end() const
+        {
+            switch (current())
+            {
+                case '{':
+                case '[':
+                    return container_end(pos_) + 1;
+                case '\"':
+                    return string_end(pos_) + 1;
+                default:
+                    return scalar_end(pos_);
+            }
+        }
+
+        string_view_type string_body() const
+        {
+            return string_view_type(data_ + pos_ + 1, string_end(pos_) - pos_ - 1);
+        }
+
+        bool has_escapes() const
+        {
+            string_view_type body = string_body();
+            for (auto c : body)
+            {
+                if (c == '\\')
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        static bool is_literal(const string_view_type& text, const char* literal) noexcept
+        {
+            std::size_t i = 0;
+            for (; i < text.size() && literal[i] != 0; ++i)
+            {
+                if (text[i] != static_cast<char_type>(literal[i]))
+                {
+                    return false;
+                }
+            }
+            return i == text.size() && literal[i] == 0;
+        }
+
+        basic_on_demand_json expect_key(std::size_t pos) const
+        {
+            if (pos >= length_ || data_[pos] != '\"')
+            {
+                JSONCONS_THROW(make_error(json_errc::expected_key, pos));
+            }
+            return at_pos(pos);
+        }
+
+        // For a handle at a key, the handle of its value
+        basic_on_demand_json member_value() const
+        {
+            std::size_t pos = skip_whitespace(string_end(pos_) + 1);
+            if (pos >= length_ || data_[pos] != ':')
+            {
+                JSONCONS_THROW(make_error(json_errc::expected_colon, pos));
+            }
+            return at_pos(skip_whitespace(pos + 1));
+        }
+
+        // For a handle at an object, the handle of the first key, or npos() if the object is empty
+        basic_on_demand_json first_member() const
+        {
+            std::size_t pos = skip_whitespace(pos_ + 1);
+            if (pos < length_ && data_[pos] == '}')
+            {
+                return at_pos(npos());
+            }
+            return expect_key(pos);
+        }
+
+        // For a handle at an array, the handle of the first element, or npos() if the array is empty
+        basic_on_demand_json first_element() const
+        {
+            std::size_t pos = skip_whitespace(pos_ + 1);
+            if (pos < length_ && data_[pos] == ']')
+            {
+                return at_pos(npos());
+            }
+            return at_pos(pos);
+        }
+
+        // For a handle at a member value, the handle of the next key, or npos() after the last member
+        basic_on_demand_json next_member() const
+        {
+            std::size_t pos = skip_whitespace(value_end());
+            if (pos < length_ && data_[pos] == ',')
+            {
+                return expect_key(skip_whitespace(pos + 1));
+            }
+            if (pos < length_ && data_[pos] == '}')
+            {
+                return at_pos(npos());
+            }
+            JSONCONS_THROW(make_error(json_errc::expected_comma_or_right_brace, pos));
+        }
+
+        // For a handle at an element, the handle of the next element, or npos() after the last element
+        basic_on_demand_json next_element() const
+        {
+            std::size_t pos = skip_whitespace(value_end());
+            if (pos < length_ && data_[pos] == ',')
+            {
+                return at_pos(skip_whitespace(pos + 1));
+            }
+            if (pos < length_ && data_[pos] == ']')
+            {
+                return at_pos(npos());
+            }
+            JSONCONS_THROW(make_error(json_errc::expected_comma_or_right_bracket, pos));
+        }
+
+        bool key_equals(const string_view_type& name) const
+        {
+            string_view_type body = string_body();
+            for (auto c : body)
+            {
+                if (c == '\\')
+                {
+                    return at_pos(pos_).as_string() == name;
+                }
+            }
+            return body == name;
+        }
+
+        basic_on_demand_json find_member(const string_view_type& name) const
+        {
+            basic_on_demand_json key = first_member();
+            while (key.pos_ != npos())
+            {
+                basic_on_demand_json value = key.member_value();
+                if (key.key_equals(name))
+                {
+                    return value;
+                }
+                key = value.next_member();
+            }
+            return at_pos(npos());
+        }
+    };
+
+    using on_demand_json = basic_on_demand_json<char>;
+    using won_demand_json = basic_on_demand_json<wchar_t>;
+
+} // namespace jsoncons
+
+#endif // JSONCONS_ON_DEMAND_JSON_HPP
@@ -0,0 +1,615 @@
+// Copyright 2021 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_PARALLEL_JSON_LINES_READER_HPP
+#define JSONCONS_PARALLEL_JSON_LINES_READER_HPP
+
+#include <cstddef>
+#include <cstring> // std::memchr
+#include <algorithm> // std::find
+#include <condition_variable>
+#include <deque>
+#include <exception> // std::exception_ptr
+#include <functional>
+#include <istream>
+#include <limits>
+#include <map>
+#include <memory> // std::allocator
+#include <mutex>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <utility> // std::move
+#include <vector>
+#include <jsoncons/config/jsoncons_config.hpp>
+#include <jsoncons/json_exception.hpp>
+#include <jsoncons/json_options.hpp>
+#include <jsoncons/json_parser.hpp>
+#include <jsoncons/json_decoder.hpp>
+#include <jsoncons/json_visitor.hpp>
+#include <jsoncons/basic_json.hpp>
+
+namespace jsoncons {
+
+    class parallel_json_lines_options
+    {
+        std::size_t thread_count_;
+        std::size_t chunk_length_;
+        std::size_t max_chunks_in_flight_;
+        bool ordered_;
+    public:
+        static constexpr std::size_t default_chunk_length = 1024*1024;
+
+        parallel_json_lines_options()
+            : thread_count_(0),
+              chunk_length_(default_chunk_length),
+              max_chunks_in_flight_(0),
+              ordered_(true)
+        {
+        }
+
+        // The number of worker threads, 0 to use std::thread::hardware_concurrency()
+        std::size_t thread_count() const
+        {
+            if (thread_count_ != 0)
+            {
+                return thread_count_;
+            }
+            std::size_t n = std::thread::hardware_concurrency();
+            return n != 0 ? n : 1;
+        }
+
+        parallel_json_lines_options& thread_count(std::size_t value)
+        {
+            thread_count_ = value;
+            return *this;
+        }
+
+        // The approximate length of a chunk, chunks are extended to the end of a line
+        std::size_t chunk_length() const
+        {
+            return chunk_length_;
+        }
+
+        parallel_json_lines_options& chunk_length(std::size_t value)
+        {
+            chunk_length_ = value != 0 ? value : 1;
+            return *this;
+        }
+
+        // The maximum number of chunks read but not yet delivered, 0 for twice the thread count
+        std::size_t max_chunks_in_flight() const
+        {
+            return max_chunks_in_flight_ != 0 ? max_chunks_in_flight_ : 2*thread_count();
+        }
+
+        parallel_json_lines_options& max_chunks_in_flight(std::size_t value)
+        {
+            max_chunks_in_flight_ = value;
+            return *this;
+        }
+
+        // If true, values are delivered in input order, otherwise as chunks complete
+        bool ordered() const
+        {
+            return ordered_;
+        }
+
+        parallel_json_lines_options& ordered(bool value)
+        {
+            ordered_ = value;
+            return *this;
+        }
+    };
+
+    template <class Json,class TempAllocator=std::allocator<char>>
+    class basic_parallel_json_lines_reader
+    {
+    public:
+        using value_type = Json;
+        using char_type = typename Json::char_type;
+        using string_view_type = jsoncons::basic_string_view<char_type>;
+        static_assert(sizeof(char_type) == sizeof(char), "basic_parallel_json_lines_reader reads UTF-8 text");
+    private:
+        using parser_type = basic_json_parser<char_type,TempAllocator>;
+
+        struct chunk
+        {
+            std::size_t index;
+            std::basic_string<char_type> storage; // owns the text when read from a stream
+            string_view_type view;                // refers to the text of a contiguous input
+
+            chunk()
+                : index(0)
+            {
+            }
+
+            string_view_type text() const
+            {
+                return storage.empty() ? view : string_view_type(storage.data(), storage.size());
+            }
+        };
+
+        struct chunk_result
+        {
+            std::vector<Json> values;
+            std::size_t line_count;
+            std::error_code ec;
+            std::size_t line;
+            std::size_t column;
+            std::exception_ptr exception;
+
+            chunk_result()
+                : line_count(0), line(0), column(0)
+            {
+            }
+        };
+
+        class chunk_reader
+        {
+            string_view_type input_;
+            std::size_t offset_;
+            std::istream* is_;
+            std::basic_string<char_type> carry_;
+            std::size_t chunk_length_;
+        public:
+            chunk_reader(const string_view_type& input, std::size_t chunk_length)
+                : input_(input), offset_(0), is_(nullptr), chunk_length_(chunk_length)
+            {
+            }
+
+            chunk_reader(std::istream& is, std::size_t chunk_length)
+                : offset_(0), is_(std::addressof(is)), chunk_length_(chunk_length)
+            {
+            }
+
+            bool is_error() const
+            {
+                return is_ != nullptr && is_->bad();
+            }
+
+            bool next(chunk& c)
+            {
+                return is_ == nullptr ? next_from_view(c) : next_from_stream(c);
+            }
+        private:
+            // A chunk of a contiguous input is a view, extended to the next line feed
+            bool next_from_view(chunk& c)
+            {
+                if (offset_ >= input_.size())
+                {
+                    return false;
+                }
+                std::size_t end = input_.size();
+                if (input_.size() - offset_ > chunk_length_)
+                {
+                    const char_type* first = input_.data() + offset_ + chunk_length_;
+                    const void* p = std::memchr(first, '\n', input_.size() - offset_ - chunk_length_);
+                    if (p != nullptr)
+                    {
+                        end = static_cast<const char_type*>(p) - input_.data() + 1;
+                    }
+                }
+                c.view = string_view_type(input_.data() + offset_, end - offset_);
+                offset_ = end;
+                return true;
+            }
+
+            // A chunk of a stream holds whole lines, the partial line at the end is carried over
+            bool next_from_stream(chunk& c)
+            {
+                c.storage.clear();
+                c.storage.swap(carry_);
+                std::size_t line_end = 0;
+                for (;;)
+                {
+                    if (!is_->good())
+                    {
+                        line_end = c.storage.size();
+                        break;
+                    }
+                    std::size_t offset = c.storage.size();
+                    c.storage.resize(offset + chunk_length_);
+                    is_->read(&c.storage[offset], static_cast<std::streamsize>(chunk_length_));
+                    c.storage.resize(offset + static_cast<std::size_t>(is_->gcount()));
+
+                    // The carried over text has no line feed, look in the block just read
+                    auto first = c.storage.rbegin();
+                    auto last = first + (c.storage.size() - offset);
+                    auto it = std::find(first, last, '\n');
+                    if (it != last)
+                    {
+                        line_end = c.storage.rend() - it;
+                        break;
+                    }
+                }
+                carry_.assign(c.storage, line_end, std::basic_string<char_type>::npos);
+                c.storage.resize(line_end);
+                return !c.storage.empty();
+            }
+        };
+
+        class work_queue
+        {
+        public:
+            using process_function = std::function<void(std::size_t worker, chunk& c, chunk_result& result)>;
+        private:
+            std::mutex mutex_;
+            std::condition_variable task_available_;
+            std::condition_variable result_available_;
+            std::deque<chunk> tasks_;
+            std::map<std::size_t,chunk_result> results_;
+            std::vector<std::thread> workers_;
+            process_function process_;
+            bool stop_;
+        public:
+            work_queue(std::size_t thread_count, process_function process)
+                : process_(process), stop_(false)
+            {
+                workers_.reserve(thread_count);
+                for (std::size_t i = 0; i < thread_count; ++i)
+                {
+                    workers_.emplace_back(&work_queue::run, this, i);
+                }
+            }
+
+            ~work_queue() noexcept
+            {
+                {
+                    std::lock_guard<std::mutex> lock(mutex_);
+                    stop_ = true;
+                    tasks_.clear();
+                }
+                task_available_.notify_all();
+                for (auto& t : workers_)
+                {
+                    t.join();
+                }
+            }
+
+            void push(chunk&& c)
+            {
+                {
+                    std::lock_guard<std::mutex> lock(mutex_);
+                    tasks_.push_back(std::move(c));
+                }
+                task_available_.notify_one();
+            }
+
+            // Removes the chunks that no worker has started, returns how many
+            std::size_t cancel_pending()
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                std::size_t count = tasks_.size();
+                tasks_.clear();
+                return count;
+            }
+
+            // Waits for the result of chunk index, or of any chunk if ordered is false
+            std::pair<std::size_t,chunk_result> pop(bool ordered, std::size_t index)
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                typename std::map<std::size_t,chunk_result>::iterator it;
+                result_available_.wait(lock, [&]() -> bool
+                {
+                    it = ordered ? results_.find(index) : results_.begin();
+                    return it != results_.end();
+                });
+                std::pair<std::size_t,chunk_result> result(it->first, std::move(it->second));
+                results_.erase(it);
+                return result;
+            }
+        private:
+            void run(std::size_t worker)
+            {
+                for (;;)
+                {
+                    chunk c;
+                    {
+                        std::unique_lock<std::mutex> lock(mutex_);
+                        task_available_.wait(lock, [this]() -> bool {return stop_ || !tasks_.empty();});
+                        if (stop_)
+                        {
+                            return;
+                        }
+                        c = std::move(tasks_.front());
+                        tasks_.pop_front();
+                    }
+                    chunk_result result;
+                    JSONCONS_TRY
+                    {
+                        process_(worker, c, result);
+                    }
+                    JSONCONS_CATCH(...)
+                    {
+                        result.exception = std::current_exception();
+                    }
+                    {
+                        std::lock_guard<std::mutex> lock(mutex_);
+                        results_.emplace(c.index, std::move(result));
+                    }
+                    result_available_.notify_all();
+                }
+            }
+        };
+
+        basic_json_decode_options<char_type> options_;
+        parallel_json_lines_options parallel_options_;
+        TempAllocator temp_alloc_;
+    public:
+        basic_parallel_json_lines_reader(const basic_json_decode_options<char_type>& options = basic_json_decode_options<char_type>(),
+                                         const parallel_json_lines_options& parallel_options = parallel_json_lines_options(),
+                                         const TempAllocator& temp_alloc = TempAllocator())
+            : options_(options), parallel_options_(parallel_options), temp_alloc_(temp_alloc)
+        {
+        }
+
+        basic_parallel_json_lines_reader(const basic_parallel_json_lines_reader&) = delete;
+        basic_parallel_json_lines_reader& operator=(const basic_parallel_json_lines_reader&) = delete;
+
+        // Parses every document in input into a Json value, and calls f(Json&&) on the calling thread
+
+        template <class F>
+        void read(const string_view_type& input, F f)
+        {
+            std::error_code ec;
+            std::size_t line = 0;
+            std::size_t column = 0;
+            chunk_reader reader(input, parallel_options_.chunk_length());
+            read_values(reader, f, ec, line, column);
+            if (ec)
+            {
+                JSONCONS_THROW(ser_error(ec, line, column));
+            }
+        }
+
+        template <class F>
+        void read(const string_view_type& input, F f, std::error_code& ec)
+        {
+            std::size_t line = 0;
+            std::size_t column = 0;
+            chunk_reader reader(input, parallel_options_.chunk_length());
+            read_values(reader, f, ec, line, column);
+        }
+
+        template <class F>
+        void read(std::istream& is, F f)
+        {
+            std::error_code ec;
+            std::size_t line = 0;
+            std::size_t column = 0;
+            chunk_reader reader(is, parallel_options_.chunk_length());
+            read_values(reader, f, ec, line, column);
+            if (ec)
+            {
+                JSONCONS_THROW(ser_error(ec, line, column));
+            }
+        }
+
+        template <class F>
+        void read(std::istream& is, F f, std::error_code& ec)
+        {
+            std::size_t line = 0;
+            std::size_t column = 0;
+            chunk_reader reader(is, parallel_options_.chunk_length());
+            read_values(reader, f, ec, line, column);
+        }
+
+        // Sends the events of every document in input to the visitor of the worker thread
+        // that parses it. make_visitor(i) is called on the calling thread for each worker i
+        // before any parsing starts, and must return a basic_json_visitor<char_type>&.
+
+        template <class VisitorFactory>
+        void visit(const string_view_type& input, VisitorFactory make_visitor)
+        {
+            std::error_code ec;
+            std::size_t line = 0;
+            std::size_t column = 0;
+            chunk_reader reader(input, parallel_options_.chunk_length());
+            visit_all(reader, make_visitor, ec, line, column);
+            if (ec)
+            {
+                JSONCONS_THROW(ser_error(ec, line, column));
+            }
+        }
+
+        template <class VisitorFactory>
+        void visit(const string_view_type& input, VisitorFactory make_visitor, std::error_code& ec)
+        {
+            std::size_t line = 0;
+            std::size_t column = 0;
+            chunk_reader reader(input, parallel_options_.chunk_length());
+            visit_all(reader, make_visitor, ec, line, column);
+        }
+
+        template <class VisitorFactory>
+        void visit(std::istream& is, VisitorFactory make_visitor)
+        {
+            std::error_code ec;
+            std::size_t line = 0;
+            std::size_t column = 0;
+            chunk_reader reader(is, parallel_options_.chunk_length());
+            visit_all(reader, make_visitor, ec, line, column);
+            if (ec)
+            {
+                JSONCONS_THROW(ser_error(ec, line, column));
+            }
+        }
+
+        template <class VisitorFactory>
+        void visit(std::istream& is, VisitorFactory make_visitor, std::error_code& ec)
+        {
+            std::size_t line = 0;
+            std::size_t column = 0;
+            chunk_reader reader(is, parallel_options_.chunk_length());
+            visit_all(reader, make_visitor, ec, line, column);
+        }
+
+    private:
+
+        template <class F>
+        void read_values(chunk_reader& reader, F& f, std::error_code& ec, std::size_t& line, std::size_t& column)
+        {
+            auto process = [this](std::size_t, chunk& c, chunk_result& result)
+            {
+                json_decoder<Json,TempAllocator> decoder(temp_alloc_);
+                parse_chunk(c.text(), decoder, result, [&]() {result.values.push_back(decoder.get_result());});
+            };
+            run(reader, process, [&f](std::vector<Json>& values)
+            {
+                for (auto& val : values)
+                {
+                    f(std::move(val));
+                }
+            }, ec, line, column);
+        }
+
+        template <class VisitorFactory>
+        void visit_all(chunk_reader& reader, VisitorFactory& make_visitor, std::error_code& ec, std::size_t& line, std::size_t& column)
+        {
+            std::vector<basic_json_visitor<char_type>*> visitors;
+            for (std::size_t i = 0; i < parallel_options_.thread_count(); ++i)
+            {
+                basic_json_visitor<char_type>& visitor = make_visitor(i);
+                visitors.push_back(std::addressof(visitor));
+            }
+            auto process = [this,&visitors](std::size_t worker, chunk& c, chunk_result& result)
+            {
+                parse_chunk(c.text(), *visitors[worker], result, [](){});
+            };
+            run(reader, process, [](std::vector<Json>&){}, ec, line, column);
+        }
+
+        // Parses the documents in text line by line. A line may hold more than one document,
+        // a document may not span lines.
+        template <class Done>
+        void parse_chunk(const string_view_type& text, basic_json_visitor<char_type>& visitor,
+                         chunk_result& result, Done done)
+        {
+            parser_type parser(options_, temp_alloc_);
+
+            const char_type* p = text.data();
+            const char_type* end = text.data() + text.size();
+            while (p < end)
+            {
+                const void* q = std::memchr(p, '\n', end - p);
+                const char_type* line_end = q != nullptr ? static_cast<const char_type*>(q) : end;
+                ++result.line_count;
+
+                parser.update(p, line_end - p);
+                for (;;)
+                {
+                    parser.skip_whitespace();
+                    if (parser.source_exhausted())
+                    {
+                        break;
+                    }
+                    parser.reset();
+                    parser.finish_parse(visitor, result.ec);
+                    if (result.ec)
+                    {
+                        result.line = result.line_count;
+                        result.column = parser.column();
+                        return;
+                    }
+                    done();
+                }
+                p = line_end + 1;
+            }
+        }
+
+        template <class Process, class Deliver>
+        void run(chunk_reader& reader, Process process, Deliver deliver,
+                 std::error_code& ec, std::size_t& line, std::size_t& column)
+        {
+            const bool ordered = parallel_options_.ordered();
+            const std::size_t max_in_flight = parallel_options_.max_chunks_in_flight();
+
+            work_queue queue(parallel_options_.thread_count(), process);
+
+            std::vector<std::size_t> line_counts; // line feeds per chunk
+            std::size_t chunk_count = 0;
+            std::size_t next_index = 0;
+            std::size_t in_flight = 0;
+            bool input_done = false;
+
+            std::size_t error_index = (std::numeric_limits<std::size_t>::max)();
+            chunk_result error;
+
+            for (;;)
+            {
+                // Read ahead while there is room, the bound on chunks in flight is the back pressure
+                while (!input_done && in_flight < max_in_flight && error_index == (std::numeric_limits<std::size_t>::max)())
+                {
+                    chunk c;
+                    if (!reader.next(c))
+                    {
+                        input_done = true;
+                        break;
+                    }
+                    c.index = chunk_count++;
+                    line_counts.push_back(0);
+                    queue.push(std::move(c));
+                    ++in_flight;
+                }
+                if (in_flight == 0)
+                {
+                    break;
+                }
+
+                std::pair<std::size_t,chunk_result> item = queue.pop(ordered, next_index);
+                --in_flight;
+                chunk_result& result = item.second;
+                line_counts[item.first] = result.line_count;
+                if (ordered)
+                {
+                    ++next_index;
+                }
+                if (result.exception)
+                {
+                    std::rethrow_exception(result.exception);
+                }
+                if (item.first < error_index)
+                {
+                    deliver(result.values);
+                    if (result.ec)
+                    {
+                        // Stop reading, the chunks after this one are discarded
+                        error_index = item.first;
+                        error = std::move(result);
+                        in_flight -= queue.cancel_pending();
+                        if (ordered)
+                        {
+                            // The chunks still being parsed all come later
+                            break;
+                        }
+                    }
+                }
+            }
+
+            if (error_index != (std::numeric_limits<std::size_t>::max)())
+            {
+                ec = error.ec;
+                line = error.line;
+                for (std::size_t i = 0; i < error_index; ++i)
+                {
+                    line += line_counts[i];
+                }
+                column = error.column;
+            }
+            else if (reader.is_error())
+            {
+                ec = json_errc::source_error;
+            }
+        }
+    };
+
+    using parallel_json_lines_reader = basic_parallel_json_lines_reader<json>;
+    using parallel_ojson_lines_reader = basic_parallel_json_lines_reader<ojson>;
+
+} // namespace jsoncons
+
+#endif // JSONCONS_PARALLEL_JSON_LINES_READER_HPP
@@ -0,0 +1,241 @@
+// Copyright 2021 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_PARALLEL_PARSE_HPP
+#define JSONCONS_PARALLEL_PARSE_HPP
+
+#include <cstddef>
+#include <exception> // std::exception_ptr
+#include <thread>
+#include <utility> // std::move
+#include <vector>
+#include <jsoncons/config/jsoncons_config.hpp>
+#include <jsoncons/json_options.hpp>
+#include <jsoncons/json_parser.hpp>
+#include <jsoncons/json_decoder.hpp>
+#include <jsoncons/basic_json.hpp>
+#include <jsoncons/detail/structural_index.hpp>
+
+namespace jsoncons {
+namespace detail {
+
+    template <class Json>
+    class parallel_array_parser
+    {
+        using char_type = typename Json::char_type;
+
+        // Below this many characters per thread, starting a thread costs more than it saves
+        static constexpr std::size_t min_length_per_thread = 16384;
+
+        const char_type* data_;
+        const basic_json_decode_options<char_type>& options_;
+        std::vector<std::size_t> separators_;
+    public:
+        parallel_array_parser(const char_type* data, const basic_json_decode_options<char_type>& options)
+            : data_(data), options_(options)
+        {
+        }
+
+        // Returns false if the text is not a top level array that can be split,
+        // or if any element fails to parse
+        bool parse(std::size_t length, std::size_t thread_count, Json& result)
+        {
+            std::size_t first = 0;
+            while (first < length && is_whitespace(data_[first]))
+            {
+                ++first;
+            }
+            std::size_t max_depth = 0;
+            if (!find_array_elements(data_, length, first, separators_, max_depth) ||
+                max_depth > static_cast<std::size_t>(options_.max_nesting_depth()))
+            {
+                return false;
+            }
+            for (std::size_t i = separators_.back() + 1; i < length; ++i)
+            {
+                if (!is_whitespace(data_[i]))
+                {
+                    return false;
+                }
+            }
+
+            std::size_t element_count = separators_.size() - 1;
+            if (element_count == 1 && is_blank_element(0))
+            {
+                result = Json(json_array_arg);
+                return true;
+            }
+
+            std::size_t max_threads = (separators_.back() - separators_.front())/min_length_per_thread + 1;
+            if (thread_count > max_threads)
+            {
+                thread_count = max_threads;
+            }
+            if (thread_count > element_count)
+            {
+                thread_count = element_count;
+            }
+
+            // Split the elements into ranges of about the same length
+            std::vector<std::size_t> bounds;
+            bounds.push_back(0);
+            const std::size_t total = separators_.back() - separators_.front();
+            for (std::size_t t = 1; t < thread_count; ++t)
+            {
+                std::size_t target = separators_.front() + total/thread_count*t;
+                std::size_t i = bounds.back();
+                while (i < element_count && separators_[i] < target)
+                {
+                    ++i;
+                }
+                bounds.push_back(i);
+            }
+            bounds.push_back(element_count);
+
+            std::vector<std::vector<Json>> parts(thread_count);
+            std::vector<char> succeeded(thread_count, 0);
+            std::vector<std::exception_ptr> exceptions(thread_count);
+            std::vector<std::thread> threads;
+            threads.reserve(thread_count - 1);
+            JSONCONS_TRY
+            {
+                for (std::size_t t = 1; t < thread_count; ++t)
+                {
+                    threads.emplace_back([&,t]()
+                    {
+                        parse_range(bounds[t], bounds[t+1], parts[t], succeeded[t], exceptions[t]);
+                    });
+                }
+                parse_range(bounds[0], bounds[1], parts[0], succeeded[0], exceptions[0]);
+            }
+            JSONCONS_CATCH(...)
+            {
+                for (auto& th : threads)
+                {
+                    th.join();
+                }
+                JSONCONS_RETHROW;
+            }
+            for (auto& th : threads)
+            {
+                th.join();
+            }
+            for (std::size_t t = 0; t < thread_count; ++t)
+            {
+                if (exceptions[t])
+                {
+                    std::rethrow_exception(exceptions[t]);
+                }
+                if (!succeeded[t])
+                {
+                    return false;
+                }
+            }
+
+            Json j(json_array_arg);
+            j.reserve(element_count);
+            for (auto& part : parts)
+            {
+                for (auto& item : part)
+                {
+                    j.push_back(std::move(item));
+                }
+            }
+            result = std::move(j);
+            return true;
+        }
+
+    private:
+        static bool is_whitespace(char_type c)
+        {
+            return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+        }
+
+        bool is_blank_element(std::size_t i) const
+        {
+            for (std::size_t k = separators_[i] + 1; k < separators_[i+1]; ++k)
+            {
+                if (!is_whitespace(data_[k]))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        void parse_range(std::size_t first, std::size_t last, std::vector<Json>& values,
+                         char& succeeded, std::exception_ptr& exception) noexcept
+        {
+            JSONCONS_TRY
+            {
+                values.reserve(last - first);
+                json_decoder<Json> decoder;
+                basic_json_parser<char_type> parser(options_);
+                std::error_code ec;
+                for (std::size_t i = first; i < last; ++i)
+                {
+                    parser.reset();
+                    parser.update(data_ + separators_[i] + 1, separators_[i+1] - separators_[i] - 1);
+                    parser.finish_parse(decoder, ec);
+                    if (ec)
+                    {
+                        return;
+                    }
+                    parser.check_done(ec);
+                    if (ec || !decoder.is_valid())
+                    {
+                        return;
+                    }
+                    values.push_back(decoder.get_result());
+                }
+                succeeded = 1;
+            }
+            JSONCONS_CATCH(...)
+            {
+                exception = std::current_exception();
+            }
+        }
+    };
+
+} // namespace detail
+
+    // Parses UTF-8 JSON text. If the text is a top level array, its elements are parsed
+    // on up to thread_count threads (0 for std::thread::hardware_concurrency()).
+    // The result, and any error reported, is the same as from Json::parse.
+
+    template <class Json>
+    typename std::enable_if<sizeof(typename Json::char_type) == sizeof(char),Json>::type
+    parallel_parse(const jsoncons::basic_string_view<typename Json::char_type>& s,
+                   const basic_json_decode_options<typename Json::char_type>& options = basic_json_decode_options<typename Json::char_type>(),
+                   std::size_t thread_count = 0)
+    {
+        if (thread_count == 0)
+        {
+            thread_count = std::thread::hardware_concurrency();
+        }
+        if (thread_count == 0)
+        {
+            thread_count = 1;
+        }
+
+        auto bom = unicons::skip_bom(s.begin(), s.end());
+        if (bom.ec == unicons::encoding_errc())
+        {
+            std::size_t offset = bom.it - s.begin();
+            detail::parallel_array_parser<Json> parser(s.data() + offset, options);
+            Json result;
+            if (parser.parse(s.size() - offset, thread_count, result))
+            {
+                return result;
+            }
+        }
+        // Not an array, or an error: the sequential parser decides, and reports the error position
+        return Json::parse(s, options);
+    }
+
+} // namespace jsoncons
+
+#endif // JSONCONS_PARALLEL_PARSE_HPP
@@ -737,6 +737,16 @@ namespace jsoncons {
         }
     };
 
+    // A source whose content is already in memory may provide read_buffer(), which returns
+    // a span of the remaining content and consumes it, so that it can be parsed in place
+
+    template <class Source>
+    using source_read_buffer_t = decltype(std::declval<Source&>().read_buffer());
+
+    template <class Source>
+    struct is_contiguous_source 
+        : std::integral_constant<bool, jsoncons::detail::is_detected<source_read_buffer_t,Source>::value> {};
+
     template <class Source>
     struct source_reader
     {
@@ -9,12 +9,16 @@
 
 #include <memory> // std::allocator
 #include <string>
+#include <vector>
+#include <cstring> // std::memcpy
+#include <algorithm> // std::max
 #include <stdexcept>
 #include <system_error>
 #include <ios>
 #include <type_traits> // std::enable_if
 #include <array> // std::array
 #include <functional> // std::function
+#include <utility> // std::forward
 #include <jsoncons/json_exception.hpp>
 #include <jsoncons/json_visitor.hpp>
 #include <jsoncons/bigint.hpp>
@@ -135,9 +139,14 @@ std::basic_ostream<CharT>& operator<<(std::basic_ostream<CharT>& os, staj_event_
     return os;
 }
 
+template<class CharT>
+class basic_staj_event_batch;
+
 template<class CharT>
 class basic_staj_event
 {
+    friend class basic_staj_event_batch<CharT>;
+
     staj_event_type event_type_;
     semantic_tag tag_;
     uint64_t ext_tag_;
@@ -442,6 +451,205 @@ private:
     }
 };
 
+// basic_staj_event_batch
+
+// A batch of events filled by basic_staj_cursor::next_batch. Strings that lie in the 
+// content passed to borrow() are referred to in place, other strings and byte strings 
+// are copied into storage owned by the batch.
+
+template<class CharT>
+class basic_staj_event_batch
+{
+public:
+    using value_type = basic_staj_event<CharT>;
+    using const_iterator = typename std::vector<basic_staj_event<CharT>>::const_iterator;
+    using size_type = std::size_t;
+private:
+    std::size_t capacity_;
+    // Sized to the capacity up front, so that adding an event is an assignment
+    std::vector<basic_staj_event<CharT>> events_;
+    std::size_t size_;
+    // Holds the strings and byte strings of the events. Grows when full, 
+    // and keeps its size when the batch is cleared.
+    std::vector<CharT> text_;
+    std::size_t text_length_;
+    std::vector<uint8_t> bytes_;
+    std::size_t bytes_length_;
+    const CharT* borrowed_first_;
+    const CharT* borrowed_last_;
+    // The events before this one were added before the current borrow()
+    std::size_t borrowed_index_;
+public:
+    explicit basic_staj_event_batch(std::size_t capacity = 1024)
+        : capacity_(capacity > 0 ? capacity : 1), 
+          events_(capacity_, basic_staj_event<CharT>(staj_event_type::null_value)), size_(0),
+          text_length_(0), bytes_length_(0),
+          borrowed_first_(nullptr), borrowed_last_(nullptr), borrowed_index_(0)
+    {
+    }
+
+    std::size_t capacity() const
+    {
+        return capacity_;
+    }
+
+    std::size_t size() const
+    {
+        return size_;
+    }
+
+    bool empty() const
+    {
+        return size_ == 0;
+    }
+
+    bool full() const
+    {
+        return size_ >= capacity_;
+    }
+
+    const basic_staj_event<CharT>& operator[](std::size_t i) const
+    {
+        return events_[i];
+    }
+
+    const_iterator begin() const
+    {
+        return events_.begin();
+    }
+
+    const_iterator end() const
+    {
+        return events_.begin() + size_;
+    }
+
+    void clear()
+    {
+        size_ = 0;
+        text_length_ = 0;
+        bytes_length_ = 0;
+        borrowed_first_ = nullptr;
+        borrowed_last_ = nullptr;
+        borrowed_index_ = 0;
+    }
+
+    // Events added from now on refer to strings that lie in [first,last) in place.
+    // The content must stay unchanged while the batch is in use, or until copy_borrowed() 
+    // is called.
+    void borrow(const CharT* first, const CharT* last)
+    {
+        borrowed_first_ = first;
+        borrowed_last_ = last;
+        borrowed_index_ = size_;
+    }
+
+    // Copies the strings that refer to the content passed to borrow() into the batch,
+    // before that content is overwritten
+    void copy_borrowed()
+    {
+        for (std::size_t i = borrowed_index_; i < size_; ++i)
+        {
+            basic_staj_event<CharT>& ev = events_[i];
+            if ((ev.event_type() == staj_event_type::key || ev.event_type() == staj_event_type::string_value) &&
+                is_borrowed(ev.value_.string_data_, ev.length_))
+            {
+                ev.value_.string_data_ = copy_text(ev.value_.string_data_, ev.length_);
+            }
+        }
+        borrow(nullptr, nullptr);
+    }
+
+    // Appends a copy of event, along with the string or byte string it refers to,
+    // unless the string lies in the content passed to borrow()
+    void push_back(const basic_staj_event<CharT>& event)
+    {
+        if (size_ < events_.size())
+        {
+            events_[size_] = event;
+        }
+        else
+        {
+            events_.push_back(event);
+        }
+        basic_staj_event<CharT>& ev = events_[size_++];
+        switch (ev.event_type())
+        {
+            case staj_event_type::key:
+            case staj_event_type::string_value:
+                if (!is_borrowed(ev.value_.string_data_, ev.length_))
+                {
+                    ev.value_.string_data_ = copy_text(ev.value_.string_data_, ev.length_);
+                }
+                break;
+            case staj_event_type::byte_string_value:
+                ev.value_.byte_string_data_ = copy_bytes(ev.value_.byte_string_data_, ev.length_);
+                break;
+            default:
+                break;
+        }
+    }
+
+private:
+    bool is_borrowed(const CharT* data, std::size_t length) const
+    {
+        return borrowed_first_ != nullptr && data >= borrowed_first_ && data <= borrowed_last_ && 
+               length <= static_cast<std::size_t>(borrowed_last_ - data);
+    }
+
+    const CharT* copy_text(const CharT* data, std::size_t length)
+    {
+        static const CharT empty[1] = {};
+        if (length == 0)
+        {
+            return empty;
+        }
+        if (text_.size() - text_length_ < length)
+        {
+            const CharT* old_base = text_.data();
+            const CharT* old_end = old_base + text_length_;
+            text_.resize((std::max)(2*text_.size(), (std::max)(text_length_ + length, std::size_t(256))));
+            // Points the strings that were copied earlier into the new storage
+            for (std::size_t i = 0; i < size_; ++i)
+            {
+                basic_staj_event<CharT>& ev = events_[i];
+                if ((ev.event_type() == staj_event_type::key || ev.event_type() == staj_event_type::string_value) &&
+                    ev.value_.string_data_ >= old_base && ev.value_.string_data_ < old_end)
+                {
+                    ev.value_.string_data_ = text_.data() + (ev.value_.string_data_ - old_base);
+                }
+            }
+        }
+        CharT* p = text_.data() + text_length_;
+        std::memcpy(p, data, length*sizeof(CharT));
+        text_length_ += length;
+        return p;
+    }
+
+    const uint8_t* copy_bytes(const uint8_t* data, std::size_t length)
+    {
+        if (bytes_.size() - bytes_length_ < length)
+        {
+            const uint8_t* old_base = bytes_.data();
+            bytes_.resize((std::max)(2*bytes_.size(), (std::max)(bytes_length_ + length, std::size_t(256))));
+            for (std::size_t i = 0; i + 1 < size_; ++i)
+            {
+                basic_staj_event<CharT>& ev = events_[i];
+                if (ev.event_type() == staj_event_type::byte_string_value)
+                {
+                    ev.value_.byte_string_data_ = bytes_.data() + (ev.value_.byte_string_data_ - old_base);
+                }
+            }
+        }
+        uint8_t* p = bytes_.data() + bytes_length_;
+        if (length > 0)
+        {
+            std::memcpy(p, data, length);
+        }
+        bytes_length_ += length;
+        return p;
+    }
+};
+
 // basic_staj_visitor
 
 enum class staj_cursor_state
@@ -683,16 +891,17 @@ private:
     typed_array_view data_;
     jsoncons::span<const size_t> shape_;
     std::size_t index_;
+    basic_staj_event_batch<CharT>* batch_;
 public:
     basic_staj_visitor()
         : pred_(accept), event_(staj_event_type::null_value),
-          state_(), data_(), shape_(), index_(0)
+          state_(), data_(), shape_(), index_(0), batch_(nullptr)
     {
     }
 
     basic_staj_visitor(std::function<bool(const basic_staj_event<CharT>&, const ser_context&)> pred)
         : pred_(pred), event_(staj_event_type::null_value),
-          state_(), data_(), shape_(), index_(0)
+          state_(), data_(), shape_(), index_(0), batch_(nullptr)
     {
     }
 
@@ -701,6 +910,19 @@ public:
         return event_;
     }
 
+    // While batch is not null, accepted events are added to it instead of stopping 
+    // the parser, until it is full. Events of typed arrays and multi-dimensional 
+    // arrays are still reported one at a time.
+    void batch(basic_staj_event_batch<CharT>* batch)
+    {
+        batch_ = batch;
+    }
+
+    basic_staj_event_batch<CharT>* batch() const
+    {
+        return batch_;
+    }
+
     bool in_available() const
     {
         return state_ != staj_cursor_state();
@@ -987,52 +1209,68 @@ private:
         return true;
     }
 
+    // Returns true if the parser should stop at event_, false if event_ 
+    // was filtered out or added to the batch
+    bool stop_at_event(const ser_context& context)
+    {
+        if (!pred_(event_, context))
+        {
+            return false;
+        }
+        if (batch_ != nullptr && !batch_->full() && state_ == staj_cursor_state())
+        {
+            batch_->push_back(event_);
+            return false;
+        }
+        return true;
+    }
+
     bool visit_begin_object(semantic_tag tag, const ser_context& context, std::error_code&) override
     {
         event_ = basic_staj_event<CharT>(staj_event_type::begin_object, tag);
-        return !pred_(event_, context);
+        return !stop_at_event(context);
     }
 
     bool visit_end_object(const ser_context& context, std::error_code&) override
     {
         event_ = basic_staj_event<CharT>(staj_event_type::end_object);
-        return !pred_(event_, context);
+        return !stop_at_event(context);
     }
 
     bool visit_begin_array(semantic_tag tag, const ser_context& context, std::error_code&) override
     {
         event_ = basic_staj_event<CharT>(staj_event_type::begin_array, tag);
-        return !pred_(event_, context);
+        return !stop_at_event(context);
     }
 
     bool visit_end_array(const ser_context& context, std::error_code&) override
     {
         event_ = basic_staj_event<CharT>(staj_event_type::end_array);
-        return !pred_(event_, context);
+        return !stop_at_event(context);
     }
 
     bool visit_key(const string_view_type& name, const ser_context& context, std::error_code&) override
     {
         event_ = basic_staj_event<CharT>(name, staj_event_type::key);
-        return !pred_(event_, context);
+        return !stop_at_event(context);
     }
 
     bool visit_null(semantic_tag tag, const ser_context& context, std::error_code&) override
     {
         event_ = basic_staj_event<CharT>(staj_event_type::null_value, tag);
-        return !pred_(event_, context);
+        return !stop_at_event(context);
     }
 
     bool visit_bool(bool value, semantic_tag tag, const ser_context& context, std::error_code&) override
     {
         event_ = basic_staj_event<CharT>(value, tag);
-        return !pred_(event_, context);
+        return !stop_at_event(context);
     }
 
     bool visit_string(const string_view_type& s, semantic_tag tag, const ser_context& context, std::error_code&) override
     {
         event_ = basic_staj_event<CharT>(s, staj_event_type::string_value, tag);
-        return !pred_(event_, context);
+        return !stop_at_event(context);
     }
 
     bool visit_byte_string(const byte_string_view& s, 
@@ -1041,7 +1279,7 @@ private:
                            std::error_code&) override
     {
         event_ = basic_staj_event<CharT>(s, staj_event_type::byte_string_value, tag);
-        return !pred_(event_, context);
+        return !stop_at_event(context);
     }
 
     bool visit_byte_string(const byte_string_view& s, 
@@ -1050,7 +1288,7 @@ private:
                            std::error_code&) override
     {
         event_ = basic_staj_event<CharT>(s, staj_event_type::byte_string_value, ext_tag);
-        return !pred_(event_, context);
+        return !stop_at_event(context);
     }
 
     bool visit_uint64(uint64_t value, 
@@ -1059,7 +1297,7 @@ private:
                          std::error_code&) override
     {
         event_ = basic_staj_event<CharT>(value, tag);
-        return !pred_(event_, context);
+        return !stop_at_event(context);
     }
 
     bool visit_int64(int64_t value, 
@@ -1068,7 +1306,7 @@ private:
                   std::error_code&) override
     {
         event_ = basic_staj_event<CharT>(value, tag);
-        return !pred_(event_, context);
+        return !stop_at_event(context);
     }
 
     bool visit_half(uint16_t value, 
@@ -1077,7 +1315,7 @@ private:
                  std::error_code&) override
     {
         event_ = basic_staj_event<CharT>(half_arg, value, tag);
-        return !pred_(event_, context);
+        return !stop_at_event(context);
     }
 
     bool visit_double(double value, 
@@ -1086,7 +1324,7 @@ private:
                    std::error_code&) override
     {
         event_ = basic_staj_event<CharT>(value, tag);
-        return !pred_(event_, context);
+        return !stop_at_event(context);
     }
 
     bool visit_typed_array(const jsoncons::span<const uint8_t>& v, 
@@ -1239,6 +1477,32 @@ private:
     }
 };
 
+namespace detail {
+
+    // Makes a staj visitor add events to batch for the lifetime of the guard
+    template <class CharT>
+    class staj_batch_guard
+    {
+        basic_staj_visitor<CharT>& visitor_;
+
+        // Noncopyable
+        staj_batch_guard(const staj_batch_guard&) = delete;
+        staj_batch_guard& operator=(const staj_batch_guard&) = delete;
+    public:
+        staj_batch_guard(basic_staj_visitor<CharT>& visitor, basic_staj_event_batch<CharT>& batch)
+            : visitor_(visitor)
+        {
+            visitor_.batch(std::addressof(batch));
+        }
+
+        ~staj_batch_guard() noexcept
+        {
+            visitor_.batch(nullptr);
+        }
+    };
+
+} // namespace detail
+
 template<class CharT>
 bool staj_to_saj_event(const basic_staj_event<CharT>& ev,
                        basic_json_visitor<CharT>& visitor,
@@ -1308,17 +1572,104 @@ public:
     virtual void next(std::error_code& ec) = 0;
 
     virtual const ser_context& context() const = 0;
+
+    // Moves past the current event. If it begins an object or array, moves past the
+    // whole object or array, to the event that follows its end. Cursors override this
+    // to pass over the contents without reporting them as events.
+    virtual void skip()
+    {
+        std::error_code ec;
+        skip(ec);
+        if (ec)
+        {
+            JSONCONS_THROW(ser_error(ec,context().line(),context().column()));
+        }
+    }
+
+    virtual void skip(std::error_code& ec)
+    {
+        int depth = 0;
+        do
+        {
+            switch (current().event_type())
+            {
+                case staj_event_type::begin_object:
+                case staj_event_type::begin_array:
+                    ++depth;
+                    break;
+                case staj_event_type::end_object:
+                case staj_event_type::end_array:
+                    --depth;
+                    break;
+                default:
+                    break;
+            }
+            next(ec);
+        }
+        while (depth > 0 && !ec && !done());
+    }
+
+    // Copies the current event and the events that follow it into batch, up to
+    // batch.capacity() events, and moves to the event after the last one copied.
+    // Fewer events are copied only if the cursor is done afterwards, or on error.
+    // Cursors override this to have their parser add the events to the batch.
+    virtual void next_batch(basic_staj_event_batch<CharT>& batch)
+    {
+        std::error_code ec;
+        next_batch(batch, ec);
+        if (ec)
+        {
+            JSONCONS_THROW(ser_error(ec,context().line(),context().column()));
+        }
+    }
+
+    virtual void next_batch(basic_staj_event_batch<CharT>& batch, std::error_code& ec)
+    {
+        batch.clear();
+        while (!batch.full() && !done())
+        {
+            batch.push_back(current());
+            next(ec);
+            if (ec) return;
+        }
+    }
 };
 
-template<class CharT>
-class basic_staj_filter_view : basic_staj_cursor<CharT>
+template <class CharT,
+          class Pred = std::function<bool(const basic_staj_event<CharT>&, const ser_context&)>>
+class basic_staj_filter_view;
+
+namespace detail {
+
+    template <class Pred, class CharT>
+    using staj_filter_call_t = decltype(std::declval<Pred&>()(std::declval<const basic_staj_event<CharT>&>(),
+                                                             std::declval<const ser_context&>()));
+
+    // The view that operator| returns for a predicate, if Pred can be called with an event and a context
+    template <class CharT, class Pred>
+    using staj_filter_view_t = typename std::enable_if<is_detected_convertible<bool,staj_filter_call_t,typename std::decay<Pred>::type,CharT>::value,
+                                                       basic_staj_filter_view<CharT,typename std::decay<Pred>::type>>::type;
+
+} // namespace detail
+
+// A view of the events of a cursor for which pred returns true. The predicate is
+// stored by value and called directly, so a lambda or function object is inlined.
+// basic_staj_filter_view<CharT>, with the default std::function predicate,
+// can be initialized from a view with any predicate type.
+
+template <class CharT, class Pred>
+class basic_staj_filter_view : public basic_staj_cursor<CharT>
 {
+    template <class C, class P>
+    friend class basic_staj_filter_view;
+
     basic_staj_cursor<CharT>* cursor_;
-    std::function<bool(const basic_staj_event<CharT>&, const ser_context&)> pred_;
+    Pred pred_;
 public:
-    basic_staj_filter_view(basic_staj_cursor<CharT>& cursor, 
-                     std::function<bool(const basic_staj_event<CharT>&, const ser_context&)> pred)
-        : cursor_(std::addressof(cursor)), pred_(pred)
+    using predicate_type = Pred;
+
+    basic_staj_filter_view(basic_staj_cursor<CharT>& cursor, Pred pred)
+        : cursor_(std::addressof(cursor)), pred_(std::move(pred))
     {
         while (!done() && !pred_(current(),context()))
         {
@@ -1326,6 +1677,13 @@ public:
         }
     }
 
+    template <class P,
+              class = typename std::enable_if<!std::is_same<P,Pred>::value && std::is_constructible<Pred,P&&>::value>::type>
+    basic_staj_filter_view(basic_staj_filter_view<CharT,P>&& other)
+        : cursor_(other.cursor_), pred_(std::move(other.pred_))
+    {
+    }
+
     bool done() const override
     {
         return cursor_->done();
@@ -1365,16 +1723,35 @@ public:
         }
     }
 
+    void skip() override
+    {
+        cursor_->skip();
+        while (!done() && !pred_(current(),context()))
+        {
+            cursor_->next();
+        }
+    }
+
+    void skip(std::error_code& ec) override
+    {
+        cursor_->skip(ec);
+        while (!done() && !pred_(current(),context()) && !ec)
+        {
+            cursor_->next(ec);
+        }
+    }
+
     const ser_context& context() const override
     {
         return cursor_->context();
     }
 
-    friend
-    basic_staj_filter_view<CharT> operator|(basic_staj_filter_view& cursor, 
-                                      std::function<bool(const basic_staj_event<CharT>&, const ser_context&)> pred)
+    using basic_staj_cursor<CharT>::next_batch;
+
+    template <class P>
+    friend detail::staj_filter_view_t<CharT,P> operator|(basic_staj_filter_view& cursor, P&& pred)
     {
-        return basic_staj_filter_view<CharT>(cursor, pred);
+        return detail::staj_filter_view_t<CharT,P>(cursor, std::forward<P>(pred));
     }
 };
 
@@ -1387,6 +1764,9 @@ using wstaj_cursor = basic_staj_cursor<wchar_t>;
 using staj_filter_view = basic_staj_filter_view<char>;
 using wstaj_filter_view = basic_staj_filter_view<wchar_t>;
 
+using staj_event_batch = basic_staj_event_batch<char>;
+using wstaj_event_batch = basic_staj_event_batch<wchar_t>;
+
 #if !defined(JSONCONS_NO_DEPRECATED)
 
 JSONCONS_DEPRECATED_MSG("Instead, use staj_event_type") typedef staj_event_type stream_event_type;
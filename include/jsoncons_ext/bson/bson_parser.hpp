@@ -29,9 +29,10 @@ struct parse_state
     std::size_t length;
     uint8_t type;
     std::size_t index;
+    std::size_t pos; // source position after the length of a document or array
 
-    parse_state(parse_mode mode, std::size_t length, uint8_t type = 0) noexcept
-        : mode(mode), length(length), type(type), index(0)
+    parse_state(parse_mode mode, std::size_t length, uint8_t type = 0, std::size_t pos = 0) noexcept
+        : mode(mode), length(length), type(type), index(0), pos(pos)
     {
     }
 
@@ -56,6 +57,7 @@ class basic_bson_parser : public ser_context
     bool more_;
     bool done_;
     std::basic_string<char,std::char_traits<char>,char_allocator_type> text_buffer_;
+    std::vector<uint8_t,byte_allocator_type> bytes_buffer_;
     std::vector<parse_state,parse_state_allocator_type> state_stack_;
     int nesting_depth_;
 public:
@@ -68,6 +70,7 @@ public:
          more_(true), 
          done_(false),
          text_buffer_(alloc),
+         bytes_buffer_(alloc),
          state_stack_(alloc),
          nesting_depth_(0)
 
@@ -192,6 +195,38 @@ public:
         }
     }
 
+    // Skips the elements of the document or array that the last event began, without
+    // emitting events, using its length. The end of the document or array is reported
+    // by the next call to parse. Returns false if no document or array has begun.
+    bool skip_container(std::error_code& ec)
+    {
+        parse_state& state = state_stack_.back();
+        switch (state.mode)
+        {
+            case parse_mode::document:
+            case parse_mode::array:
+                break;
+            default:
+                return false;
+        }
+        // The length includes itself and the terminating null
+        const std::size_t consumed = sizeof(int32_t) + (source_.position() - state.pos);
+        if (state.length < consumed + 1)
+        {
+            ec = bson_errc::length_is_negative;
+            more_ = false;
+            return true;
+        }
+        const std::size_t remaining = state.length - consumed - 1;
+        source_.ignore(remaining);
+        if (source_.position() - state.pos + sizeof(int32_t) != state.length - 1)
+        {
+            ec = bson_errc::unexpected_eof;
+            more_ = false;
+        }
+        return true;
+    }
+
 private:
 
     void begin_document(json_visitor& visitor, std::error_code& ec)
@@ -212,7 +247,7 @@ private:
         auto length = jsoncons::detail::little_to_native<int32_t>(buf, sizeof(buf));
 
         more_ = visitor.begin_object(semantic_tag::none, *this, ec);
-        state_stack_.emplace_back(parse_mode::document,length);
+        state_stack_.emplace_back(parse_mode::document,length,0,source_.position());
     }
 
     void end_document(json_visitor& visitor, std::error_code& ec)
@@ -237,10 +272,10 @@ private:
             more_ = false;
             return;
         }
-        /* auto len = */ jsoncons::detail::little_to_native<int32_t>(buf, sizeof(buf));
+        auto length = jsoncons::detail::little_to_native<int32_t>(buf, sizeof(buf));
 
         more_ = visitor.begin_array(semantic_tag::none, *this, ec);
-        state_stack_.emplace_back(parse_mode::array,0);
+        state_stack_.emplace_back(parse_mode::array,length,0,source_.position());
     }
 
     void end_array(json_visitor& visitor, std::error_code& ec)
@@ -306,9 +341,9 @@ private:
                     return;
                 }
 
-                std::vector<char> s;
+                text_buffer_.clear();
                 std::size_t size = static_cast<std::size_t>(len) - static_cast<std::size_t>(1);
-                if (source_reader<Src>::read(source_,s,size) != size)
+                if (source_reader<Src>::read(source_,text_buffer_,size) != size)
                 {
                     ec = bson_errc::unexpected_eof;
                     more_ = false;
@@ -321,14 +356,14 @@ private:
                     more_ = false;
                     return;
                 }
-                auto result = unicons::validate(s.begin(),s.end());
+                auto result = unicons::validate(text_buffer_.begin(),text_buffer_.end());
                 if (result.ec != unicons::conv_errc())
                 {
                     ec = bson_errc::invalid_utf8_text_string;
                     more_ = false;
                     return;
                 }
-                more_ = visitor.string_value(jsoncons::basic_string_view<char>(s.data(),s.size()), semantic_tag::none, *this, ec);
+                more_ = visitor.string_value(jsoncons::basic_string_view<char>(text_buffer_.data(),text_buffer_.length()), semantic_tag::none, *this, ec);
                 break;
             }
             case jsoncons::bson::detail::bson_format::document_cd: 
@@ -438,15 +473,15 @@ private:
                     return;
                 }
 
-                std::vector<uint8_t> v;
-                if (source_reader<Src>::read(source_, v, len) != static_cast<std::size_t>(len))
+                bytes_buffer_.clear();
+                if (source_reader<Src>::read(source_, bytes_buffer_, len) != static_cast<std::size_t>(len))
                 {
                     ec = bson_errc::unexpected_eof;
                     more_ = false;
                     return;
                 }
 
-                more_ = visitor.byte_string_value(byte_string_view(v), 
+                more_ = visitor.byte_string_value(byte_string_view(bytes_buffer_), 
                                                   subtype.value(), 
                                                   *this,
                                                   ec);
@@ -27,6 +27,7 @@ enum class cbor_container_type {object, indefinite_length_object, array, indefin
 template<class Sink=jsoncons::binary_stream_sink,class Allocator=std::allocator<char>>
 class basic_cbor_encoder final : public basic_json_visitor<char>
 {
+    friend struct jsoncons::detail::json_visitor_access;
     using super_type = basic_json_visitor<char>;
 
     enum class decimal_parse_state { start, integer, exp1, exp2, fraction1 };
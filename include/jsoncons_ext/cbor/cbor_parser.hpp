@@ -321,7 +321,150 @@ public:
             }
         }
     }
+
+    // Skips the items of the array or map that the last event began, without emitting
+    // events, using the length prefixes to pass over strings and definite length arrays
+    // and maps. The end of the array or map is reported by the next call to parse.
+    // Returns false, having skipped nothing, inside a stringref namespace, where a
+    // skipped string could be referred to later, or inside a multi-dimensional array.
+    bool skip_container(std::error_code& ec)
+    {
+        if (!stringref_map_stack_.empty())
+        {
+            return false;
+        }
+        parse_state& state = state_stack_.back();
+        switch (state.mode)
+        {
+            case parse_mode::array:
+                for (; state.index < state.length; ++state.index)
+                {
+                    skip_item(nesting_depth_, ec);
+                    if (ec) return true;
+                }
+                return true;
+            case parse_mode::map_key:
+                for (; state.index < state.length; ++state.index)
+                {
+                    skip_item(nesting_depth_, ec);
+                    if (ec) return true;
+                    skip_item(nesting_depth_, ec);
+                    if (ec) return true;
+                }
+                return true;
+            case parse_mode::indefinite_array:
+            case parse_mode::indefinite_map_key:
+                while (!ec && !at_break(ec))
+                {
+                    skip_item(nesting_depth_, ec);
+                }
+                return true;
+            default:
+                return false;
+        }
+    }
 private:
+    bool at_break(std::error_code& ec)
+    {
+        auto c = source_.peek_character();
+        if (!c)
+        {
+            ec = cbor_errc::unexpected_eof;
+            more_ = false;
+            return false;
+        }
+        return c.value() == 0xff;
+    }
+
+    void skip_bytes(uint64_t count, std::error_code& ec)
+    {
+        const std::size_t position = source_.position();
+        source_.ignore(static_cast<std::size_t>(count));
+        if (source_.position() - position != count)
+        {
+            ec = cbor_errc::unexpected_eof;
+            more_ = false;
+        }
+    }
+
+    void skip_item(int depth, std::error_code& ec)
+    {
+        auto c = source_.peek_character();
+        if (!c)
+        {
+            ec = cbor_errc::unexpected_eof;
+            more_ = false;
+            return;
+        }
+        jsoncons::cbor::detail::cbor_major_type major_type = get_major_type(c.value());
+        uint8_t info = get_additional_information_value(c.value());
+
+        switch (major_type)
+        {
+            case jsoncons::cbor::detail::cbor_major_type::byte_string:
+            case jsoncons::cbor::detail::cbor_major_type::text_string:
+                if (info == jsoncons::cbor::detail::additional_info::indefinite_length)
+                {
+                    source_.ignore(1);
+                    while (!ec && !at_break(ec))
+                    {
+                        skip_bytes(get_uint64_value(ec), ec);
+                    }
+                    if (!ec)
+                    {
+                        source_.ignore(1);
+                    }
+                }
+                else
+                {
+                    uint64_t length = get_uint64_value(ec);
+                    if (ec) return;
+                    skip_bytes(length, ec);
+                }
+                break;
+            case jsoncons::cbor::detail::cbor_major_type::array:
+            case jsoncons::cbor::detail::cbor_major_type::map:
+            {
+                if (JSONCONS_UNLIKELY(++depth > options_.max_nesting_depth()))
+                {
+                    ec = cbor_errc::max_nesting_depth_exceeded;
+                    more_ = false;
+                    return;
+                }
+                const uint64_t items_per_entry = major_type == jsoncons::cbor::detail::cbor_major_type::map ? 2 : 1;
+                if (info == jsoncons::cbor::detail::additional_info::indefinite_length)
+                {
+                    source_.ignore(1);
+                    while (!ec && !at_break(ec))
+                    {
+                        skip_item(depth, ec);
+                    }
+                    if (!ec)
+                    {
+                        source_.ignore(1);
+                    }
+                }
+                else
+                {
+                    uint64_t length = get_uint64_value(ec);
+                    for (uint64_t i = 0; i < length*items_per_entry && !ec; ++i)
+                    {
+                        skip_item(depth, ec);
+                    }
+                }
+                break;
+            }
+            case jsoncons::cbor::detail::cbor_major_type::semantic_tag:
+                get_uint64_value(ec);
+                if (ec) return;
+                skip_item(depth, ec);
+                break;
+            default:
+                get_uint64_value(ec);
+                break;
+        }
+    }
+
     void read_item(json_visitor2& visitor, std::error_code& ec)
     {
         read_tags(ec);
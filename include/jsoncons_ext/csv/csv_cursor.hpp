@@ -14,6 +14,7 @@
 #include <system_error>
 #include <ios>
 #include <istream> // std::basic_istream
+#include <utility> // std::forward
 #include <jsoncons/byte_string.hpp>
 #include <jsoncons/config/jsoncons_config.hpp>
 #include <jsoncons/json_visitor.hpp>
@@ -60,7 +61,7 @@ public:
                      std::function<bool(csv_errc,const ser_context&)> err_handler = default_csv_parsing(),
                      const Allocator& alloc = Allocator(),
                      typename std::enable_if<!std::is_constructible<jsoncons::basic_string_view<CharT>,Source>::value>::type* = 0)
-       : source_(source),
+       : source_(std::forward<Source>(source)),
          parser_(options,err_handler,alloc),
          cursor_visitor_(accept_all),
          buffer_(alloc),
@@ -147,7 +148,7 @@ public:
                      std::function<bool(csv_errc,const ser_context&)> err_handler,
                      std::error_code& ec,
                      typename std::enable_if<!std::is_constructible<jsoncons::basic_string_view<CharT>,Source>::value>::type* = 0)
-       : source_(source),
+       : source_(std::forward<Source>(source)),
          parser_(options,err_handler,alloc),
          cursor_visitor_(accept_all),
          eof_(false),
@@ -246,12 +247,59 @@ public:
         read_next(ec);
     }
 
+    using basic_staj_cursor<CharT>::next_batch;
+
+    // The parser copies strings into its own buffer, so the batch copies them too
+    void next_batch(basic_staj_event_batch<CharT>& batch, std::error_code& ec) override
+    {
+        batch.clear();
+        if (done())
+        {
+            return;
+        }
+        batch.push_back(current());
+        // The parser stops when the batch is full or at the end of the input
+        jsoncons::detail::staj_batch_guard<CharT> guard(cursor_visitor_, batch);
+        read_next(ec);
+    }
+
     static bool accept_all(const basic_staj_event<CharT>&, const ser_context&) 
     {
         return true;
     }
 
     void read_buffer(std::error_code& ec)
+    {
+        read_buffer(ec, is_contiguous_source<Src>());
+    }
+
+    // The source content is already in memory, parse it in place
+    void read_buffer(std::error_code& ec, std::true_type)
+    {
+        auto s = source_.read_buffer();
+        if (s.size() == 0)
+        {
+            eof_ = true;
+        }
+        else if (begin_)
+        {
+            auto result = unicons::skip_bom(s.begin(), s.end());
+            if (result.ec != unicons::encoding_errc())
+            {
+                ec = result.ec;
+                return;
+            }
+            std::size_t offset = result.it - s.begin();
+            parser_.update(s.data()+offset,s.size()-offset);
+            begin_ = false;
+        }
+        else
+        {
+            parser_.update(s.data(),s.size());
+        }
+    }
+
+    void read_buffer(std::error_code& ec, std::false_type)
     {
         buffer_.clear();
         buffer_.resize(buffer_length_);
@@ -346,11 +394,11 @@ public:
         return parser_.column();
     }
 
+    template <class Pred>
     friend
-    basic_staj_filter_view<CharT> operator|(basic_csv_cursor& cursor, 
-                                      std::function<bool(const basic_staj_event<CharT>&, const ser_context&)> pred)
+    jsoncons::detail::staj_filter_view_t<CharT,Pred> operator|(basic_csv_cursor& cursor, Pred&& pred)
     {
-        return basic_staj_filter_view<CharT>(cursor, pred);
+        return jsoncons::detail::staj_filter_view_t<CharT,Pred>(cursor, std::forward<Pred>(pred));
     }
 
 #if !defined(JSONCONS_NO_DEPRECATED)
@@ -363,7 +411,7 @@ public:
                      std::function<bool(csv_errc,const ser_context&)> err_handler = default_csv_parsing(),
                      const Allocator& alloc = Allocator(),
                      typename std::enable_if<!std::is_constructible<jsoncons::basic_string_view<CharT>,Source>::value>::type* = 0)
-       : source_(source),
+       : source_(std::forward<Source>(source)),
          parser_(options,err_handler,alloc),
          cursor_visitor_(filter),
          buffer_(alloc),
@@ -459,7 +507,7 @@ public:
                      std::function<bool(csv_errc,const ser_context&)> err_handler,
                      std::error_code& ec,
                      typename std::enable_if<!std::is_constructible<jsoncons::basic_string_view<CharT>,Source>::value>::type* = 0)
-       : source_(source),
+       : source_(std::forward<Source>(source)),
          parser_(options,err_handler,alloc),
          cursor_visitor_(filter),
          eof_(false),
@@ -26,6 +26,7 @@ namespace jsoncons { namespace csv {
 template<class CharT,class Sink=jsoncons::stream_sink<CharT>,class Allocator=std::allocator<char>>
 class basic_csv_encoder final : public basic_json_visitor<CharT>
 {
+    friend struct jsoncons::detail::json_visitor_access;
 public:
     using char_type = CharT;
     using typename basic_json_visitor<CharT>::string_view_type;
@@ -15,6 +15,7 @@
 #include <jsoncons_ext/jsonschema/format_checkers.hpp>
 #include <cassert>
 #include <set>
+#include <unordered_set>
 #include <sstream>
 #include <iostream>
 #include <cassert>
@@ -928,14 +929,9 @@ namespace jsonschema {
                 reporter.error(validation_error(ptr.string(), message, "minItems"));
             }
 
-            if (unique_items_) 
+            if (unique_items_ && !array_has_unique_items(instance)) 
             {
-                for (auto it = instance.object_range().cbegin(); it != instance.object_range().cend(); ++it) 
-                {
-                    auto v = std::find(it + 1, instance.object_range().end(), *it);
-                    if (v != instance.object_range().end())
-                        reporter.error(validation_error(ptr.string(), "Array items are not unique", "uniqueItems"));
-                }
+                reporter.error(validation_error(ptr.string(), "Array items are not unique", "uniqueItems"));
             }
 
             size_t index = 0;
@@ -985,6 +981,36 @@ namespace jsonschema {
                     reporter.error(validation_error(ptr.string(), "Expected at least one array item to match \"contains\" schema", "contains"));
             }
         }
+
+    private:
+        struct item_hash
+        {
+            std::size_t operator()(const Json* val) const noexcept
+            {
+                return val->hash();
+            }
+        };
+
+        struct item_equal
+        {
+            bool operator()(const Json* lhs, const Json* rhs) const noexcept
+            {
+                return *lhs == *rhs;
+            }
+        };
+
+        static bool array_has_unique_items(const Json& instance)
+        {
+            std::unordered_set<const Json*,item_hash,item_equal> items(instance.size());
+            for (const auto& item : instance.array_range()) 
+            {
+                if (!items.insert(std::addressof(item)).second)
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
     };
 
     template <class Json>
@@ -185,6 +185,130 @@ public:
             }
         }
     }
+
+    // Skips the items of the array or map that the last event began, without emitting
+    // events, using the length prefixes. The end of the array or map is reported by the
+    // next call to parse. Returns false if no array or map has begun.
+    bool skip_container(std::error_code& ec)
+    {
+        parse_state& state = state_stack_.back();
+        std::size_t count;
+        switch (state.mode)
+        {
+            case parse_mode::array:
+                count = state.length - state.index;
+                break;
+            case parse_mode::map_key:
+                count = 2*(state.length - state.index);
+                break;
+            default:
+                return false;
+        }
+        state.index = state.length;
+
+        // Nested arrays and maps add their items to the count
+        while (count > 0)
+        {
+            --count;
+            auto ch = source_.get_character();
+            if (!ch)
+            {
+                ec = msgpack_errc::unexpected_eof;
+                more_ = false;
+                return true;
+            }
+            uint8_t type = ch.value();
+            std::size_t length = 0;
+            if (type <= 0x7f || type >= 0xe0) 
+            {
+                // fixint
+            }
+            else if (type <= 0x8f)
+            {
+                count += 2*(type & 0x0f); // fixmap
+            }
+            else if (type <= 0x9f)
+            {
+                count += type & 0x0f; // fixarray
+            }
+            else if (type <= 0xbf)
+            {
+                length = type & 0x1f; // fixstr
+            }
+            else
+            {
+                switch (type)
+                {
+                    case jsoncons::msgpack::detail::msgpack_format::nil_cd: 
+                    case jsoncons::msgpack::detail::msgpack_format::false_cd:
+                    case jsoncons::msgpack::detail::msgpack_format::true_cd:
+                        break;
+                    case jsoncons::msgpack::detail::msgpack_format::uint8_cd: 
+                    case jsoncons::msgpack::detail::msgpack_format::int8_cd: 
+                        length = 1;
+                        break;
+                    case jsoncons::msgpack::detail::msgpack_format::uint16_cd: 
+                    case jsoncons::msgpack::detail::msgpack_format::int16_cd: 
+                        length = 2;
+                        break;
+                    case jsoncons::msgpack::detail::msgpack_format::uint32_cd: 
+                    case jsoncons::msgpack::detail::msgpack_format::int32_cd: 
+                    case jsoncons::msgpack::detail::msgpack_format::float32_cd: 
+                        length = 4;
+                        break;
+                    case jsoncons::msgpack::detail::msgpack_format::uint64_cd: 
+                    case jsoncons::msgpack::detail::msgpack_format::int64_cd: 
+                    case jsoncons::msgpack::detail::msgpack_format::float64_cd: 
+                        length = 8;
+                        break;
+                    case jsoncons::msgpack::detail::msgpack_format::str8_cd: 
+                    case jsoncons::msgpack::detail::msgpack_format::str16_cd: 
+                    case jsoncons::msgpack::detail::msgpack_format::str32_cd: 
+                    case jsoncons::msgpack::detail::msgpack_format::bin8_cd: 
+                    case jsoncons::msgpack::detail::msgpack_format::bin16_cd: 
+                    case jsoncons::msgpack::detail::msgpack_format::bin32_cd: 
+                        length = get_size(type, ec);
+                        break;
+                    case jsoncons::msgpack::detail::msgpack_format::fixext1_cd: 
+                    case jsoncons::msgpack::detail::msgpack_format::fixext2_cd: 
+                    case jsoncons::msgpack::detail::msgpack_format::fixext4_cd: 
+                    case jsoncons::msgpack::detail::msgpack_format::fixext8_cd: 
+                    case jsoncons::msgpack::detail::msgpack_format::fixext16_cd: 
+                    case jsoncons::msgpack::detail::msgpack_format::ext8_cd: 
+                    case jsoncons::msgpack::detail::msgpack_format::ext16_cd: 
+                    case jsoncons::msgpack::detail::msgpack_format::ext32_cd: 
+                        length = get_size(type, ec) + 1; // the ext type follows the size
+                        break;
+                    case jsoncons::msgpack::detail::msgpack_format::array16_cd: 
+                    case jsoncons::msgpack::detail::msgpack_format::array32_cd: 
+                        count += get_size(type, ec);
+                        break;
+                    case jsoncons::msgpack::detail::msgpack_format::map16_cd: 
+                    case jsoncons::msgpack::detail::msgpack_format::map32_cd: 
+                        count += 2*get_size(type, ec);
+                        break;
+                    default:
+                        ec = msgpack_errc::unknown_type;
+                        more_ = false;
+                        break;
+                }
+                if (ec)
+                {
+                    return true;
+                }
+            }
+            const std::size_t position = source_.position();
+            source_.ignore(length);
+            if (source_.position() - position != length)
+            {
+                ec = msgpack_errc::unexpected_eof;
+                more_ = false;
+                return true;
+            }
+        }
+        return true;
+    }
+
 private:
 
     void read_item(json_visitor2& visitor, std::error_code& ec)
@@ -14,6 +14,7 @@
 #include <system_error>
 #include <ios>
 #include <istream> // std::basic_istream
+#include <utility> // std::forward
 #include <jsoncons/byte_string.hpp>
 #include <jsoncons/config/jsoncons_config.hpp>
 #include <jsoncons/json_visitor.hpp>
@@ -140,6 +141,52 @@ public:
         read_next(ec);
     }
 
+    using basic_staj_cursor<char_type>::next_batch;
+
+    // The parser copies strings into its own buffer, so the batch copies them too
+    void next_batch(basic_staj_event_batch<char_type>& batch, std::error_code& ec) override
+    {
+        batch.clear();
+        if (done())
+        {
+            return;
+        }
+        batch.push_back(current());
+        // The parser stops when the batch is full or at the end of the input
+        jsoncons::detail::staj_batch_guard<char_type> guard(cursor_visitor_, batch);
+        read_next(ec);
+    }
+
+    void skip() override
+    {
+        std::error_code ec;
+        skip(ec);
+        if (ec)
+        {
+            JSONCONS_THROW(ser_error(ec,parser_.line(),parser_.column()));
+        }
+    }
+
+    // Passes over the contents of an array or object using the counts and length prefixes,
+    // without decoding them
+    void skip(std::error_code& ec) override
+    {
+        if ((current().event_type() == staj_event_type::begin_object || current().event_type() == staj_event_type::begin_array) &&
+            parser_.skip_container(ec))
+        {
+            if (ec) return;
+            // Consume the end of the array or map without reporting it
+            basic_default_json_visitor<char_type> end_visitor(false);
+            read_next(end_visitor, ec);
+            if (ec) return;
+            read_next(ec);
+        }
+        else if (!ec)
+        {
+            basic_staj_cursor<char_type>::skip(ec);
+        }
+    }
+
     const ser_context& context() const override
     {
         return *this;
@@ -160,11 +207,11 @@ public:
         return parser_.column();
     }
 
+    template <class Pred>
     friend
-    staj_filter_view operator|(basic_ubjson_cursor& cursor, 
-                               std::function<bool(const staj_event&, const ser_context&)> pred)
+    jsoncons::detail::staj_filter_view_t<char,Pred> operator|(basic_ubjson_cursor& cursor, Pred&& pred)
     {
-        return staj_filter_view(cursor, pred);
+        return jsoncons::detail::staj_filter_view_t<char,Pred>(cursor, std::forward<Pred>(pred));
     }
 
 #if !defined(JSONCONS_NO_DEPRECATED)
@@ -28,6 +28,7 @@ enum class ubjson_container_type {object, indefinite_length_object, array, indef
 template<class Sink=jsoncons::binary_stream_sink,class Allocator=std::allocator<char>>
 class basic_ubjson_encoder final : public basic_json_visitor<char>
 {
+    friend struct jsoncons::detail::json_visitor_access;
 
     enum class decimal_parse_state { start, integer, exp1, exp2, fraction1 };
 public:
@@ -10,6 +10,7 @@
 #include <string>
 #include <memory>
 #include <utility> // std::move
+#include <limits> // std::numeric_limits
 #include <jsoncons/json.hpp>
 #include <jsoncons/source.hpp>
 #include <jsoncons/json_visitor.hpp>
@@ -301,7 +302,241 @@ public:
             }
         }
     }
+
+    // Skips the items of the array or object that the last event began, without emitting
+    // events, using the counts and length prefixes, and passing over strongly typed arrays
+    // of fixed size values in one step. The end of the array or object is reported by
+    // the next call to parse. Returns false if no array or object has begun.
+    bool skip_container(std::error_code& ec)
+    {
+        parse_state& state = state_stack_.back();
+        switch (state.mode)
+        {
+            case parse_mode::array:
+                for (; state.index < state.length && !ec; ++state.index)
+                {
+                    skip_type_and_value(nesting_depth_, ec);
+                }
+                return true;
+            case parse_mode::strongly_typed_array:
+                skip_values(state.type, state.length - state.index, nesting_depth_, ec);
+                state.index = state.length;
+                return true;
+            case parse_mode::indefinite_array:
+                while (!ec && !at_marker(jsoncons::ubjson::detail::ubjson_format::end_array_marker, ec))
+                {
+                    skip_type_and_value(nesting_depth_, ec);
+                }
+                return true;
+            case parse_mode::map_key:
+                for (; state.index < state.length && !ec; ++state.index)
+                {
+                    skip_key(ec);
+                    if (ec) return true;
+                    skip_type_and_value(nesting_depth_, ec);
+                }
+                return true;
+            case parse_mode::strongly_typed_map_key:
+                for (; state.index < state.length && !ec; ++state.index)
+                {
+                    skip_key(ec);
+                    if (ec) return true;
+                    skip_values(state.type, 1, nesting_depth_, ec);
+                }
+                return true;
+            case parse_mode::indefinite_map_key:
+                while (!ec && !at_marker(jsoncons::ubjson::detail::ubjson_format::end_object_marker, ec))
+                {
+                    skip_key(ec);
+                    if (ec) return true;
+                    skip_type_and_value(nesting_depth_, ec);
+                }
+                return true;
+            default:
+                return false;
+        }
+    }
 private:
+    bool at_marker(uint8_t marker, std::error_code& ec)
+    {
+        auto c = source_.peek_character();
+        if (!c)
+        {
+            ec = ubjson_errc::unexpected_eof;
+            more_ = false;
+            return false;
+        }
+        return c.value() == marker;
+    }
+
+    void skip_bytes(std::size_t count, std::error_code& ec)
+    {
+        const std::size_t position = source_.position();
+        source_.ignore(count);
+        if (source_.position() - position != count)
+        {
+            ec = ubjson_errc::unexpected_eof;
+            more_ = false;
+        }
+    }
+
+    void skip_key(std::error_code& ec)
+    {
+        std::size_t length = get_length(ec);
+        if (ec)
+        {
+            ec = ubjson_errc::key_expected;
+            more_ = false;
+            return;
+        }
+        skip_bytes(length, ec);
+    }
+
+    void skip_type_and_value(int depth, std::error_code& ec)
+    {
+        auto type = source_.get_character();
+        if (!type)
+        {
+            ec = ubjson_errc::unexpected_eof;
+            more_ = false;
+            return;
+        }
+        skip_values(type.value(), 1, depth, ec);
+    }
+
+    // Skips count values of the type
+    void skip_values(uint8_t type, std::size_t count, int depth, std::error_code& ec)
+    {
+        std::size_t size = 0;
+        switch (type)
+        {
+            case jsoncons::ubjson::detail::ubjson_format::null_type: 
+            case jsoncons::ubjson::detail::ubjson_format::no_op_type: 
+            case jsoncons::ubjson::detail::ubjson_format::true_type:
+            case jsoncons::ubjson::detail::ubjson_format::false_type:
+                return;
+            case jsoncons::ubjson::detail::ubjson_format::int8_type: 
+            case jsoncons::ubjson::detail::ubjson_format::uint8_type: 
+            case jsoncons::ubjson::detail::ubjson_format::char_type: 
+                size = 1;
+                break;
+            case jsoncons::ubjson::detail::ubjson_format::int16_type: 
+                size = 2;
+                break;
+            case jsoncons::ubjson::detail::ubjson_format::int32_type: 
+            case jsoncons::ubjson::detail::ubjson_format::float32_type: 
+                size = 4;
+                break;
+            case jsoncons::ubjson::detail::ubjson_format::int64_type: 
+            case jsoncons::ubjson::detail::ubjson_format::float64_type: 
+                size = 8;
+                break;
+            case jsoncons::ubjson::detail::ubjson_format::string_type: 
+            case jsoncons::ubjson::detail::ubjson_format::high_precision_number_type: 
+                for (std::size_t i = 0; i < count && !ec; ++i)
+                {
+                    std::size_t length = get_length(ec);
+                    if (ec) return;
+                    skip_bytes(length, ec);
+                }
+                return;
+            case jsoncons::ubjson::detail::ubjson_format::start_array_marker: 
+            case jsoncons::ubjson::detail::ubjson_format::start_object_marker: 
+                for (std::size_t i = 0; i < count && !ec; ++i)
+                {
+                    skip_nested(type == jsoncons::ubjson::detail::ubjson_format::start_object_marker, depth, ec);
+                }
+                return;
+            default:
+                ec = ubjson_errc::unknown_type;
+                more_ = false;
+                return;
+        }
+        if (count > (std::numeric_limits<std::size_t>::max)() / size)
+        {
+            ec = ubjson_errc::number_too_large;
+            more_ = false;
+            return;
+        }
+        skip_bytes(count*size, ec);
+    }
+
+    // Skips an array or object after its start marker
+    void skip_nested(bool is_object, int depth, std::error_code& ec)
+    {
+        if (JSONCONS_UNLIKELY(++depth > options_.max_nesting_depth()))
+        {
+            ec = ubjson_errc::max_nesting_depth_exceeded;
+            more_ = false;
+            return;
+        } 
+        if (at_marker(jsoncons::ubjson::detail::ubjson_format::type_marker, ec))
+        {
+            source_.ignore(1);
+            auto item_type = source_.get_character();
+            if (!item_type)
+            {
+                ec = ubjson_errc::unexpected_eof;
+                more_ = false;
+                return;
+            }
+            if (!at_marker(jsoncons::ubjson::detail::ubjson_format::count_marker, ec))
+            {
+                if (!ec)
+                {
+                    ec = ubjson_errc::count_required_after_type;
+                    more_ = false;
+                }
+                return;
+            }
+            source_.ignore(1);
+            std::size_t length = get_length(ec);
+            if (ec) return;
+            if (!is_object)
+            {
+                skip_values(item_type.value(), length, depth, ec);
+                return;
+            }
+            for (std::size_t i = 0; i < length && !ec; ++i)
+            {
+                skip_key(ec);
+                if (ec) return;
+                skip_values(item_type.value(), 1, depth, ec);
+            }
+        }
+        else if (at_marker(jsoncons::ubjson::detail::ubjson_format::count_marker, ec))
+        {
+            source_.ignore(1);
+            std::size_t length = get_length(ec);
+            for (std::size_t i = 0; i < length && !ec; ++i)
+            {
+                if (is_object)
+                {
+                    skip_key(ec);
+                    if (ec) return;
+                }
+                skip_type_and_value(depth, ec);
+            }
+        }
+        else
+        {
+            const uint8_t end_marker = is_object ? jsoncons::ubjson::detail::ubjson_format::end_object_marker : jsoncons::ubjson::detail::ubjson_format::end_array_marker;
+            while (!ec && !at_marker(end_marker, ec))
+            {
+                if (is_object)
+                {
+                    skip_key(ec);
+                    if (ec) return;
+                }
+                skip_type_and_value(depth, ec);
+            }
+            if (!ec)
+            {
+                source_.ignore(1);
+            }
+        }
+    }
+
     void read_type_and_value(json_visitor& visitor, std::error_code& ec)
     {
         if (source_.is_error())
@@ -451,7 +686,9 @@ private:
                     more_ = false;
                     return;
                 }
-                more_ = visitor.string_value(jsoncons::basic_string_view<char>(&c,1), semantic_tag::none, *this, ec);
+                text_buffer_.clear();
+                text_buffer_.push_back(c);
+                more_ = visitor.string_value(jsoncons::basic_string_view<char>(text_buffer_.data(),text_buffer_.length()), semantic_tag::none, *this, ec);
                 break;
             }
             case jsoncons::ubjson::detail::ubjson_format::string_type: 
@@ -77,3 +77,52 @@ TEST_CASE("bson_cursor reputon test")
     }
 }
 
+
+TEST_CASE("bson_cursor skip")
+{
+    json j = json::parse(R"({"a" : [1, {"b" : [2, "x", -3.5, null]}, 3], "c" : {"d" : "e"}, "f" : true})");
+    std::vector<uint8_t> data;
+    bson::encode_bson(j, data);
+
+    SECTION("bytes")
+    {
+        bson::bson_bytes_cursor cursor(data);
+        REQUIRE(cursor.current().event_type() == staj_event_type::begin_object);
+        cursor.next();
+        cursor.next();
+        REQUIRE(cursor.current().event_type() == staj_event_type::begin_array);
+        cursor.skip();
+        CHECK(cursor.current().get<std::string>() == "c");
+        cursor.next();
+        cursor.skip();
+        CHECK(cursor.current().get<std::string>() == "f");
+        cursor.next();
+        CHECK(cursor.current().get<bool>());
+        cursor.next();
+        CHECK(cursor.current().event_type() == staj_event_type::end_object);
+        cursor.next();
+        CHECK(cursor.done());
+    }
+
+    SECTION("stream")
+    {
+        std::string s(data.begin(), data.end());
+        std::istringstream is(s);
+        bson::bson_stream_cursor cursor(is);
+        cursor.next();
+        cursor.next();
+        cursor.skip();
+        CHECK(cursor.current().get<std::string>() == "c");
+    }
+
+    SECTION("unexpected end")
+    {
+        data.resize(data.size() / 2);
+        bson::bson_bytes_cursor cursor(data);
+        cursor.next();
+        cursor.next();
+        std::error_code ec;
+        cursor.skip(ec);
+        CHECK(ec == bson::bson_errc::unexpected_eof);
+    }
+}
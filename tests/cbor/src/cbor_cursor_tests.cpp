@@ -261,3 +261,161 @@ TEST_CASE("cbor_cursor with filter tests")
     CHECK(filtered_c.done());
 }
 
+
+TEST_CASE("cbor_cursor skip")
+{
+    SECTION("definite length")
+    {
+        json j = json::parse(R"({"a" : [1, {"b" : [2, "x", -3.5, null]}, 3], "c" : {"d" : "e"}, "f" : true})");
+        std::vector<uint8_t> data;
+        cbor::encode_cbor(j, data);
+
+        cbor::cbor_bytes_cursor cursor(data);
+        REQUIRE(cursor.current().event_type() == staj_event_type::begin_object);
+        cursor.next();
+        cursor.next();
+        REQUIRE(cursor.current().event_type() == staj_event_type::begin_array);
+        cursor.skip();
+        CHECK(cursor.current().get<std::string>() == "c");
+        cursor.next();
+        cursor.skip();
+        CHECK(cursor.current().get<std::string>() == "f");
+        cursor.next();
+        CHECK(cursor.current().get<bool>());
+        cursor.next();
+        CHECK(cursor.current().event_type() == staj_event_type::end_object);
+        cursor.next();
+        CHECK(cursor.done());
+
+        std::string s(data.begin(), data.end());
+        std::istringstream is(s);
+        cbor::cbor_stream_cursor stream_cursor(is);
+        stream_cursor.skip();
+        CHECK(stream_cursor.done());
+    }
+
+    SECTION("indefinite length and tags")
+    {
+        std::vector<uint8_t> data;
+        cbor::cbor_bytes_encoder encoder(data);
+        encoder.begin_object();
+        encoder.key("a");
+        encoder.begin_array();
+        encoder.byte_string_value(byte_string{1,2,3});
+        encoder.string_value("18446744073709551616", semantic_tag::bigint);
+        encoder.begin_object(1);
+        encoder.key("b");
+        encoder.begin_array();
+        encoder.uint64_value(1);
+        encoder.end_array();
+        encoder.end_object();
+        encoder.end_array();
+        encoder.key("c");
+        encoder.uint64_value(7);
+        encoder.end_object();
+        encoder.flush();
+
+        cbor::cbor_bytes_cursor cursor(data);
+        cursor.next();
+        cursor.next();
+        REQUIRE(cursor.current().event_type() == staj_event_type::begin_array);
+        cursor.skip();
+        CHECK(cursor.current().get<std::string>() == "c");
+        cursor.next();
+        CHECK(cursor.current().get<int>() == 7);
+        cursor.next();
+        CHECK(cursor.current().event_type() == staj_event_type::end_object);
+    }
+
+    SECTION("unexpected end")
+    {
+        json j = json::parse(R"({"a" : ["abc", "def"]})");
+        std::vector<uint8_t> data;
+        cbor::encode_cbor(j, data);
+        data.resize(data.size() - 2);
+
+        cbor::cbor_bytes_cursor cursor(data);
+        cursor.next();
+        cursor.next();
+        std::error_code ec;
+        cursor.skip(ec);
+        CHECK(ec == cbor::cbor_errc::unexpected_eof);
+    }
+
+    SECTION("max nesting depth")
+    {
+        json j = json::parse(R"({"a" : [[1, {"b" : [2]}]], "c" : 3})");
+        std::vector<uint8_t> data;
+        cbor::encode_cbor(j, data);
+
+        // The deepest container is exactly at the limit
+        auto options = cbor::cbor_options{}.max_nesting_depth(5);
+        cbor::cbor_bytes_cursor cursor(data, options);
+        cursor.next();
+        cursor.next();
+        REQUIRE(cursor.current().event_type() == staj_event_type::begin_array);
+        std::error_code ec;
+        cursor.skip(ec);
+        REQUIRE_FALSE(ec);
+        CHECK(cursor.current().get<std::string>() == "c");
+
+        auto options2 = cbor::cbor_options{}.max_nesting_depth(4);
+        cbor::cbor_bytes_cursor cursor2(data, options2);
+        cursor2.next();
+        cursor2.next();
+        REQUIRE(cursor2.current().event_type() == staj_event_type::begin_array);
+        cursor2.skip(ec);
+        CHECK(ec == cbor::cbor_errc::max_nesting_depth_exceeded);
+    }
+}
+
+TEST_CASE("cbor_cursor next_batch")
+{
+    std::vector<uint8_t> data;
+    {
+        cbor::cbor_options options;
+        options.use_typed_arrays(true);
+        cbor::cbor_bytes_encoder encoder(data, options);
+        encoder.begin_array();
+        for (int i = 0; i < 100; ++i)
+        {
+            encoder.begin_object();
+            encoder.key("id");
+            encoder.int64_value(-i);
+            encoder.key("name");
+            encoder.string_value("item" + std::to_string(i));
+            encoder.key("data");
+            encoder.byte_string_value(byte_string{1,2,static_cast<uint8_t>(i)});
+            encoder.key("values");
+            std::vector<uint16_t> values = {1,2,static_cast<uint16_t>(i)};
+            encoder.typed_array(jsoncons::span<const uint16_t>(values));
+            encoder.end_object();
+        }
+        encoder.end_array();
+        encoder.flush();
+    }
+
+    std::vector<std::pair<staj_event_type,std::string>> expected;
+    cbor::cbor_bytes_cursor expected_cursor(data);
+    for (; !expected_cursor.done(); expected_cursor.next())
+    {
+        std::error_code ec;
+        expected.emplace_back(expected_cursor.current().event_type(), expected_cursor.current().get<std::string>(ec));
+    }
+    REQUIRE(expected.size() == 100*14 + 2);
+
+    std::vector<std::pair<staj_event_type,std::string>> actual;
+    cbor::cbor_bytes_cursor cursor(data);
+    staj_event_batch batch(5);
+    while (!cursor.done())
+    {
+        cursor.next_batch(batch);
+        for (const auto& event : batch)
+        {
+            std::error_code ec;
+            actual.emplace_back(event.event_type(), event.get<std::string>(ec));
+        }
+    }
+    CHECK(actual == expected);
+}
+
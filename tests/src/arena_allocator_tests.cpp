@@ -0,0 +1,159 @@
+// Copyright 2021 Daniel Parker
+// Distributed under Boost license
+
+#include <jsoncons/json.hpp>
+#include <jsoncons/arena_allocator.hpp>
+#include <catch/catch.hpp>
+#include <sstream>
+#include <string>
+
+using namespace jsoncons;
+
+namespace {
+
+    // True if every string and container in j is allocated from a
+    template <class Json>
+    bool uses_arena(const Json& j, const arena& a)
+    {
+        switch (j.storage())
+        {
+            case storage_kind::long_string_value:
+            case storage_kind::byte_string_value:
+                return j.get_allocator().get_arena() == &a;
+            case storage_kind::array_value:
+                if (j.get_allocator().get_arena() != &a)
+                {
+                    return false;
+                }
+                for (const auto& item : j.array_range())
+                {
+                    if (!uses_arena(item, a))
+                    {
+                        return false;
+                    }
+                }
+                return true;
+            case storage_kind::object_value:
+                if (j.get_allocator().get_arena() != &a)
+                {
+                    return false;
+                }
+                for (const auto& kv : j.object_range())
+                {
+                    if (kv.key().get_allocator().get_arena() != &a || !uses_arena(kv.value(), a))
+                    {
+                        return false;
+                    }
+                }
+                return true;
+            default:
+                return true;
+        }
+    }
+
+    const std::string input = R"(
+{
+    "books": [
+        {"title": "A string that does not fit in a short string", "isbn": "0-395-19395-8", "price": 22.99},
+        {"title": "Another string that does not fit in a short string", "tags": ["fiction", "a long tag value for the heap"]}
+    ],
+    "a key that does not fit in a short string": {"nested": [[1, 2], {"x": "yet another long string value"}]}
+}
+)";
+
+} // namespace
+
+TEST_CASE("arena tests")
+{
+    SECTION("allocate and release")
+    {
+        arena a(256);
+        void* p1 = a.allocate(3, 1);
+        void* p2 = a.allocate(8, 8);
+        CHECK(reinterpret_cast<std::uintptr_t>(p2) % 8 == 0);
+        CHECK(p1 != p2);
+        void* p3 = a.allocate(1000, 16);  // larger than a block
+        CHECK(reinterpret_cast<std::uintptr_t>(p3) % 16 == 0);
+        CHECK(a.bytes_reserved() >= 1256);
+        a.release();
+        CHECK(a.bytes_reserved() == 0);
+    }
+
+    SECTION("default constructed allocator uses the heap")
+    {
+        arena_allocator<int> alloc;
+        CHECK(alloc.get_arena() == nullptr);
+        int* p = alloc.allocate(4);
+        alloc.deallocate(p, 4);
+        CHECK(alloc == arena_allocator<char>());
+    }
+}
+
+TEST_CASE("json_arena tests")
+{
+    SECTION("parse string into an arena")
+    {
+        arena a;
+        {
+            json_arena j = json_arena::parse(result_allocator_arg, a, input);
+            CHECK(a.bytes_reserved() > 0);
+            CHECK(uses_arena(j, a));
+            CHECK(j.to_string() == json::parse(input).to_string());
+        }
+        a.release();
+    }
+
+    SECTION("parse stream into an arena")
+    {
+        arena a;
+        std::istringstream is(input);
+        ojson_arena j = ojson_arena::parse(result_allocator_arg, a, is);
+        CHECK(uses_arena(j, a));
+        CHECK(j.to_string() == ojson::parse(input).to_string());
+    }
+
+    SECTION("copy into another arena")
+    {
+        arena a2;
+        json_arena j2;
+        {
+            arena a1;
+            json_arena j1 = json_arena::parse(result_allocator_arg, a1, input);
+            j2 = json_arena(j1, a2);
+            CHECK(uses_arena(j2, a2));
+
+            ojson_arena o1 = ojson_arena::parse(result_allocator_arg, a1, input);
+            ojson_arena o2(std::move(o1), a2);
+            CHECK(uses_arena(o2, a2));
+            CHECK(o2.to_string() == ojson::parse(input).to_string());
+        }
+        // a1 is gone
+        CHECK(j2.to_string() == json::parse(input).to_string());
+    }
+
+    SECTION("move into a container in another arena")
+    {
+        arena a1;
+        arena a2;
+        json_arena j1 = json_arena::parse(result_allocator_arg, a1, input);
+        json_arena arr(json_array_arg, semantic_tag::none, a2);
+        arr.push_back(std::move(j1));
+        arr.push_back(json_arena("A string that does not fit in a short string"));
+        CHECK(uses_arena(arr, a2));
+
+        json_arena obj(json_object_arg, semantic_tag::none, a2);
+        obj.insert_or_assign("a key that does not fit in a short string", arr[0]);
+        CHECK(uses_arena(obj, a2));
+        CHECK(obj.at("a key that does not fit in a short string") == arr[0]);
+    }
+
+    SECTION("move within an arena")
+    {
+        arena a;
+        json_arena j1 = json_arena::parse(result_allocator_arg, a, input);
+        std::size_t reserved = a.bytes_reserved();
+        json_arena j2(std::move(j1), a);
+        CHECK(uses_arena(j2, a));
+        CHECK(a.bytes_reserved() == reserved);
+    }
+}
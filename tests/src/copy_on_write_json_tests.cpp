@@ -0,0 +1,127 @@
+// Copyright 2021 Daniel Parker
+// Distributed under Boost license
+
+#include <jsoncons/json.hpp>
+#include <jsoncons_ext/jsonpatch/jsonpatch.hpp>
+#include <catch/catch.hpp>
+#include <string>
+#include <thread>
+#include <vector>
+#include <utility>
+
+using namespace jsoncons;
+
+using cow_json = basic_json<char,sorted_cow_policy>;
+using cow_ojson = basic_json<char,preserve_order_cow_policy>;
+
+TEST_CASE("copy on write json copies share storage")
+{
+    cow_json j1 = cow_json::parse(R"({"a" : [1, 2, {"b" : "x"}], "c" : {"d" : true}})");
+    cow_json j2 = j1;
+
+    const cow_json& c1 = j1;
+    const cow_json& c2 = j2;
+
+    CHECK(&c1.at("a") == &c2.at("a"));
+    CHECK(&c1.at("c").at("d") == &c2.at("c").at("d"));
+    CHECK(j1 == j2);
+
+    SECTION("mutation of a copy")
+    {
+        j2["a"][2]["b"] = "y";
+        j2["e"] = 10;
+
+        CHECK(c1.at("a").at(2).at("b").as<std::string>() == "x");
+        CHECK_FALSE(c1.contains("e"));
+        CHECK(c2.at("a").at(2).at("b").as<std::string>() == "y");
+        CHECK(c2.at("e").as<int>() == 10);
+
+        // Subtrees that were not written to are still shared
+        CHECK(&c1.at("c").at("d") == &c2.at("c").at("d"));
+        CHECK(&c1.at("a").at(0) != &c2.at("a").at(0));
+    }
+
+    SECTION("mutation of the original")
+    {
+        j1["a"].push_back(3);
+        j1.erase("c");
+
+        CHECK(c1.at("a").size() == 4);
+        CHECK(c2.at("a").size() == 3);
+        CHECK(c2.contains("c"));
+    }
+
+    SECTION("subtree copy")
+    {
+        cow_json a = c1.at("a");
+        const cow_json& ca = a;
+        CHECK(&ca.at(2) == &c1.at("a").at(2));
+        a.erase(a.array_range().begin());
+        CHECK(a.size() == 2);
+        CHECK(c1.at("a").size() == 3);
+        CHECK(&ca.at(1).at("b") == &c1.at("a").at(2).at("b"));
+    }
+}
+
+TEST_CASE("copy on write json preserve order")
+{
+    cow_ojson j1 = cow_ojson::parse(R"({"z" : 1, "a" : [2, 3]})");
+    cow_ojson j2 = j1;
+    j2.insert_or_assign("m", 4);
+
+    CHECK(j1.to_string() == R"({"z":1,"a":[2,3]})");
+    CHECK(j2.to_string() == R"({"z":1,"a":[2,3],"m":4})");
+}
+
+TEST_CASE("copy on write json with jsonpatch")
+{
+    cow_json target = cow_json::parse(R"({"a" : {"b" : [1, 2]}, "c" : "d"})");
+    cow_json patch = cow_json::parse(R"([{"op" : "add", "path" : "/a/b/-", "value" : 3}])");
+
+    cow_json before = target;
+    jsonpatch::apply_patch(target, patch);
+
+    CHECK(target == cow_json::parse(R"({"a" : {"b" : [1, 2, 3]}, "c" : "d"})"));
+    CHECK(before == cow_json::parse(R"({"a" : {"b" : [1, 2]}, "c" : "d"})"));
+}
+
+TEST_CASE("copy on write json shared between threads")
+{
+    cow_json doc(json_array_arg);
+    for (int i = 0; i < 100; ++i)
+    {
+        cow_json item;
+        item["id"] = i;
+        item["tags"] = cow_json(json_array_arg, {"x", "y"});
+        doc.push_back(std::move(item));
+    }
+
+    std::vector<std::thread> threads;
+    std::vector<std::size_t> sizes(4);
+    for (std::size_t t = 0; t < sizes.size(); ++t)
+    {
+        threads.emplace_back([&doc, &sizes, t]()
+        {
+            for (int n = 0; n < 50; ++n)
+            {
+                cow_json copy = doc;
+                copy[static_cast<std::size_t>(n)]["tags"].push_back(static_cast<uint64_t>(t));
+                sizes[t] = copy[static_cast<std::size_t>(n)]["tags"].size();
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    for (auto size : sizes)
+    {
+        CHECK(size == 3);
+    }
+    const cow_json& c = doc;
+    for (const auto& item : c.array_range())
+    {
+        CHECK(item.at("tags").size() == 2);
+    }
+}
@@ -9,6 +9,58 @@
 
 using namespace jsoncons;
 
+namespace {
+namespace ns {
+
+    struct hiking_reputon
+    {
+        std::string rater;
+        std::string assertion;
+        std::string rated;
+        double rating;
+        uint64_t generated;
+    };
+
+    struct hiking_reputation
+    {
+        std::string application;
+        std::vector<hiking_reputon> reputons;
+    };
+
+    struct book
+    {
+        std::string author;
+        std::string title;
+        double price;
+    };
+
+    class fixed_point
+    {
+        std::string kind_;
+        int64_t value_;
+    public:
+        fixed_point(const std::string& kind, int64_t value)
+            : kind_(kind), value_(value)
+        {
+        }
+        const std::string& kind() const {return kind_;}
+        int64_t value() const {return value_;}
+    };
+
+    const auto value_to_text = [](int64_t v) {return std::to_string(v);};
+    const auto value_from_text = [](const std::string& s) {return static_cast<int64_t>(std::stoll(s));};
+
+} // namespace ns
+} // namespace
+
+JSONCONS_ALL_MEMBER_TRAITS(ns::hiking_reputon, rater, assertion, rated, rating, generated)
+JSONCONS_ALL_MEMBER_TRAITS(ns::hiking_reputation, application, reputons)
+JSONCONS_N_MEMBER_NAME_TRAITS(ns::book, 2, (author,"Author"), (title,"Title"), 
+                              (price,"Price",JSONCONS_RDWR,[](double p) noexcept{return p >= 0;}))
+JSONCONS_ALL_CTOR_GETTER_NAME_TRAITS(ns::fixed_point, 
+                                     (kind,"kind",JSONCONS_RDWR,[](const std::string& k) noexcept{return k == "fixed";}),
+                                     (value,"value",JSONCONS_RDWR,always_true(),ns::value_to_text,ns::value_from_text))
+
 TEST_CASE("decode_traits primitive")
 {
     SECTION("is_primitive")
@@ -149,3 +201,134 @@ TEST_CASE("decode_traits deserialization errors")
         CHECK(ec == json_errc::expected_comma_or_right_brace);
     }
 }
+
+TEST_CASE("decode_traits types declared with the traits macros")
+{
+    SECTION("members in any order, unknown members skipped")
+    {
+        std::string input = R"(
+{
+    "reputons": [
+        {"generated": 1514862245, "rater": "HikingAsylum", "rating": 0.9, "assertion": "advanced",
+         "rated": "Marilyn C", "extra": {"a": [1, 2, {"b": null}]}},
+        {"rater": "HikingAsylum", "assertion": "intermediate", "rated": "Hongmin", "rating": 0.75,
+         "generated": 1514862246}
+    ],
+    "ignored": [[], {}],
+    "application": "hiking"
+}
+        )";
+
+        json_decoder<json> decoder;
+        std::error_code ec;
+
+        json_cursor cursor(input);
+        auto val = decode_traits<ns::hiking_reputation,char>::decode(cursor,decoder,ec);
+        REQUIRE_FALSE(ec);
+
+        CHECK(val.application == "hiking");
+        REQUIRE(val.reputons.size() == 2);
+        CHECK(val.reputons[0].rater == "HikingAsylum");
+        CHECK(val.reputons[0].assertion == "advanced");
+        CHECK(val.reputons[0].rated == "Marilyn C");
+        CHECK(val.reputons[0].rating == 0.9);
+        CHECK(val.reputons[0].generated == 1514862245);
+        CHECK(val.reputons[1].rated == "Hongmin");
+        CHECK(val.reputons[1].generated == 1514862246);
+    }
+    SECTION("missing mandatory member")
+    {
+        std::string input = R"({"rater": "HikingAsylum", "assertion": "advanced", "rated": "Marilyn C", "rating": 0.9})";
+
+        json_decoder<json> decoder;
+        std::error_code ec;
+
+        json_cursor cursor(input);
+        CHECK_THROWS_AS((decode_traits<ns::hiking_reputon,char>::decode(cursor,decoder,ec)), convert_error);
+        CHECK_FALSE(ec);
+        CHECK(cursor.current().event_type() == staj_event_type::end_object);
+    }
+    SECTION("not an object")
+    {
+        std::string input = R"(["HikingAsylum"])";
+
+        json_decoder<json> decoder;
+        std::error_code ec;
+
+        json_cursor cursor(input);
+        CHECK_THROWS_AS((decode_traits<ns::hiking_reputon,char>::decode(cursor,decoder,ec)), convert_error);
+        CHECK_FALSE(ec);
+    }
+    SECTION("member that cannot be converted")
+    {
+        std::string input = R"([{"rater": "HikingAsylum", "assertion": "advanced", "rated": "Marilyn C", "rating": "high", "generated": 1514862245}, 
+                                {"rater": "HikingAsylum", "assertion": "advanced", "rated": "Hongmin", "rating": 0.9, "generated": 1514862246},
+                                {"rater": "HikingAsylum", "assertion": "advanced", "rated": "Marilyn C", "rating": [0.9], "generated": 1514862245}, 
+                                ["HikingAsylum"],
+                                {"rater": "HikingAsylum", "assertion": "advanced", "rated": "Marilyn C", "rating": 0.9}, 
+                                {"rater": "HikingAsylum", "assertion": "advanced", "rated": "Sam", "rating": 0.8, "generated": 1514862247}])";
+
+        json_cursor cursor(input);
+        auto view = staj_array<ns::hiking_reputon>(cursor);
+        std::vector<std::string> rated;
+        for (auto it = view.begin(); it != view.end(); ++it)
+        {
+            if (it.has_value())
+            {
+                rated.push_back(it->rated);
+            }
+            else
+            {
+                CHECK_THROWS_AS(*it, convert_error);
+            }
+        }
+        REQUIRE(rated.size() == 2);
+        CHECK(rated[0] == "Hongmin");
+        CHECK(rated[1] == "Sam");
+    }
+    SECTION("optional members and match")
+    {
+        std::string input = R"([{"Title": "Pulp", "Author": "Charles Bukowski"},{"Author": "Haruki Murakami", "Title": "Kafka on the Shore", "Price": 25.17}])";
+
+        auto books = decode_json<std::vector<ns::book>>(input);
+        REQUIRE(books.size() == 2);
+        CHECK(books[0].author == "Charles Bukowski");
+        CHECK(books[0].title == "Pulp");
+        CHECK(books[0].price == 0);
+        CHECK(books[1].price == 25.17);
+
+        std::string bad_price = R"({"Author": "Haruki Murakami", "Title": "Kafka on the Shore", "Price": -1})";
+        CHECK_THROWS(decode_json<ns::book>(bad_price));
+    }
+    SECTION("constructor with converted members")
+    {
+        auto val = decode_json<ns::fixed_point>(std::string(R"({"value": "12345", "kind": "fixed"})"));
+        CHECK(val.kind() == "fixed");
+        CHECK(val.value() == 12345);
+
+        CHECK_THROWS(decode_json<ns::fixed_point>(std::string(R"({"value": "12345", "kind": "float"})")));
+        CHECK_THROWS(decode_json<ns::fixed_point>(std::string(R"({"kind": "fixed"})")));
+    }
+    SECTION("constructor with a parse error")
+    {
+        std::string input = R"({"kind": "fixed", "value" "12345"})";
+
+        json_decoder<json> decoder;
+        std::error_code ec;
+
+        json_cursor cursor(input);
+        CHECK_NOTHROW((decode_traits<ns::fixed_point,char>::decode(cursor,decoder,ec)));
+        CHECK(ec == json_errc::expected_colon);
+    }
+    SECTION("round trip through encode_json")
+    {
+        ns::hiking_reputation val{"hiking", {ns::hiking_reputon{"HikingAsylum","advanced","Marilyn C",0.9,1514862245}}};
+
+        std::string s;
+        encode_json(val, s);
+        auto other = decode_json<ns::hiking_reputation>(s);
+        CHECK(other.application == val.application);
+        REQUIRE(other.reputons.size() == 1);
+        CHECK(other.reputons[0].rated == "Marilyn C");
+    }
+}
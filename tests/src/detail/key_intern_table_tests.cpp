@@ -0,0 +1,110 @@
+// Copyright 2021 Daniel Parker
+// Distributed under Boost license
+
+#include <jsoncons/json.hpp>
+#include <jsoncons/detail/key_intern_table.hpp>
+#include <catch/catch.hpp>
+#include <string>
+#include <vector>
+
+using namespace jsoncons;
+
+TEST_CASE("key_intern_table tests")
+{
+    jsoncons::detail::key_intern_table<char> table;
+
+    SECTION("same key same id")
+    {
+        uint32_t a = table.intern("timestamp", 9);
+        uint32_t b = table.intern("user_id", 7);
+        CHECK(a != b);
+        CHECK(table.intern("timestamp", 9) == a);
+        CHECK(table.intern("user_id", 7) == b);
+        CHECK(table.key(a) == "timestamp");
+        CHECK(table.key_count() == 2);
+    }
+
+    SECTION("order of a shape")
+    {
+        std::vector<uint32_t> ids = {table.intern("c", 1), table.intern("a", 1), table.intern("b", 1), table.intern("ab", 2)};
+        const uint32_t* order = table.find_order(ids.data(), ids.size());
+        REQUIRE(order != nullptr);
+        CHECK(order[0] == 1); // a
+        CHECK(order[1] == 3); // ab
+        CHECK(order[2] == 2); // b
+        CHECK(order[3] == 0); // c
+        CHECK(table.find_order(ids.data(), ids.size()) != nullptr);
+        CHECK(table.shape_count() == 1);
+    }
+
+    SECTION("repeated key has no order")
+    {
+        std::vector<uint32_t> ids = {table.intern("a", 1), table.intern("b", 1), table.intern("a", 1)};
+        CHECK(table.find_order(ids.data(), ids.size()) == nullptr);
+        CHECK(table.find_order(ids.data(), ids.size()) == nullptr);
+    }
+
+    SECTION("many keys")
+    {
+        std::size_t n = jsoncons::detail::key_intern_table<char>::max_keys + 10;
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            std::string key = "key" + std::to_string(i);
+            uint32_t id = table.intern(key.data(), key.size());
+            if (i < jsoncons::detail::key_intern_table<char>::max_keys)
+            {
+                CHECK(id == i);
+            }
+            else
+            {
+                CHECK(id == jsoncons::detail::key_intern_table<char>::npos);
+            }
+        }
+        CHECK(table.intern("key7", 4) == 7);
+    }
+}
+
+TEST_CASE("json_decoder intern_keys tests")
+{
+    std::string s = R"(
+[
+    {"user_id":1, "timestamp":10, "tags":{"b":1,"a":2}},
+    {"user_id":2, "timestamp":20, "tags":{"b":3,"a":4}},
+    {"timestamp":30, "user_id":3},
+    {"user_id":4, "timestamp":40, "user_id":5},
+    {"user_id":6, "timestamp":50, "tags":{}},
+    {"user_id":6, "timestamp":50, "tags":{"b":5,"a":6}}
+]
+    )";
+    auto options = json_options{}.intern_keys(true);
+
+    SECTION("json")
+    {
+        json expected = json::parse(s);
+        json j = json::parse(s, options);
+        CHECK(j == expected);
+        CHECK(j.to_string() == expected.to_string());
+    }
+
+    SECTION("ojson")
+    {
+        ojson expected = ojson::parse(s);
+        ojson j = ojson::parse(s, options);
+        CHECK(j == expected);
+        CHECK(j.to_string() == expected.to_string());
+        CHECK(j[1]["tags"].at("a").as<int>() == 4);
+        CHECK(j[5]["tags"].contains("b"));
+    }
+
+    SECTION("decoder reused")
+    {
+        json_decoder<json> decoder;
+        decoder.intern_keys(true);
+        for (int i = 0; i < 2; ++i)
+        {
+            json_reader reader(s, decoder);
+            reader.read();
+            CHECK(decoder.get_result() == json::parse(s));
+        }
+    }
+}
@@ -0,0 +1,201 @@
+// Copyright 2021 Daniel Parker
+// Distributed under Boost license
+
+#include <catch/catch.hpp>
+#include <jsoncons/detail/simd_scan.hpp>
+#include <jsoncons/json.hpp>
+#include <jsoncons/json_encoder.hpp>
+#include <string>
+
+using namespace jsoncons;
+
+TEST_CASE("jsoncons::detail::find_string_special tests")
+{
+    SECTION("no special characters")
+    {
+        for (std::size_t n = 0; n < 200; ++n)
+        {
+            std::string s(n, 'a');
+            const char* first = s.data();
+            const char* last = s.data() + s.size();
+            CHECK(jsoncons::detail::find_string_special(first, last) == last);
+        }
+    }
+    SECTION("special character at every position")
+    {
+        const char specials[] = {'\"', '\\', '\x00', '\x1f', '\n', '\t'};
+        for (char c : specials)
+        {
+            for (std::size_t i = 0; i < 130; ++i)
+            {
+                std::string s(150, 'x');
+                s[i] = c;
+                s[i+5] = '\"';
+                const char* first = s.data();
+                const char* last = s.data() + s.size();
+                CHECK(jsoncons::detail::find_string_special(first, last) == first + i);
+            }
+        }
+    }
+    SECTION("non-ascii bytes are not special")
+    {
+        std::string s = "\xE6\x97\xA5\xD1\x88\xF0\x9D\x84\x9E\x7f\x80\xff\xE6\x97\xA5\xD1\x88\xF0\x9D\x84\x9E\"";
+        const char* first = s.data();
+        const char* last = s.data() + s.size();
+        CHECK(jsoncons::detail::find_string_special(first, last) == last - 1);
+    }
+    SECTION("wchar_t")
+    {
+        std::wstring s = L"abcdefghijklmnopqrstuvwxyz\\";
+        const wchar_t* first = s.data();
+        const wchar_t* last = s.data() + s.size();
+        CHECK(jsoncons::detail::find_string_special(first, last) == last - 1);
+    }
+}
+
+TEST_CASE("jsoncons::detail::find_escape_special tests")
+{
+    SECTION("special character at every position")
+    {
+        const char specials[] = {'\"', '\\', '\x00', '\x1f', '\n', '\x7f'};
+        for (char c : specials)
+        {
+            for (std::size_t i = 0; i < 130; ++i)
+            {
+                std::string s(150, 'x');
+                s[i] = c;
+                const char* first = s.data();
+                const char* last = s.data() + s.size();
+                CHECK(jsoncons::detail::find_escape_special(first, last, false, false) == first + i);
+            }
+        }
+    }
+    SECTION("solidus and non-ascii depend on the options")
+    {
+        for (std::size_t i = 0; i < 130; ++i)
+        {
+            std::string s(150, 'x');
+            s[i] = '/';
+            s[i+3] = '\xC3';
+            s[i+4] = '\xA9';
+            const char* first = s.data();
+            const char* last = s.data() + s.size();
+            CHECK(jsoncons::detail::find_escape_special(first, last, false, false) == last);
+            CHECK(jsoncons::detail::find_escape_special(first, last, true, false) == first + i);
+            CHECK(jsoncons::detail::find_escape_special(first, last, false, true) == first + i + 3);
+            CHECK(jsoncons::detail::find_escape_special(first, last, true, true) == first + i);
+        }
+    }
+    SECTION("wchar_t")
+    {
+        std::wstring s = L"abcdefghijklmnopqrstuvwxyz\u00e9/";
+        const wchar_t* first = s.data();
+        const wchar_t* last = s.data() + s.size();
+        CHECK(jsoncons::detail::find_escape_special(first, last, false, false) == last);
+        CHECK(jsoncons::detail::find_escape_special(first, last, true, false) == last - 1);
+        CHECK(jsoncons::detail::find_escape_special(first, last, false, true) == last - 2);
+    }
+}
+
+TEST_CASE("jsoncons::detail::escape_string with long strings")
+{
+    // Escaping one character at a time never takes the vectorized path
+    auto escape_one_at_a_time = [](const std::string& s, bool escape_all_non_ascii, bool escape_solidus)
+    {
+        std::string result;
+        for (char c : s)
+        {
+            jsoncons::detail::escape_string(&c, 1, escape_all_non_ascii, escape_solidus, result);
+        }
+        return result;
+    };
+
+    const std::string pieces[] = {"a", "\"", "\\", "/", "\n", "\x01", "\x7f", "0123456789abcdefghijklmnopqrstuvwxyz"};
+    for (std::size_t n = 0; n < 300; ++n)
+    {
+        std::string s;
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            s.append(pieces[(i*7 + n) % 8]);
+        }
+        for (int flags = 0; flags < 4; ++flags)
+        {
+            const bool escape_all_non_ascii = (flags & 1) != 0;
+            const bool escape_solidus = (flags & 2) != 0;
+            std::string result;
+            std::size_t count = jsoncons::detail::escape_string(s.data(), s.size(), escape_all_non_ascii, escape_solidus, result);
+            CHECK(result == escape_one_at_a_time(s, escape_all_non_ascii, escape_solidus));
+            CHECK(count == result.size());
+        }
+    }
+
+    SECTION("non-ascii")
+    {
+        std::string s(40, 'a');
+        s.append("\xC3\xA9");
+        s.append(40, 'b');
+        s.append("\xF0\x9D\x84\x9E");
+
+        std::string raw;
+        jsoncons::detail::escape_string(s.data(), s.size(), false, false, raw);
+        CHECK(raw == s);
+
+        std::string escaped;
+        jsoncons::detail::escape_string(s.data(), s.size(), true, false, escaped);
+        CHECK(escaped == std::string(40, 'a') + "\\u00E9" + std::string(40, 'b') + "\\uD834\\uDD1E");
+    }
+}
+
+TEST_CASE("jsoncons::detail::skip_blanks tests")
+{
+    for (std::size_t n = 0; n < 100; ++n)
+    {
+        std::string s(n, ' ');
+        s.append("\t \t");
+        s.push_back('x');
+        s.append(40, ' ');
+        const char* first = s.data();
+        const char* last = s.data() + s.size();
+        CHECK(jsoncons::detail::skip_blanks(first, last) == first + n + 3);
+    }
+}
+
+TEST_CASE("json parser with long strings and indentation")
+{
+    std::string long_string(1000, 'a');
+    long_string[500] = '\\';
+    long_string[501] = 'n';
+
+    std::string input = "{\n";
+    input.append(40, ' ');
+    input.append("\"key\"  \t  :   \"");
+    input.append(long_string);
+    input.append("\",\n");
+    input.append(40, '\t');
+    input.append("\"other\": \"");
+    input.append(300, 'b');
+    input.append("\"\n}");
+
+    json j = json::parse(input);
+
+    std::string expected(1000, 'a');
+    expected.replace(500, 2, "\n");
+    CHECK(j["key"].as<std::string>() == expected);
+    CHECK(j["other"].as<std::string>() == std::string(300, 'b'));
+}
+
+TEST_CASE("json parser reports position of control character in long string")
+{
+    std::string input = "\"";
+    input.append(100, 'a');
+    input.push_back('\x01');
+    input.append("\"");
+
+    std::error_code ec;
+    json_decoder<json> decoder;
+    json_reader reader(input, decoder, strict_json_parsing());
+    reader.read(ec);
+    CHECK(ec == json_errc::illegal_control_character);
+    CHECK(reader.line() == 1);
+    CHECK(reader.column() == 103);
+}
@@ -6,6 +6,9 @@
 #include <catch/catch.hpp>
 #include <iostream>
 #include <cstdio>
+#include <cstring>
+#include <limits>
+#include <random>
 
 using namespace jsoncons;
 
@@ -56,7 +59,7 @@ static void check_dtoa(double x, const std::vector<std::string>& expected)
     check_safe_dtoa(x,expected);
 }
 
-TEST_CASE("test grisu3")
+TEST_CASE("test dtoa_general")
 {
     check_dtoa(1.0e100, {"1e+100"});
     check_dtoa(1.0e-100, {"1e-100"});
@@ -98,3 +101,109 @@ TEST_CASE("test grisu3")
     check_dtoa(0.000071, {"7.1e-05"}); 
 }
 
+static void check_shortest_dtoa(double x, const std::string& expected)
+{
+    std::string s;
+    REQUIRE(jsoncons::detail::dtoa_general(x, '.', s));
+    CHECK(s == expected);
+}
+
+TEST_CASE("test dtoa_general shortest round trip")
+{
+    check_shortest_dtoa(5e-324, "5e-324");
+    check_shortest_dtoa(1e-323, "1e-323");
+    check_shortest_dtoa(2.2250738585072014e-308, "2.2250738585072014e-308");
+    check_shortest_dtoa(2.225073858507201e-308, "2.225073858507201e-308");
+    check_shortest_dtoa((std::numeric_limits<double>::max)(), "1.7976931348623157e+308");
+    check_shortest_dtoa(9007199254740993.0, "9007199254740992.0");
+    check_shortest_dtoa(123456789012345680.0, "1.2345678901234568e+17");
+    check_shortest_dtoa(5e22, "5e+22");
+    check_shortest_dtoa(0.3, "0.3");
+    check_shortest_dtoa(2.0/3.0, "0.6666666666666666");
+
+    SECTION("random doubles")
+    {
+        jsoncons::detail::to_double_t to_double;
+        std::mt19937_64 gen(2021);
+        for (int i = 0; i < 100000; ++i)
+        {
+            uint64_t bits = gen() & 0x7fefffffffffffffULL;
+            double x;
+            std::memcpy(&x, &bits, sizeof(x));
+            if (x == 0)
+            {
+                continue;
+            }
+
+            std::string s;
+            REQUIRE(jsoncons::detail::dtoa_general(x, '.', s));
+            CHECK(to_double(s.c_str(), s.size()) == x);
+
+            // No more digits than the shortest correctly rounded printf output that round trips
+            char buffer[32];
+            int precision = 1;
+            for (; precision < 17; ++precision)
+            {
+                int length = snprintf(buffer, sizeof(buffer), "%.*e", precision-1, x);
+                if (to_double(buffer, static_cast<std::size_t>(length)) == x)
+                {
+                    break;
+                }
+            }
+            int length = 0;
+            int k = 0;
+            jsoncons::detail::schubfach(x, buffer, length, k);
+            CHECK(length <= precision);
+        }
+    }
+}
+
+TEST_CASE("test dtoa_scientific and dtoa_fixed")
+{
+    std::string s;
+
+    jsoncons::detail::dtoa_scientific(1.5, '.', s);
+    CHECK(s == "1.5e+00");
+    s.clear();
+    jsoncons::detail::dtoa_scientific(-1234.5, '.', s);
+    CHECK(s == "-1.2345e+03");
+    s.clear();
+    jsoncons::detail::dtoa_scientific(1e-7, '.', s);
+    CHECK(s == "1e-07");
+    s.clear();
+    jsoncons::detail::dtoa_scientific(0.1, '.', s);
+    CHECK(s == "1e-01");
+    s.clear();
+    jsoncons::detail::dtoa_scientific(0.0, '.', s);
+    CHECK(s == "0.0");
+
+    s.clear();
+    jsoncons::detail::dtoa_fixed(1e-7, '.', s);
+    CHECK(s == "0.0000001");
+    s.clear();
+    jsoncons::detail::dtoa_fixed(1.25e20, '.', s);
+    CHECK(s == "125000000000000000000.0");
+    s.clear();
+    jsoncons::detail::dtoa_fixed(-42.23, '.', s);
+    CHECK(s == "-42.23");
+
+    SECTION("round trip")
+    {
+        jsoncons::detail::to_double_t to_double;
+        std::mt19937_64 gen(7);
+        for (int i = 0; i < 10000; ++i)
+        {
+            uint64_t bits = gen() & 0x7fefffffffffffffULL;
+            double x;
+            std::memcpy(&x, &bits, sizeof(x));
+
+            std::string sci;
+            jsoncons::detail::dtoa_scientific(x, '.', sci);
+            CHECK(to_double(sci.c_str(), sci.size()) == x);
+
+            std::string fixed;
+            jsoncons::detail::dtoa_fixed(x, '.', fixed);
+            CHECK(to_double(fixed.c_str(), fixed.size()) == x);
+        }
+    }
+}
@@ -6,6 +6,8 @@
 #endif
 #include <catch/catch.hpp>
 #include <jsoncons/json.hpp>
+#include <jsoncons_ext/cbor/cbor.hpp>
+#include <memory>
 #include <vector>
 
 using jsoncons::json_type_traits;
@@ -31,11 +33,35 @@ namespace encode_traits_tests {
         {
         }
     };
+
+    struct reading
+    {
+        std::string station;
+        double value;
+        std::shared_ptr<std::string> note;
+        jsoncons::optional<int> flags;
+    };
+
+    class sample
+    {
+        std::string id_;
+        std::vector<reading> readings_;
+    public:
+        sample(const std::string& id, const std::vector<reading>& readings)
+            : id_(id), readings_(readings)
+        {
+        }
+        const std::string& id() const {return id_;}
+        const std::vector<reading>& readings() const {return readings_;}
+    };
 } // namespace encode_traits_tests
 
 namespace ns = encode_traits_tests;
 
 JSONCONS_ALL_MEMBER_TRAITS(ns::book,author,title,price)
+JSONCONS_N_MEMBER_NAME_TRAITS(ns::reading, 2, (value,"value"), (station,"station/name"), 
+                              (note,"note \u00e9"), (flags,"\"flags\""))
+JSONCONS_ALL_CTOR_GETTER_TRAITS(ns::sample, readings, id)
 
 TEST_CASE("decode_traits string tests")
 {
@@ -130,3 +156,73 @@ TEST_CASE("decode_traits std::pair tests")
     }
 }
 
+
+TEST_CASE("encode_traits types declared with the traits macros")
+{
+    std::vector<ns::sample> samples;
+    samples.emplace_back("s1", std::vector<ns::reading>{ns::reading{"Rain\tGauge", 1.5, nullptr, jsoncons::optional<int>()},
+                                                        ns::reading{"Wind", 20, std::make_shared<std::string>("gusts"), 3}});
+    samples.emplace_back("s2", std::vector<ns::reading>{});
+
+    SECTION("same text as through json")
+    {
+        json j = json_type_traits<json,std::vector<ns::sample>>::to_json(samples);
+
+        std::string expected;
+        j.dump(expected);
+        std::string buf;
+        encode_json(samples, buf);
+        CHECK(buf == expected);
+
+        expected.clear();
+        j.dump(expected, jsoncons::indenting::indent);
+        buf.clear();
+        encode_json(samples, buf, jsoncons::indenting::indent);
+        CHECK(buf == expected);
+
+        jsoncons::json_options options;
+        options.escape_all_non_ascii(true)
+               .escape_solidus(true);
+        expected.clear();
+        j.dump(expected, options);
+        buf.clear();
+        encode_json(samples, buf, options);
+        CHECK(buf == expected);
+    }
+    SECTION("same order as ojson")
+    {
+        jsoncons::ojson j = json_type_traits<jsoncons::ojson,std::vector<ns::sample>>::to_json(samples);
+
+        std::string expected;
+        j.dump(expected);
+        std::string buf;
+        jsoncons::compact_json_string_encoder encoder(buf);
+        std::error_code ec;
+        jsoncons::encode_traits<std::vector<ns::sample>,char>::encode(samples, encoder, jsoncons::ojson(), ec);
+        REQUIRE_FALSE(ec);
+        encoder.flush();
+        CHECK(buf == expected);
+    }
+    SECTION("wide characters")
+    {
+        std::vector<ns::book> books{ns::book{"Haruki Murakami","Kafka on the Shore",25.17}, 
+                                    ns::book{"Charles Bukowski","Pulp",22.48}};
+        wjson j = json_type_traits<wjson,std::vector<ns::book>>::to_json(books);
+
+        std::wstring expected;
+        j.dump(expected);
+        std::wstring buf;
+        encode_json(books, buf);
+        CHECK((buf == expected));
+    }
+    SECTION("same bytes as through json with cbor")
+    {
+        json j = json_type_traits<json,std::vector<ns::sample>>::to_json(samples);
+
+        std::vector<uint8_t> expected;
+        jsoncons::cbor::encode_cbor(j, expected);
+        std::vector<uint8_t> buf;
+        jsoncons::cbor::encode_cbor(samples, buf);
+        CHECK(buf == expected);
+    }
+}
@@ -0,0 +1,204 @@
+// Copyright 2021 Daniel Parker
+// Distributed under Boost license
+
+#include <jsoncons/json.hpp>
+#include <jsoncons/fd_sink.hpp>
+#include <jsoncons_ext/cbor/cbor.hpp>
+#include <jsoncons_ext/msgpack/msgpack.hpp>
+#include <catch/catch.hpp>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#if defined(JSONCONS_HAS_FD_SINK)
+
+#include <fcntl.h>
+#include <unistd.h>
+
+using namespace jsoncons;
+
+namespace {
+
+    int open_for_write(const std::string& path)
+    {
+        return ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    }
+
+    std::vector<uint8_t> read_file(const std::string& path)
+    {
+        std::ifstream is(path, std::ios::binary);
+        return std::vector<uint8_t>((std::istreambuf_iterator<char>(is)), std::istreambuf_iterator<char>());
+    }
+
+    json make_document(std::size_t count)
+    {
+        json doc(json_array_arg);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            json item;
+            item["id"] = i;
+            item["name"] = std::string("item-") + std::to_string(i);
+            item["values"] = json(json_array_arg, {1.5, 2.5, 3.5});
+            doc.push_back(std::move(item));
+        }
+        return doc;
+    }
+
+} // namespace
+
+TEST_CASE("fd_sink with json_encoder")
+{
+    const std::string path = "./output/fd_sink.json";
+    json doc = make_document(2000);
+    std::string expected;
+    doc.dump(expected);
+
+    SECTION("small buffer")
+    {
+        int fd = open_for_write(path);
+        REQUIRE(fd >= 0);
+        {
+            basic_compact_json_encoder<char,fd_sink<char>> encoder(fd_sink<char>(fd, 64));
+            doc.dump(encoder);
+        }
+        ::close(fd);
+        std::vector<uint8_t> actual = read_file(path);
+        CHECK(std::string(actual.begin(), actual.end()) == expected);
+    }
+
+    SECTION("default buffer")
+    {
+        int fd = open_for_write(path);
+        REQUIRE(fd >= 0);
+        {
+            basic_compact_json_encoder<char,fd_sink<char>> encoder(fd);
+            doc.dump(encoder);
+        }
+        ::close(fd);
+        std::vector<uint8_t> actual = read_file(path);
+        CHECK(std::string(actual.begin(), actual.end()) == expected);
+    }
+
+    SECTION("writer thread")
+    {
+        int fd = open_for_write(path);
+        REQUIRE(fd >= 0);
+        {
+            basic_compact_json_encoder<char,fd_sink<char>> encoder(fd_sink<char>(fd, 100, fd_write_mode::writer_thread));
+            doc.dump(encoder);
+        }
+        ::close(fd);
+        std::vector<uint8_t> actual = read_file(path);
+        CHECK(std::string(actual.begin(), actual.end()) == expected);
+    }
+
+    std::remove(path.c_str());
+}
+
+TEST_CASE("fd_sink append and push_back")
+{
+    const std::string path = "./output/fd_sink.txt";
+    std::string expected;
+    std::string chunk(1000, 'x');
+
+    int fd = open_for_write(path);
+    REQUIRE(fd >= 0);
+    {
+        fd_sink<char> sink(fd, 256, fd_write_mode::writer_thread);
+        for (int i = 0; i < 100; ++i)
+        {
+            char c = static_cast<char>('a' + i % 26);
+            sink.push_back(c);
+            expected.push_back(c);
+            // Larger than the buffer, written together with the buffered bytes
+            if (i % 10 == 0)
+            {
+                sink.append(chunk.data(), chunk.size());
+                expected.append(chunk);
+            }
+            sink.append("abc", 3);
+            expected.append("abc");
+        }
+        sink.flush();
+        CHECK_FALSE(sink.is_error());
+        std::vector<uint8_t> actual = read_file(path);
+        CHECK(std::string(actual.begin(), actual.end()) == expected);
+
+        sink.append("end", 3);
+        expected.append("end");
+    }
+    ::close(fd);
+
+    std::vector<uint8_t> actual = read_file(path);
+    CHECK(std::string(actual.begin(), actual.end()) == expected);
+    std::remove(path.c_str());
+}
+
+TEST_CASE("binary_fd_sink with cbor and msgpack encoders")
+{
+    const std::string path = "./output/fd_sink.bin";
+    json doc = make_document(500);
+
+    SECTION("cbor")
+    {
+        std::vector<uint8_t> expected;
+        cbor::encode_cbor(doc, expected);
+
+        int fd = open_for_write(path);
+        REQUIRE(fd >= 0);
+        {
+            cbor::basic_cbor_encoder<binary_fd_sink> encoder(binary_fd_sink(fd, 128, fd_write_mode::writer_thread));
+            doc.dump(encoder);
+        }
+        ::close(fd);
+        std::vector<uint8_t> actual = read_file(path);
+        CHECK(actual == expected);
+        CHECK(cbor::decode_cbor<json>(actual) == doc);
+    }
+
+    SECTION("msgpack")
+    {
+        std::vector<uint8_t> expected;
+        msgpack::encode_msgpack(doc, expected);
+
+        int fd = open_for_write(path);
+        REQUIRE(fd >= 0);
+        {
+            msgpack::basic_msgpack_encoder<binary_fd_sink> encoder(fd);
+            doc.dump(encoder);
+        }
+        ::close(fd);
+        std::vector<uint8_t> actual = read_file(path);
+        CHECK(actual == expected);
+    }
+
+    std::remove(path.c_str());
+}
+
+TEST_CASE("fd_sink write errors")
+{
+    SECTION("bad descriptor")
+    {
+        fd_sink<char> sink(-1, 16);
+        sink.append("[1,2,3]", 7);
+        CHECK_FALSE(sink.is_error());
+        sink.flush();
+        CHECK(sink.is_error());
+        CHECK(sink.error_code() == std::errc::bad_file_descriptor);
+    }
+
+    SECTION("bad descriptor with writer thread")
+    {
+        binary_fd_sink sink(-1, 16, fd_write_mode::writer_thread);
+        for (uint8_t i = 0; i < 100; ++i)
+        {
+            sink.push_back(i);
+        }
+        sink.flush();
+        CHECK(sink.error_code() == std::errc::bad_file_descriptor);
+    }
+}
+
+#endif // defined(JSONCONS_HAS_FD_SINK)
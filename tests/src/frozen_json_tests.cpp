@@ -0,0 +1,164 @@
+// Copyright 2021 Daniel Parker
+// Distributed under Boost license
+
+#include <jsoncons/json.hpp>
+#include <jsoncons/frozen_json.hpp>
+#include <catch/catch.hpp>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <map>
+
+using namespace jsoncons;
+
+TEST_CASE("frozen_json accessors")
+{
+    std::string s = R"(
+    {
+        "name" : "Toronto",
+        "population" : 2731571,
+        "area" : 630.2,
+        "offset" : -5,
+        "capital" : false,
+        "mayor" : null,
+        "neighbourhoods" : ["Annex", "Leslieville", "Yorkville"],
+        "coordinates" : {"lat" : 43.7, "lon" : -79.4},
+        "" : "empty"
+    }
+    )";
+
+    auto doc = frozen_json::parse(s);
+
+    REQUIRE(doc.is_object());
+    CHECK(doc.size() == 9);
+    CHECK(doc.at("name").as<std::string>() == "Toronto");
+    CHECK(doc.at("name").as<string_view>() == "Toronto");
+    CHECK(doc.at("population").as<int>() == 2731571);
+    CHECK(doc.at("population").is_uint64());
+    CHECK(doc.at("area").as<double>() == 630.2);
+    CHECK(doc.at("offset").as<int64_t>() == -5);
+    CHECK_FALSE(doc.at("capital").as<bool>());
+    CHECK(doc.at("mayor").is_null());
+    CHECK(doc.at("").as<std::string>() == "empty");
+    CHECK(doc["coordinates"]["lat"].as<double>() == 43.7);
+    CHECK(doc.contains("area"));
+    CHECK_FALSE(doc.contains("province"));
+    CHECK(doc.find("province") == doc.object_range().end());
+    CHECK(doc.find("area")->value().as<double>() == 630.2);
+
+    auto neighbourhoods = doc.at("neighbourhoods");
+    REQUIRE(neighbourhoods.is_array());
+    CHECK(neighbourhoods.size() == 3);
+    CHECK(neighbourhoods.at(1).as<std::string>() == "Leslieville");
+    CHECK(neighbourhoods.as<std::vector<std::string>>() == std::vector<std::string>{"Annex", "Leslieville", "Yorkville"});
+
+    std::vector<std::string> names;
+    for (const auto& item : neighbourhoods.array_range())
+    {
+        names.push_back(item.as<std::string>());
+    }
+    CHECK(names.size() == 3);
+
+    CHECK_THROWS_AS(doc.at("province"), key_not_found);
+    CHECK_THROWS_AS(neighbourhoods.at(3), std::out_of_range);
+    CHECK_THROWS_AS(neighbourhoods.at("name"), not_an_object);
+}
+
+TEST_CASE("frozen_json from basic_json")
+{
+    std::string s = R"({"b":[1,2,{"d":true,"c":"x"}],"a":1.5,"e":{}, "f":[], "g":"a longer string with more than eight characters"})";
+
+    SECTION("json")
+    {
+        json j = json::parse(s);
+        frozen_json doc(j);
+
+        CHECK(doc.to_json<json>() == j);
+        std::string buffer;
+        doc.dump(buffer);
+        std::string expected;
+        j.dump(expected);
+        CHECK(buffer == expected);
+    }
+
+    SECTION("ojson keeps member order")
+    {
+        ojson j = ojson::parse(s);
+        frozen_json doc(j);
+
+        CHECK(doc.to_json<ojson>() == j);
+        std::vector<std::string> keys;
+        for (const auto& member : doc.object_range())
+        {
+            keys.push_back(std::string(member.key()));
+        }
+        CHECK(keys == std::vector<std::string>{"b","a","e","f","g"});
+        CHECK(doc.at("b").at(2).at("c").as<std::string>() == "x");
+        CHECK(doc.at("e").empty());
+        CHECK(doc.at("f").empty());
+    }
+
+    SECTION("copy and move")
+    {
+        frozen_json doc = frozen_json::parse(s);
+        frozen_json copy(doc);
+        frozen_json moved(std::move(doc));
+        CHECK(copy.at("a").as<double>() == 1.5);
+        CHECK(moved.at("a").as<double>() == 1.5);
+        CHECK(moved.root().to_json<json>() == copy.to_json<json>());
+    }
+}
+
+TEST_CASE("frozen_json scalars and tags")
+{
+    json j(json_array_arg);
+    j.emplace_back("123456789012345678901234567890", semantic_tag::bigint);
+    j.emplace_back(byte_string{'H','e','l','l','o'});
+    j.emplace_back(byte_string_arg, byte_string{'x'}, 42);
+    j.emplace_back(10, semantic_tag::epoch_second);
+    j.emplace_back(std::numeric_limits<uint64_t>::max());
+
+    frozen_json doc(j);
+
+    CHECK(doc.at(0).tag() == semantic_tag::bigint);
+    CHECK(doc.at(1).is_byte_string());
+    CHECK(doc.at(1).as_byte_string_view().size() == 5);
+    CHECK(doc.at(1).as<byte_string>() == byte_string{'H','e','l','l','o'});
+    CHECK(doc.at(4).as<uint64_t>() == (std::numeric_limits<uint64_t>::max)());
+    CHECK(doc.to_json<json>() == j);
+    CHECK(doc.to_json<json>().at(2).ext_tag() == 42);
+
+    frozen_json scalar = frozen_json::parse("\"abc\"");
+    CHECK(scalar.is_string());
+    CHECK(scalar.as<std::string>() == "abc");
+
+    frozen_json null_value;
+    CHECK(null_value.is_null());
+}
+
+TEST_CASE("frozen_json lookup in large object")
+{
+    json j;
+    for (int i = 0; i < 1000; ++i)
+    {
+        j.try_emplace("key" + std::to_string(i), i);
+    }
+    frozen_json doc(j);
+
+    for (int i = 0; i < 1000; i += 7)
+    {
+        CHECK(doc.at("key" + std::to_string(i)).as<int>() == i);
+    }
+    CHECK_FALSE(doc.contains("key1000"));
+}
+
+TEST_CASE("wfrozen_json")
+{
+    auto doc = wfrozen_json::parse(L"{\"b\":\"\x0394\",\"a\":[true]}");
+    CHECK(doc.at(L"b").as<std::wstring>() == L"\x0394");
+    CHECK(doc.at(L"a").at(0).as<bool>());
+
+    std::wostringstream os;
+    doc.dump(os);
+    CHECK(os.str() == L"{\"b\":\"\x0394\",\"a\":[true]}");
+}
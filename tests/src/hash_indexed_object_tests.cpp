@@ -0,0 +1,213 @@
+// Copyright 2021 Daniel Parker
+// Distributed under Boost license
+
+#include <jsoncons/json.hpp>
+#include <catch/catch.hpp>
+#include <string>
+#include <vector>
+#include <utility>
+
+using namespace jsoncons;
+
+using hjson = basic_json<char,sorted_hash_policy>;
+using hojson = basic_json<char,preserve_order_hash_policy>;
+
+TEST_CASE("hash indexed object parse")
+{
+    std::string s = R"(
+    {
+        "street_number" : "100",
+        "street_name" : "Queen St W",
+        "city" : "Toronto",
+        "province" : "ON",
+        "country" : "Canada",
+        "postal_code" : "M5H 2N2",
+        "phone" : "416-555-0101",
+        "email" : "info@example.com",
+        "website" : "example.com",
+        "city" : "Montreal",
+        "tags" : {"b" : 1, "a" : 2}
+    }
+    )";
+
+    SECTION("sorted")
+    {
+        auto expected = json::parse(s);
+        auto j = hjson::parse(s);
+
+        CHECK(j.size() == expected.size());
+        CHECK(j.to_string() == expected.to_string());
+        CHECK(j["city"].as<std::string>() == "Toronto");
+        CHECK(j.at("tags").at("a").as<int>() == 2);
+    }
+
+    SECTION("preserve order")
+    {
+        auto expected = ojson::parse(s);
+        auto j = hojson::parse(s);
+
+        CHECK(j.size() == expected.size());
+        CHECK(j.to_string() == expected.to_string());
+        CHECK(j["city"].as<std::string>() == "Toronto");
+        CHECK(j.at("tags").at("b").as<int>() == 1);
+    }
+
+    SECTION("intern keys")
+    {
+        auto options = json_options{}.intern_keys(true);
+        std::string records = R"([{"x":1,"b":2,"a":3},{"x":4,"b":5,"a":6}])";
+
+        CHECK(hjson::parse(records, options).to_string() == json::parse(records).to_string());
+        CHECK(hojson::parse(records, options).to_string() == ojson::parse(records).to_string());
+    }
+}
+
+TEST_CASE("hash indexed object large")
+{
+    const std::size_t n = 100000;
+
+    SECTION("preserve order")
+    {
+        hojson j;
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            j.insert_or_assign("key" + std::to_string(n - i), i);
+        }
+        REQUIRE(j.size() == n);
+
+        std::size_t i = 0;
+        for (const auto& member : j.object_range())
+        {
+            CHECK(member.key() == "key" + std::to_string(n - i));
+            ++i;
+        }
+        for (i = 0; i < n; i += 997)
+        {
+            CHECK(j.at("key" + std::to_string(n - i)).as<std::size_t>() == i);
+        }
+        CHECK_FALSE(j.contains("key0"));
+
+        j.insert_or_assign("key1", 0);
+        CHECK(j.size() == n);
+        CHECK(j.at("key1").as<int>() == 0);
+
+        j.erase("key" + std::to_string(n));
+        CHECK(j.size() == n - 1);
+        CHECK_FALSE(j.contains("key" + std::to_string(n)));
+        CHECK(j.object_range().begin()->key() == "key" + std::to_string(n - 1));
+        CHECK(j.at("key2").as<std::size_t>() == n - 2);
+    }
+
+    SECTION("sorted")
+    {
+        hjson j;
+        for (std::size_t i = 0; i < n; i += 10)
+        {
+            j.insert_or_assign("key" + std::to_string(i), i);
+        }
+        for (std::size_t i = 5; i < n; i += 10)
+        {
+            j.try_emplace("key" + std::to_string(i), i);
+        }
+        REQUIRE(j.size() == n / 5);
+
+        std::string prev;
+        for (const auto& member : j.object_range())
+        {
+            CHECK(prev < member.key());
+            prev = member.key();
+        }
+        for (std::size_t i = 0; i < n; i += 5)
+        {
+            CHECK(j.at("key" + std::to_string(i)).as<std::size_t>() == i);
+        }
+    }
+}
+
+TEST_CASE("hash indexed object modifiers")
+{
+    std::vector<std::string> keys = {"k","c","a","j","b","i","d","h","e","g","f"};
+
+    ojson expected;
+    hojson j;
+
+    for (const auto& key : keys)
+    {
+        expected.try_emplace(key, key);
+        j.try_emplace(key, key);
+    }
+    CHECK(j.to_string() == expected.to_string());
+
+    SECTION("insert_or_assign with hint")
+    {
+        auto it1 = expected.insert_or_assign(expected.object_range().begin() + 3, "x", 1);
+        auto it2 = j.insert_or_assign(j.object_range().begin() + 3, "x", 1);
+        CHECK(it2->key() == it1->key());
+        expected.insert_or_assign(expected.object_range().begin(), "a", 2);
+        j.insert_or_assign(j.object_range().begin(), "a", 2);
+
+        CHECK(j.to_string() == expected.to_string());
+        CHECK(j.at("x").as<int>() == 1);
+        CHECK(j.at("f").as<std::string>() == "f");
+    }
+
+    SECTION("erase range")
+    {
+        expected.erase("a");
+        expected.erase("j");
+        expected.erase("b");
+        j.erase(j.object_range().begin() + 2, j.object_range().begin() + 5);
+
+        CHECK(j.to_string() == expected.to_string());
+        CHECK_FALSE(j.contains("a"));
+        CHECK(j.at("i").as<std::string>() == "i");
+    }
+
+    SECTION("merge")
+    {
+        ojson source1 = ojson::parse(R"({"a":0,"z":1,"y":2})");
+        hojson source2 = hojson::parse(R"({"a":0,"z":1,"y":2})");
+
+        expected.merge(expected.object_range().begin() + 1, source1);
+        j.merge(j.object_range().begin() + 1, source2);
+        CHECK(j.to_string() == expected.to_string());
+
+        expected.merge_or_update(source1);
+        j.merge_or_update(source2);
+        CHECK(j.to_string() == expected.to_string());
+        CHECK(j.at("a").as<int>() == 0);
+    }
+
+    SECTION("copy and compare")
+    {
+        hojson copy(j);
+        CHECK(copy == j);
+        copy.erase("k");
+        CHECK(copy != j);
+        CHECK_FALSE(copy.contains("k"));
+        CHECK(j.contains("k"));
+    }
+
+    SECTION("clear")
+    {
+        j.clear();
+        CHECK(j.empty());
+        CHECK_FALSE(j.contains("a"));
+        j.insert_or_assign("a", 1);
+        CHECK(j.at("a").as<int>() == 1);
+    }
+}
+
+TEST_CASE("hash indexed object wide characters")
+{
+    using whojson = basic_json<wchar_t,preserve_order_hash_policy>;
+
+    whojson j;
+    for (int i = 0; i < 20; ++i)
+    {
+        j.try_emplace(L"key" + std::to_wstring(20 - i), i);
+    }
+    CHECK(j.size() == 20);
+    CHECK(j.object_range().begin()->key() == L"key20");
+    CHECK(j.at(L"key1").as<int>() == 19);
+}
@@ -576,3 +576,369 @@ TEST_CASE("staj event as object")
     }
 }
 
+
+TEST_CASE("json_cursor skip")
+{
+    std::string buffer = R"(
+{
+    "a" : [1, {"b" : [2, "x]}\"["]}, 3],
+    "c" : {"d" : "e"},
+    "f" : true
+}
+    )";
+
+    SECTION("string")
+    {
+        json_cursor cursor(buffer);
+        REQUIRE(cursor.current().event_type() == staj_event_type::begin_object);
+        cursor.next();
+        CHECK(cursor.current().get<std::string>() == "a");
+        cursor.next();
+        REQUIRE(cursor.current().event_type() == staj_event_type::begin_array);
+        cursor.skip();
+        CHECK(cursor.current().event_type() == staj_event_type::key);
+        CHECK(cursor.current().get<std::string>() == "c");
+        CHECK(cursor.context().line() == 4);
+        cursor.next();
+        cursor.skip();
+        CHECK(cursor.current().get<std::string>() == "f");
+        cursor.skip();
+        CHECK(cursor.current().event_type() == staj_event_type::bool_value);
+        cursor.skip();
+        CHECK(cursor.current().event_type() == staj_event_type::end_object);
+        cursor.next();
+        CHECK(cursor.done());
+    }
+
+    SECTION("stream spanning several buffers")
+    {
+        std::string s = "{\"a\" : [";
+        for (std::size_t i = 0; i < 5000; ++i)
+        {
+            s.append(R"({"b" : "x]}\"["},)");
+            s.push_back('\n');
+        }
+        s.append("{}], \"c\" : 1}");
+
+        std::istringstream is(s);
+        json_cursor cursor(is);
+        cursor.next();
+        cursor.next();
+        REQUIRE(cursor.current().event_type() == staj_event_type::begin_array);
+        cursor.skip();
+        CHECK(cursor.current().get<std::string>() == "c");
+        CHECK(cursor.context().line() == 5001);
+        cursor.next();
+        CHECK(cursor.current().get<int>() == 1);
+    }
+
+    SECTION("root")
+    {
+        json_cursor cursor(buffer);
+        cursor.skip();
+        CHECK(cursor.done());
+    }
+
+    SECTION("filter view")
+    {
+        json_cursor cursor(buffer);
+        auto view = cursor | [](const staj_event& event, const ser_context&) -> bool
+        {
+            return event.event_type() != staj_event_type::key;
+        };
+        view.next();
+        REQUIRE(view.current().event_type() == staj_event_type::begin_array);
+        view.skip();
+        CHECK(view.current().event_type() == staj_event_type::begin_object);
+    }
+
+    SECTION("unexpected end")
+    {
+        std::string s = R"({"a" : [1, [2)";
+        json_cursor cursor(s);
+        cursor.next();
+        cursor.next();
+        std::error_code ec;
+        cursor.skip(ec);
+        CHECK(ec == json_errc::unexpected_eof);
+    }
+
+    SECTION("mismatched bracket")
+    {
+        std::string s = R"({"a" : [1, 2}, "b" : 3})";
+        json_cursor cursor(s);
+        cursor.next();
+        cursor.next();
+        std::error_code ec;
+        cursor.skip(ec);
+        CHECK(ec);
+    }
+}
+
+namespace {
+
+    // Event type and value of each event, as text
+    std::vector<std::string> describe_events(staj_cursor& cursor)
+    {
+        std::vector<std::string> events;
+        for (; !cursor.done(); cursor.next())
+        {
+            const auto& event = cursor.current();
+            std::error_code ec;
+            events.push_back(std::to_string(static_cast<int>(event.event_type())) + ":" + event.get<std::string>(ec));
+        }
+        return events;
+    }
+
+    std::vector<std::string> describe_events(staj_cursor& cursor, std::size_t batch_capacity)
+    {
+        std::vector<std::string> events;
+        staj_event_batch batch(batch_capacity);
+        while (!cursor.done())
+        {
+            cursor.next_batch(batch);
+            CHECK(batch.size() > 0);
+            CHECK((batch.full() || cursor.done()));
+            for (const auto& event : batch)
+            {
+                std::error_code ec;
+                events.push_back(std::to_string(static_cast<int>(event.event_type())) + ":" + event.get<std::string>(ec));
+            }
+        }
+        return events;
+    }
+
+} // namespace
+
+TEST_CASE("json_cursor next_batch")
+{
+    std::string s = "[";
+    for (std::size_t i = 0; i < 2000; ++i)
+    {
+        if (i > 0) s.push_back(',');
+        s.append(R"({"id" : )" + std::to_string(i) + R"(, "name" : "item\t)" + std::to_string(i) + R"(", "price" : 1.5, "ok" : true, "note" : null, "big" : -18446744073709551617})");
+    }
+    s.append("]");
+
+    json_cursor expected_cursor(s);
+    std::vector<std::string> expected = describe_events(expected_cursor);
+    REQUIRE(expected.size() == 2000*14 + 2);
+
+    SECTION("string")
+    {
+        json_cursor cursor(s);
+        CHECK(describe_events(cursor, 7) == expected);
+    }
+
+    SECTION("stream spanning several buffers")
+    {
+        std::istringstream is(s);
+        json_cursor cursor(is);
+        CHECK(describe_events(cursor, 1000) == expected);
+    }
+
+    SECTION("capacity of one")
+    {
+        json_cursor cursor(s);
+        CHECK(describe_events(cursor, 1) == expected);
+    }
+
+    SECTION("mixed with next")
+    {
+        json_cursor cursor(s);
+        cursor.next();
+        staj_event_batch batch(3);
+        cursor.next_batch(batch);
+        REQUIRE(batch.size() == 3);
+        CHECK(batch[0].event_type() == staj_event_type::begin_object);
+        CHECK(batch[1].get<std::string>() == "id");
+        CHECK(batch[2].get<int>() == 0);
+        CHECK(cursor.current().get<std::string>() == "name");
+        cursor.next();
+        CHECK(cursor.current().get<std::string>() == "item\t0");
+        CHECK(batch[1].get<jsoncons::string_view>() == jsoncons::string_view("id"));
+    }
+
+    SECTION("strings read in place from a string")
+    {
+        json_cursor cursor(s);
+        cursor.next();
+        staj_event_batch batch(5);
+        cursor.next_batch(batch);
+        REQUIRE(batch.size() == 5);
+        // Strings without escapes refer to the input, escaped strings are copied into the batch
+        auto key = batch[1].get<jsoncons::string_view>();
+        CHECK(key == jsoncons::string_view("id"));
+        CHECK((key.data() >= s.data() && key.data() < s.data() + s.size()));
+        auto value = batch[4].get<jsoncons::string_view>();
+        CHECK(value == jsoncons::string_view("item\t0"));
+        CHECK_FALSE((value.data() >= s.data() && value.data() < s.data() + s.size()));
+    }
+
+    SECTION("escaped strings")
+    {
+        std::string input = "[";
+        for (std::size_t i = 0; i < 20; ++i)
+        {
+            if (i > 0) input.push_back(',');
+            input.append("\"a\\n" + std::to_string(i) + "\"");
+        }
+        input.append(",\"b\",\"c\"]");
+
+        json_cursor expected_strings(input);
+        std::vector<std::string> expected_events = describe_events(expected_strings);
+        REQUIRE(expected_events.size() == 24);
+        CHECK(expected_events[20] == std::to_string(static_cast<int>(staj_event_type::string_value)) + ":a\n19");
+
+        json_cursor cursor(input);
+        CHECK(describe_events(cursor, 64) == expected_events);
+    }
+
+    SECTION("strings split across stream buffers")
+    {
+        for (std::size_t length : {7, 16, 33})
+        {
+            std::istringstream is(s);
+            json_cursor cursor(is);
+            cursor.buffer_length(length);
+            CHECK(describe_events(cursor, 500) == expected);
+        }
+    }
+
+    SECTION("strings outlive the stream buffer")
+    {
+        std::istringstream is(s);
+        json_cursor cursor(is);
+        cursor.buffer_length(64);
+        cursor.next();
+        staj_event_batch batch(14);
+        cursor.next_batch(batch);
+        REQUIRE(batch.size() == 14);
+        // Moves the cursor far enough that its buffer is refilled several times
+        for (std::size_t i = 0; i < 100; ++i)
+        {
+            cursor.next();
+        }
+        std::vector<std::string> events;
+        for (const auto& event : batch)
+        {
+            std::error_code ec;
+            events.push_back(std::to_string(static_cast<int>(event.event_type())) + ":" + event.get<std::string>(ec));
+        }
+        CHECK((events == std::vector<std::string>(expected.begin() + 1, expected.begin() + 15)));
+    }
+
+    SECTION("filter view")
+    {
+        json_cursor cursor(s);
+        auto view = cursor | [](const staj_event& event, const ser_context&) -> bool
+        {
+            return event.event_type() == staj_event_type::key;
+        };
+        staj_event_batch batch(16);
+        view.next_batch(batch);
+        REQUIRE(batch.size() == 16);
+        CHECK(batch[0].get<std::string>() == "id");
+        CHECK(batch[1].get<std::string>() == "name");
+        CHECK(batch[6].get<std::string>() == "id");
+    }
+
+    SECTION("error")
+    {
+        std::string input = "[1,2,3,}";
+        json_cursor cursor(input);
+        staj_event_batch batch(10);
+        std::error_code ec;
+        cursor.next_batch(batch, ec);
+        CHECK(ec == json_errc::expected_value);
+        CHECK(batch.size() == 4);
+    }
+}
+
+
+namespace {
+
+    bool is_not_string_value(const staj_event& event, const ser_context&)
+    {
+        return event.event_type() != staj_event_type::string_value;
+    }
+
+} // namespace
+
+TEST_CASE("staj_filter_view with a predicate type")
+{
+    std::string s = R"([1,"one",2,"two",3])";
+
+    SECTION("lambda")
+    {
+        json_cursor cursor(s);
+        auto view = cursor | [](const staj_event& event, const ser_context&) -> bool
+        {
+            return event.event_type() != staj_event_type::string_value;
+        };
+        CHECK_FALSE((std::is_same<decltype(view),staj_filter_view>::value));
+
+        std::vector<int> values;
+        for (; !view.done(); view.next())
+        {
+            if (view.current().event_type() == staj_event_type::uint64_value)
+            {
+                values.push_back(view.current().get<int>());
+            }
+        }
+        CHECK((values == std::vector<int>{1,2,3}));
+    }
+
+    SECTION("function")
+    {
+        json_cursor cursor(s);
+        auto view = cursor | is_not_string_value;
+        CHECK((std::is_same<decltype(view)::predicate_type,bool(*)(const staj_event&, const ser_context&)>::value));
+
+        auto values = staj_array<int>(view);
+        std::vector<int> v(begin(values), end(values));
+        CHECK((v == std::vector<int>{1,2,3}));
+    }
+
+    SECTION("staj_filter_view")
+    {
+        json_cursor cursor(s);
+        staj_filter_view view = cursor | [](const staj_event& event, const ser_context&) -> bool
+        {
+            return event.event_type() != staj_event_type::string_value;
+        };
+
+        auto values = staj_array<int>(view);
+        std::vector<int> v(begin(values), end(values));
+        CHECK((v == std::vector<int>{1,2,3}));
+    }
+
+    SECTION("staj_object")
+    {
+        std::string input = R"({"a":1,"mark":2,"c":3})";
+        json_cursor cursor(input);
+        auto view = cursor | remove_mark_filter();
+
+        auto members = staj_object<std::string,int>(view);
+        std::vector<std::pair<std::string,int>> v(begin(members), end(members));
+        REQUIRE(v.size() == 2);
+        CHECK(v[0].first == "a");
+        CHECK(v[0].second == 1);
+        CHECK(v[1].first == "c");
+        CHECK(v[1].second == 3);
+    }
+
+    SECTION("chained")
+    {
+        json_cursor cursor(s);
+        auto view1 = cursor | is_not_string_value;
+        auto view2 = view1 | [](const staj_event& event, const ser_context&) -> bool
+        {
+            return event.event_type() != staj_event_type::uint64_value || event.get<int>() != 2;
+        };
+
+        auto values = staj_array<int>(view2);
+        std::vector<int> v(begin(values), end(values));
+        CHECK((v == std::vector<int>{1,3}));
+    }
+}
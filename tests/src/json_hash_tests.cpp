@@ -0,0 +1,97 @@
+// Copyright 2021 Daniel Parker
+// Distributed under Boost license
+
+#include <jsoncons/json.hpp>
+#include <catch/catch.hpp>
+#include <string>
+#include <unordered_set>
+#include <unordered_map>
+#include <vector>
+
+using namespace jsoncons;
+
+TEST_CASE("json hash of equal values")
+{
+    SECTION("numbers")
+    {
+        CHECK(json(1).hash() == json(1u).hash());
+        CHECK(json(1).hash() == json(1.0).hash());
+        CHECK(json(-2).hash() == json(-2.0).hash());
+        CHECK(json(0.0).hash() == json(-0.0).hash());
+        CHECK(json(half_arg, 0x3c00).hash() == json(1).hash());
+        CHECK(json(1).hash() != json(2).hash());
+        CHECK(json(1).hash() != json(true).hash());
+    }
+
+    SECTION("strings")
+    {
+        CHECK(json("abc").hash() == json(std::string("abc")).hash());
+        CHECK(json("12345678901234567890", semantic_tag::bigint).hash() == json("12345678901234567890").hash());
+        CHECK(json("abc").hash() != json("abd").hash());
+        CHECK(json(byte_string_arg, std::vector<uint8_t>{'a','b','c'}).hash() != json("abc").hash());
+    }
+
+    SECTION("containers")
+    {
+        CHECK(json().hash() == json(json_object_arg).hash());
+        CHECK(json(json_array_arg).hash() != json().hash());
+        CHECK(json::parse("[1,2]").hash() != json::parse("[2,1]").hash());
+        CHECK(json::parse(R"({"a":1,"b":2})").hash() != json::parse(R"({"a":2,"b":1})").hash());
+        CHECK(json::parse(R"([[1],[2]])").hash() != json::parse(R"([[1,2]])").hash());
+    }
+}
+
+TEST_CASE("json hash does not depend on member order")
+{
+    std::string s1 = R"({"b" : [1, {"y" : null, "x" : "s"}], "a" : 1.5})";
+    std::string s2 = R"({"a" : 1.5, "b" : [1, {"x" : "s", "y" : null}]})";
+
+    CHECK(ojson::parse(s1).hash() == ojson::parse(s2).hash());
+    CHECK(json::parse(s1).hash() == ojson::parse(s1).hash());
+    CHECK(std::hash<json>()(json::parse(s1)) == std::hash<ojson>()(ojson::parse(s2)));
+
+    json j = json::parse(s1);
+    CHECK(j["a"].hash() == json(1.5).hash());
+
+    const json* p = &j;
+    CHECK(json(json_const_pointer_arg, p).hash() == j.hash());
+}
+
+TEST_CASE("json in unordered containers")
+{
+    json a = json::parse(R"([{"id" : 1, "tags" : ["x"]}, {"tags" : ["x"], "id" : 1.0}, {"id" : 2}, [1, 2], [1, 2.0]])");
+
+    std::unordered_set<json> unique(a.array_range().begin(), a.array_range().end());
+    CHECK(unique.size() == 3);
+    CHECK(unique.count(json::parse(R"({"id" : 2})")) == 1);
+
+    ojson b = ojson::parse(R"(["a", "b", "a", {"k" : "a"}, {"k" : "a"}])");
+    std::unordered_map<ojson,int> counts;
+    for (const auto& item : b.array_range())
+    {
+        ++counts[item];
+    }
+    CHECK(counts.size() == 3);
+    CHECK(counts[ojson("a")] == 2);
+}
+
+TEST_CASE("json hash is cached for shared copy on write containers")
+{
+    using cow_json = basic_json<char,sorted_cow_policy>;
+
+    cow_json doc = cow_json::parse(R"({"a" : [1, 2, 3], "b" : {"c" : "d"}})");
+    std::size_t h = doc.hash();
+    CHECK(h == json::parse(R"({"a" : [1, 2, 3], "b" : {"c" : "d"}})").hash());
+
+    cow_json snapshot = doc;
+    CHECK(snapshot.hash() == h);
+    CHECK(doc.hash() == h);
+
+    doc["a"].push_back(4);
+    CHECK(doc.hash() != h);
+    CHECK(doc.hash() == json::parse(R"({"a" : [1, 2, 3, 4], "b" : {"c" : "d"}})").hash());
+    CHECK(snapshot.hash() == h);
+
+    doc["a"].erase(doc["a"].array_range().end() - 1);
+    CHECK(doc.hash() == h);
+}
@@ -0,0 +1,256 @@
+// Copyright 2021 Daniel Parker
+// Distributed under Boost license
+
+#include <catch/catch.hpp>
+#include <jsoncons/json.hpp>
+#include <jsoncons/json_index_parser.hpp>
+#include <jsoncons/detail/structural_index.hpp>
+#include <string>
+#include <vector>
+#include <fstream>
+#include <cmath>
+
+#if (defined JSONCONS_HAS_FILESYSTEM && defined(_MSC_VER))
+#include <filesystem>
+namespace fs = std::filesystem;
+#endif
+
+using namespace jsoncons;
+
+namespace {
+
+    json parse_with_index(const std::string& s)
+    {
+        json_decoder<json> decoder;
+        json_index_parser parser;
+        parser.update(s);
+        parser.parse(decoder);
+        return decoder.get_result();
+    }
+
+    std::error_code index_parse_error(const std::string& s)
+    {
+        json_decoder<json> decoder;
+        json_index_parser parser;
+        parser.update(s);
+        std::error_code ec;
+        parser.parse(decoder, ec);
+        return ec;
+    }
+
+} // namespace
+
+TEST_CASE("build_structural_index tests")
+{
+    SECTION("structurals outside strings")
+    {
+        std::string s = R"({"a\"[":[1, true],"b\\":null})";
+        std::vector<uint32_t> index;
+        REQUIRE(jsoncons::detail::build_structural_index(s.data(), s.size(), index));
+
+        std::string found;
+        for (auto i : index)
+        {
+            found.push_back(s[i]);
+        }
+        CHECK(found == "{\":[1,t],\":n}");
+    }
+    SECTION("escapes and strings across 64 byte blocks")
+    {
+        std::string s = "[\"";
+        s.append(61, 'a');
+        s.append("\\\\\\\"");
+        s.append(70, 'b');
+        s.append("\",-12.5e3]");
+        std::vector<uint32_t> index;
+        REQUIRE(jsoncons::detail::build_structural_index(s.data(), s.size(), index));
+        REQUIRE(index.size() == 5);
+        CHECK(s[index[0]] == '[');
+        CHECK(index[1] == 1);
+        CHECK(s[index[2]] == ',');
+        CHECK(s[index[3]] == '-');
+        CHECK(s[index[4]] == ']');
+    }
+    SECTION("unclosed string")
+    {
+        std::string s = "[\"abc\\\"]";
+        std::vector<uint32_t> index;
+        CHECK_FALSE(jsoncons::detail::build_structural_index(s.data(), s.size(), index));
+    }
+}
+
+TEST_CASE("find_array_elements tests")
+{
+    SECTION("separators at depth 1")
+    {
+        std::string s = R"( [1, "a,]", [2,3], {"b":[4,5]}] )";
+        std::vector<std::size_t> separators;
+        std::size_t max_depth = 0;
+        REQUIRE(jsoncons::detail::find_array_elements(s.data(), s.size(), 1, separators, max_depth));
+
+        std::string found;
+        for (auto i : separators)
+        {
+            found.push_back(s[i]);
+        }
+        CHECK(found == "[,,,]");
+        CHECK(separators.back() == s.size() - 2);
+        CHECK(max_depth == 3);
+    }
+    SECTION("not an array")
+    {
+        std::vector<std::size_t> separators;
+        std::size_t max_depth = 0;
+        std::string s1 = R"({"a":1})";
+        CHECK_FALSE(jsoncons::detail::find_array_elements(s1.data(), s1.size(), 0, separators, max_depth));
+        std::string s2 = "[1,[2]";
+        CHECK_FALSE(jsoncons::detail::find_array_elements(s2.data(), s2.size(), 0, separators, max_depth));
+        std::string s3 = "[1}";
+        CHECK_FALSE(jsoncons::detail::find_array_elements(s3.data(), s3.size(), 0, separators, max_depth));
+    }
+}
+
+TEST_CASE("json_index_parser tests")
+{
+    SECTION("same result as basic_json_parser")
+    {
+        std::vector<std::string> inputs = {
+            R"({"store":{"book":[{"category":"reference","author":"Nigel Rees","price":8.95},{"price":22.99,"isbn":"0-395-19395-8"}],"bicycle":{"color":"red","price":19.95}}})",
+            R"([ 0, -1, 18446744073709551615, 18446744073709551616, -9223372036854775809, 1.5, -0.25e-3, 1E10 ])",
+            R"(  {"\u00e9\ud83d\ude00\n\t\"\\\/" : [true, false, null, {}, [], "", ""]}  )",
+            "\"string\"",
+            " 42 ",
+            "[\n\t{\"a\" :\r\n 1}\r\n]"
+        };
+        for (const auto& s : inputs)
+        {
+            CHECK(parse_with_index(s) == json::parse(s));
+        }
+    }
+
+    SECTION("lossless_number and nan replacement")
+    {
+        auto options = json_options{}
+            .lossless_number(true)
+            .nan_to_str("NaN")
+            .parse_engine(json_parse_engine::structural_index);
+        std::string s = R"([1.10000000000000000001, "NaN"])";
+        json j = json::parse(s, options);
+        CHECK(j[0].as<std::string>() == "1.10000000000000000001");
+        CHECK(j[0].tag() == semantic_tag::bigdec);
+        CHECK(j[1].is_double());
+        CHECK(std::isnan(j[1].as<double>()));
+    }
+
+    SECTION("errors")
+    {
+        CHECK(index_parse_error("") == json_errc::unexpected_eof);
+        CHECK(index_parse_error("[1,2") == json_errc::unexpected_eof);
+        CHECK(index_parse_error("[1,2,]") == json_errc::extra_comma);
+        CHECK(index_parse_error("{\"a\" 1}") == json_errc::expected_colon);
+        CHECK(index_parse_error("{\"a\":1,}") == json_errc::extra_comma);
+        CHECK(index_parse_error("[1}") == json_errc::expected_comma_or_right_bracket);
+        CHECK(index_parse_error("[01]") == json_errc::leading_zero);
+        CHECK(index_parse_error("[1.]") == json_errc::invalid_number);
+        CHECK(index_parse_error("[1x]") == json_errc::invalid_number);
+        CHECK(index_parse_error("[tru]") == json_errc::invalid_value);
+        CHECK(index_parse_error("[\"a\tb\"]") == json_errc::illegal_character_in_string);
+        CHECK(index_parse_error("[\"\\x\"]") == json_errc::illegal_escaped_character);
+        CHECK(index_parse_error("[\"\\ud800\"]") == json_errc::expected_codepoint_surrogate_pair);
+        CHECK(index_parse_error("[\"abc]") == json_errc::unexpected_eof);
+        CHECK(index_parse_error("[] []") == json_errc::extra_character);
+        CHECK(index_parse_error("[/* comment */]") == json_errc::expected_value);
+    }
+
+    SECTION("error line and column")
+    {
+        std::string s = "[\n  1,\n  2 3]";
+        json_decoder<json> decoder;
+        json_index_parser parser;
+        parser.update(s);
+        std::error_code ec;
+        parser.parse(decoder, ec);
+        CHECK(ec == json_errc::expected_comma_or_right_bracket);
+        CHECK(parser.line() == 3);
+        CHECK(parser.column() == 5);
+    }
+
+    SECTION("max nesting depth")
+    {
+        auto options = json_options{}.max_nesting_depth(2);
+        json_decoder<json> decoder;
+        json_index_parser parser(options);
+        parser.update(std::string("[[[]]]"));
+        std::error_code ec;
+        parser.parse(decoder, ec);
+        CHECK(ec == json_errc::max_nesting_depth_exceeded);
+    }
+}
+
+TEST_CASE("json::parse with structural_index engine")
+{
+    auto options = json_options{}.parse_engine(json_parse_engine::structural_index);
+
+    SECTION("comments fall back to the state machine parser")
+    {
+        json j = json::parse(std::string("[1, /* comment */ 2]"), options);
+        CHECK(j == json::parse("[1,2]"));
+    }
+
+    SECTION("errors are reported as by the state machine parser")
+    {
+        std::string s = "{\"a\":1,\n\"b\"}";
+        std::error_code ec1;
+        std::error_code ec2;
+        JSONCONS_TRY
+        {
+            json::parse(s);
+        }
+        JSONCONS_CATCH (const ser_error& e)
+        {
+            ec1 = e.code();
+        }
+        JSONCONS_TRY
+        {
+            json::parse(s, options);
+        }
+        JSONCONS_CATCH (const ser_error& e)
+        {
+            ec2 = e.code();
+        }
+        CHECK(ec1);
+        CHECK(ec1 == ec2);
+    }
+
+    SECTION("input file")
+    {
+        std::ifstream is("./input/address-book.json");
+        std::string s((std::istreambuf_iterator<char>(is)), std::istreambuf_iterator<char>());
+        CHECK(json::parse(s, options) == json::parse(s));
+    }
+}
+
+#if (defined JSONCONS_HAS_FILESYSTEM && defined(_MSC_VER))
+TEST_CASE("JSON Parsing Test Suite with json_index_parser")
+{
+    std::string path = "./input/JSONTestSuite";
+    for (auto& p : fs::directory_iterator(path))
+    {
+        if (fs::exists(p) && fs::is_regular_file(p) && p.path().extension() == ".json" &&
+            (p.path().filename().c_str()[0] == 'y' || p.path().filename().c_str()[0] == 'n'))
+        {
+            std::ifstream is(p.path().c_str());
+            std::string s((std::istreambuf_iterator<char>(is)), std::istreambuf_iterator<char>());
+            std::error_code ec = index_parse_error(s);
+            if (p.path().filename().c_str()[0] == 'y')
+            {
+                CHECK_FALSE(ec);
+            }
+            else
+            {
+                CHECK(ec);
+            }
+        }
+    }
+}
+#endif
@@ -274,6 +274,73 @@ TEST_CASE("test_incremental_parsing")
     CHECK_FALSE(j[0].as<bool>());
 }
 
+namespace {
 
+    // Records whether each key and string value refers to the parser input
+    class string_location_visitor : public default_json_visitor
+    {
+    public:
+        const char* first;
+        const char* last;
+        std::vector<std::pair<std::string,bool>> strings;
+
+        string_location_visitor(const char* first, const char* last)
+            : first(first), last(last)
+        {
+        }
+    private:
+        bool visit_key(const string_view_type& name, const ser_context&, std::error_code&) override
+        {
+            record(name);
+            return true;
+        }
+
+        bool visit_string(const string_view_type& s, semantic_tag, const ser_context&, std::error_code&) override
+        {
+            record(s);
+            return true;
+        }
+
+        void record(const string_view_type& s)
+        {
+            strings.emplace_back(std::string(s.data(), s.length()), s.data() >= first && s.data() + s.length() <= last);
+        }
+    };
+
+} // namespace
+
+TEST_CASE("json_parser string events without copying")
+{
+    SECTION("unescaped strings refer to the input")
+    {
+        std::string input = R"({"first":"Jane","last":"Roe\u00e9","tags":["a",""]})";
+        string_location_visitor visitor(input.data(), input.data() + input.size());
+
+        json_reader reader(jsoncons::string_view(input), visitor);
+        reader.read();
 
+        REQUIRE(visitor.strings.size() == 7);
+        CHECK(visitor.strings[0] == std::make_pair(std::string("first"), true));
+        CHECK(visitor.strings[1] == std::make_pair(std::string("Jane"), true));
+        CHECK(visitor.strings[3].second == false); // escaped
+        CHECK(visitor.strings[5] == std::make_pair(std::string("a"), true));
+    }
 
+    SECTION("strings split across chunks are copied")
+    {
+        std::string s1 = R"(["abc)";
+        std::string s2 = R"(def","g"])";
+        string_location_visitor visitor(s2.data(), s2.data() + s2.size());
+
+        json_parser parser;
+        parser.update(s1);
+        parser.parse_some(visitor);
+        parser.update(s2);
+        parser.parse_some(visitor);
+        parser.finish_parse(visitor);
+
+        REQUIRE(visitor.strings.size() == 2);
+        CHECK(visitor.strings[0] == std::make_pair(std::string("abcdef"), false));
+        CHECK(visitor.strings[1] == std::make_pair(std::string("g"), true));
+    }
+}
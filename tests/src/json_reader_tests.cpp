@@ -4,6 +4,7 @@
 #include <jsoncons/json.hpp>
 #include <jsoncons/json_encoder.hpp>
 #include <jsoncons/json_reader.hpp>
+#include <jsoncons_ext/cbor/cbor.hpp>
 #include "sample_allocators.hpp"
 #include <catch/catch.hpp>
 #include <sstream>
@@ -265,5 +266,102 @@ TEST_CASE("json_reader read from string test")
     CHECK(j[0][0][1]["author"].as<std::string>() == std::string("Brent Weeks"));
 }
 
+namespace {
 
+    class key_counter final : public default_json_visitor
+    {
+    public:
+        std::size_t count = 0;
+    private:
+        bool visit_key(const string_view_type&, const ser_context&, std::error_code&) override
+        {
+            ++count;
+            return true;
+        }
+    };
+
+} // namespace
+
+TEST_CASE("json_reader read with a concrete visitor type")
+{
+    std::string s = R"(
+{
+  "book": [
+    {"author": "Margaret Weis", "title": "Dragonlance Series", "price": 31.96, "copies": 3, "reviews": null},
+    {"author": "Brent Weeks", "title": "Night Angel Trilogy", "price": 14.70, "copies": -1, "in print": true},
+    {"title": "\u00c9l\u00e9ments", "big": 123456789012345678901234567890, "id": 18446744073709551615}
+  ]
+}
+)";
+    json expected = json::parse(s);
+
+    SECTION("json_decoder")
+    {
+        json_decoder<json> decoder;
+        json_reader reader(s);
+        reader.read(decoder);
+        REQUIRE(decoder.is_valid());
+        CHECK(decoder.get_result() == expected);
+    }
+
+    SECTION("json_decoder, stream of JSON texts")
+    {
+        std::stringstream is(s + "\n[1,2]\n\"foo\"");
+        json_decoder<json> decoder;
+        json_reader reader(is);
+
+        reader.read_next(decoder);
+        CHECK(decoder.get_result() == expected);
+        reader.read_next(decoder);
+        CHECK(decoder.get_result() == json::parse("[1,2]"));
+        reader.read_next(decoder);
+        CHECK(decoder.get_result() == json("foo"));
+        CHECK(reader.eof());
+    }
 
+    SECTION("compact_json_string_encoder")
+    {
+        std::string expected_text;
+        ojson::parse(s).dump(expected_text);
+
+        std::string text;
+        compact_json_string_encoder encoder(text);
+        json_reader reader(s);
+        reader.read(encoder);
+        CHECK(text == expected_text);
+    }
+
+    SECTION("cbor_bytes_encoder")
+    {
+        std::vector<uint8_t> expected_bytes;
+        {
+            cbor::cbor_bytes_encoder encoder(expected_bytes);
+            json_reader reader(s, encoder);
+            reader.read();
+        }
+
+        std::vector<uint8_t> bytes;
+        cbor::cbor_bytes_encoder encoder(bytes);
+        json_reader reader(s);
+        reader.read(encoder);
+        CHECK(bytes == expected_bytes);
+    }
+
+    SECTION("visitor that is not a friend of json_visitor_access")
+    {
+        key_counter visitor;
+        json_reader reader(s);
+        reader.read(visitor);
+        CHECK(visitor.count == 14);
+    }
+
+    SECTION("error code")
+    {
+        json_decoder<json> decoder;
+        json_reader reader(std::string("{\"a\":1,}"));
+        std::error_code ec;
+        reader.read(decoder, ec);
+        CHECK(ec == json_errc::extra_comma);
+        CHECK_FALSE(decoder.is_valid());
+    }
+}
@@ -0,0 +1,150 @@
+// Copyright 2021 Daniel Parker
+// Distributed under Boost license
+
+#include <jsoncons/json.hpp>
+#include <jsoncons/json_reclaimer.hpp>
+#include <catch/catch.hpp>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace jsoncons;
+
+namespace {
+
+    struct destruction_log
+    {
+        std::atomic<std::size_t> count{0};
+        std::atomic<bool> on_caller_thread{false};
+        std::thread::id caller = std::this_thread::get_id();
+    };
+
+    struct tracked
+    {
+        destruction_log* log;
+
+        explicit tracked(destruction_log* log)
+            : log(log)
+        {
+        }
+
+        tracked(tracked&& other) noexcept
+            : log(other.log)
+        {
+            other.log = nullptr;
+        }
+
+        ~tracked() noexcept
+        {
+            if (log != nullptr)
+            {
+                if (std::this_thread::get_id() == log->caller)
+                {
+                    log->on_caller_thread = true;
+                }
+                ++log->count;
+            }
+        }
+    };
+
+    json make_document(std::size_t n)
+    {
+        json doc(json_array_arg);
+        doc.reserve(n);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            json item;
+            item.try_emplace("id", i);
+            item.try_emplace("name", std::string("a name that is too long for a short string ") + std::to_string(i));
+            item.try_emplace("tags", json(json_array_arg, {"x", "y", "z"}));
+            doc.push_back(std::move(item));
+        }
+        return doc;
+    }
+}
+
+TEST_CASE("json_reclaimer destroys values on its threads")
+{
+    destruction_log log;
+    {
+        json_reclaimer reclaimer(2);
+        for (int i = 0; i < 10; ++i)
+        {
+            reclaimer.reclaim(tracked(&log));
+        }
+        reclaimer.wait();
+        CHECK(reclaimer.pending() == 0);
+        CHECK(log.count == 10);
+        CHECK_FALSE(log.on_caller_thread);
+    }
+}
+
+TEST_CASE("json_reclaimer destroys queued values before it is destroyed")
+{
+    destruction_log log;
+    {
+        json_reclaimer reclaimer;
+        for (int i = 0; i < 100; ++i)
+        {
+            reclaimer.reclaim(tracked(&log));
+        }
+    }
+    CHECK(log.count == 100);
+    CHECK_FALSE(log.on_caller_thread);
+}
+
+TEST_CASE("json_reclaimer with json")
+{
+    json_reclaimer reclaimer;
+
+    json doc = make_document(10000);
+    json subtree = doc[5000];
+    reclaimer.reclaim(std::move(doc));
+    CHECK(doc.is_null());
+
+    reclaimer.reclaim(std::unique_ptr<json>(new json(make_document(100))));
+    reclaimer.wait();
+    CHECK(reclaimer.pending() == 0);
+    CHECK(subtree["id"].as<int>() == 5000);
+}
+
+TEST_CASE("json_reclaimer with arena")
+{
+    json_reclaimer reclaimer;
+
+    std::string input = make_document(1000).to_string();
+
+    SECTION("document in arena")
+    {
+        arena a;
+        json_arena doc = json_arena::parse(result_allocator_arg, a, input);
+        REQUIRE(doc.size() == 1000);
+
+        reclaimer.reclaim(std::move(doc));
+        CHECK(doc.is_null());
+        CHECK(reclaimer.pending() == 0);
+        a.release();
+        CHECK(a.bytes_reserved() == 0);
+    }
+
+    SECTION("arena released on a worker thread")
+    {
+        std::unique_ptr<arena> a(new arena());
+        json_arena doc = json_arena::parse(result_allocator_arg, *a, input);
+        reclaimer.reclaim(std::move(doc));
+        reclaimer.reclaim(std::move(a));
+        reclaimer.wait();
+        CHECK(reclaimer.pending() == 0);
+    }
+
+    SECTION("json_arena on the heap")
+    {
+        json_arena doc = json_arena::parse(input);
+        REQUIRE(doc.get_allocator().get_arena() == nullptr);
+        reclaimer.reclaim(std::move(doc));
+        reclaimer.wait();
+        CHECK(reclaimer.pending() == 0);
+    }
+}
@@ -0,0 +1,155 @@
+// Copyright 2021 Daniel Parker
+// Distributed under Boost license
+
+#include <jsoncons/json.hpp>
+#include <jsoncons/mmap_source.hpp>
+#include <jsoncons_ext/cbor/cbor.hpp>
+#include <jsoncons_ext/msgpack/msgpack.hpp>
+#include <jsoncons_ext/csv/csv.hpp>
+#include <catch/catch.hpp>
+#include <algorithm>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#if defined(JSONCONS_HAS_MMAP)
+
+using namespace jsoncons;
+
+namespace {
+
+    template <class Container>
+    void write_file(const std::string& path, const Container& data)
+    {
+        std::ofstream os(path, std::ios::binary);
+        os.write(reinterpret_cast<const char*>(data.data()), data.size());
+    }
+
+} // namespace
+
+TEST_CASE("mmap_source with json_reader")
+{
+    SECTION("same result as stream")
+    {
+        std::ifstream is("./input/address-book.json");
+        json expected = json::parse(is);
+
+        json_decoder<json> decoder;
+        basic_json_reader<char,mmap_source<char>> reader(mmap_source<char>("./input/address-book.json"), decoder);
+        reader.read();
+        CHECK(decoder.get_result() == expected);
+    }
+
+    SECTION("byte order mark is skipped")
+    {
+        write_file("./output/mmap_bom.json", std::string("\xEF\xBB\xBF[1,\"two\"]"));
+
+        json_decoder<json> decoder;
+        basic_json_reader<char,mmap_source<char>> reader(mmap_source<char>("./output/mmap_bom.json"), decoder);
+        reader.read();
+        CHECK(decoder.get_result() == json::parse("[1,\"two\"]"));
+    }
+
+    SECTION("missing file")
+    {
+        mmap_source<char> source("./input/does-not-exist.json");
+        CHECK(source.is_error());
+        CHECK(source.error_code());
+
+        json_decoder<json> decoder;
+        basic_json_reader<char,mmap_source<char>> reader(std::move(source), decoder);
+        std::error_code ec;
+        reader.read(ec);
+        CHECK(ec == json_errc::source_error);
+    }
+
+    SECTION("empty file")
+    {
+        write_file("./output/mmap_empty.json", std::string());
+
+        json_decoder<json> decoder;
+        basic_json_reader<char,mmap_source<char>> reader(mmap_source<char>("./output/mmap_empty.json"), decoder);
+        std::error_code ec;
+        reader.read(ec);
+        CHECK(ec == json_errc::unexpected_eof);
+    }
+}
+
+TEST_CASE("mmap_source with json_cursor")
+{
+    write_file("./output/mmap_cursor.json", std::string(R"({"a":[1,2.5,"three"]})"));
+
+    basic_json_cursor<char,mmap_source<char>> cursor(mmap_source<char>("./output/mmap_cursor.json"));
+    std::vector<staj_event_type> events;
+    for (; !cursor.done(); cursor.next())
+    {
+        events.push_back(cursor.current().event_type());
+    }
+    std::vector<staj_event_type> expected = {staj_event_type::begin_object, staj_event_type::key,
+        staj_event_type::begin_array, staj_event_type::uint64_value, staj_event_type::double_value,
+        staj_event_type::string_value, staj_event_type::end_array, staj_event_type::end_object};
+    CHECK(events == expected);
+}
+
+TEST_CASE("mmap_source with csv_reader")
+{
+    write_file("./output/mmap.csv", std::string("a,b\n1,2\n3,4\n"));
+
+    auto options = csv::csv_options{}.assume_header(true);
+    json_decoder<ojson> decoder;
+    csv::basic_csv_reader<char,mmap_source<char>> reader(mmap_source<char>("./output/mmap.csv"), decoder, options);
+    reader.read();
+    CHECK(decoder.get_result() == ojson::parse(R"([{"a":1,"b":2},{"a":3,"b":4}])"));
+}
+
+TEST_CASE("binary_mmap_source with binary parsers")
+{
+    json j = json::parse(R"({"name":"Jane","scores":[1,-2,3.5],"tags":{"x":true,"y":null}})");
+
+    SECTION("cbor")
+    {
+        std::vector<uint8_t> data;
+        cbor::encode_cbor(j, data);
+        write_file("./output/mmap.cbor", data);
+
+        json_decoder<json> decoder;
+        cbor::basic_cbor_reader<binary_mmap_source> reader(binary_mmap_source("./output/mmap.cbor"), decoder);
+        reader.read();
+        CHECK(decoder.get_result() == j);
+
+        cbor::basic_cbor_cursor<binary_mmap_source> cursor(binary_mmap_source("./output/mmap.cbor"));
+        CHECK(cursor.current().event_type() == staj_event_type::begin_object);
+    }
+
+    SECTION("msgpack")
+    {
+        std::vector<uint8_t> data;
+        msgpack::encode_msgpack(j, data);
+        write_file("./output/mmap.mp", data);
+
+        json_decoder<json> decoder;
+        msgpack::basic_msgpack_reader<binary_mmap_source> reader(binary_mmap_source("./output/mmap.mp"), decoder);
+        reader.read();
+        CHECK(decoder.get_result() == j);
+    }
+
+    SECTION("missing file")
+    {
+        json_decoder<json> decoder;
+        cbor::basic_cbor_reader<binary_mmap_source> reader(binary_mmap_source("./input/does-not-exist.cbor"), decoder);
+        std::error_code ec;
+        reader.read(ec);
+        CHECK(ec);
+    }
+}
+
+#if defined(_WIN32)
+TEST_CASE("mmap_source does not leave the windows.h min and max macros defined")
+{
+    // Would not compile if windows.h had defined min and max
+    CHECK(std::min(1, 2) == 1);
+    CHECK(std::max(1, 2) == 2);
+}
+#endif
+
+#endif // JSONCONS_HAS_MMAP
@@ -0,0 +1,163 @@
+// Copyright 2021 Daniel Parker
+// Distributed under Boost license
+
+#include <jsoncons/json.hpp>
+#include <jsoncons/on_demand_json.hpp>
+#include <catch/catch.hpp>
+#include <string>
+#include <vector>
+
+using namespace jsoncons;
+
+TEST_CASE("on_demand_json accessors")
+{
+    std::string s = R"(
+    {
+        "name" : "Toronto",
+        "population" : 2731571,
+        "area" : 630.2,
+        "offset" : -5,
+        "capital" : false,
+        "mayor" : null,
+        "neighbourhoods" : ["Annex", "Leslieville", "Yorkville"],
+        "coordinates" : {"lat" : 43.7, "lon" : -79.4},
+        "" : "empty"
+    }
+    )";
+
+    on_demand_json doc(s);
+
+    REQUIRE(doc.is_object());
+    CHECK(doc.size() == 9);
+    CHECK(doc.at("name").as<std::string>() == "Toronto");
+    CHECK(doc.at("name").as<string_view>() == "Toronto");
+    CHECK(doc.at("population").as<int>() == 2731571);
+    CHECK(doc.at("population").type() == json_type::uint64_value);
+    CHECK(doc.at("area").as<double>() == 630.2);
+    CHECK(doc.at("area").type() == json_type::double_value);
+    CHECK(doc.at("offset").as<int64_t>() == -5);
+    CHECK(doc.at("offset").type() == json_type::int64_value);
+    CHECK_FALSE(doc.at("capital").as<bool>());
+    CHECK(doc.at("mayor").is_null());
+    CHECK(doc.at("").as<std::string>() == "empty");
+
+    CHECK(doc["neighbourhoods"].size() == 3);
+    CHECK(doc["neighbourhoods"][1].as<std::string>() == "Leslieville");
+    CHECK(doc["coordinates"]["lon"].as<double>() == -79.4);
+    CHECK(doc["coordinates"].raw() == R"({"lat" : 43.7, "lon" : -79.4})");
+
+    CHECK(doc.contains("mayor"));
+    CHECK_FALSE(doc.contains("province"));
+    CHECK_THROWS_AS(doc.at("province"), key_not_found);
+    CHECK_THROWS_AS(doc.at("name").at("first"), not_an_object);
+    CHECK_THROWS(doc["neighbourhoods"].at(3));
+
+    auto v = doc["neighbourhoods"].as<std::vector<std::string>>();
+    CHECK(v == std::vector<std::string>{"Annex", "Leslieville", "Yorkville"});
+}
+
+TEST_CASE("on_demand_json ranges")
+{
+    std::string s = R"({"a" : [1, [2, 3], {"b" : "]}"}, "x\"y"], "cd" : {}, "e" : []})";
+
+    on_demand_json doc(s);
+
+    std::vector<std::string> keys;
+    for (const auto& member : doc.object_range())
+    {
+        keys.emplace_back(member.key());
+    }
+    CHECK(keys == std::vector<std::string>{"a", "cd", "e"});
+    CHECK(doc.contains("cd"));
+    CHECK(doc["cd"].size() == 0);
+    CHECK(doc["e"].size() == 0);
+    CHECK(doc["e"].array_range().begin() == doc["e"].array_range().end());
+
+    std::vector<std::string> elements;
+    for (const auto& element : doc["a"].array_range())
+    {
+        elements.emplace_back(element.raw());
+    }
+    CHECK(elements == std::vector<std::string>{"1", "[2, 3]", R"({"b" : "]}"})", R"("x\"y")"});
+    CHECK(doc["a"][2]["b"].as<std::string>() == "]}");
+    CHECK(doc["a"][3].as<std::string>() == "x\"y");
+    CHECK_THROWS(doc["a"][3].as<string_view>());
+}
+
+TEST_CASE("on_demand_json to_json")
+{
+    std::string s = R"({"a" : [1, 2.5, "three", true, null], "b" : {"c" : -1}})";
+
+    on_demand_json doc(s);
+
+    json j = doc.to_json<json>();
+    CHECK(j == json::parse(s));
+    CHECK(doc["b"].to_json<ojson>() == ojson::parse(R"({"c" : -1})"));
+    CHECK(doc["a"].as<json>() == json::parse(R"([1, 2.5, "three", true, null])"));
+
+    std::string out;
+    compact_json_string_encoder encoder(out);
+    doc["b"].dump(encoder);
+    CHECK(out == R"({"c":-1})");
+}
+
+TEST_CASE("on_demand_json only parses what is visited")
+{
+    // The malformed value under "bad" is skipped
+    std::string s = R"({"bad" : [1, 2 3], "good" : 10})";
+    on_demand_json doc(s);
+    CHECK(doc["good"].as<int>() == 10);
+    CHECK_THROWS_AS(doc["bad"].to_json<json>(), ser_error);
+}
+
+TEST_CASE("on_demand_json errors")
+{
+    SECTION("missing colon")
+    {
+        std::string s = "{\n\"a\" 1}";
+        on_demand_json doc(s);
+        try
+        {
+            doc.at("a");
+            CHECK(false);
+        }
+        catch (const ser_error& e)
+        {
+            CHECK(e.code() == json_errc::expected_colon);
+            CHECK(e.line() == 2);
+            CHECK(e.column() == 5);
+        }
+    }
+    SECTION("unbalanced")
+    {
+        std::string s = R"({"a" : [1, 2})";
+        on_demand_json doc(s);
+        CHECK_THROWS_AS(doc.at("b"), ser_error);
+    }
+    SECTION("lookups stop before the rest of the container")
+    {
+        // The text after the member found is not scanned, so its truncation goes unnoticed
+        std::string s = R"({"a" : 1, "b" : [10, 20, {"c" : )";
+        on_demand_json doc(s);
+        CHECK(doc.at("a").as<int>() == 1);
+        CHECK(doc["b"][1].as<int>() == 20);
+        CHECK(doc.object_range().begin()->key() == "a");
+        CHECK_THROWS_AS(doc.size(), ser_error);
+        CHECK_THROWS_AS(doc.at("d"), ser_error);
+    }
+    SECTION("missing comma")
+    {
+        std::string s = R"([1 2])";
+        on_demand_json doc(s);
+        CHECK_THROWS_AS(doc.at(1), ser_error);
+    }
+}
+
+TEST_CASE("won_demand_json")
+{
+    std::wstring s = LR"({"a" : [1, {"b" : "]"}], "c" : "d"})";
+    won_demand_json doc(s);
+    CHECK(doc[L"c"].as<std::wstring>() == L"d");
+    CHECK(doc[L"a"][1][L"b"].as<std::wstring>() == L"]");
+    CHECK(doc[L"a"].size() == 2);
+}
@@ -0,0 +1,144 @@
+// Copyright 2021 Daniel Parker
+// Distributed under Boost license
+
+#include <jsoncons/json.hpp>
+#include <jsoncons/parallel_json_lines_reader.hpp>
+#include <catch/catch.hpp>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <algorithm>
+
+using namespace jsoncons;
+
+namespace {
+
+    std::string make_json_lines(std::size_t count)
+    {
+        std::string s;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            s.append("{\"id\":");
+            s.append(std::to_string(i));
+            s.append(",\"tags\":[\"a\",\"b\"]}");
+            s.append(i % 2 == 0 ? "\n" : "\r\n");
+            if (i % 10 == 0)
+            {
+                s.append("   \n"); // blank line
+            }
+        }
+        return s;
+    }
+
+    class object_counter : public default_json_visitor
+    {
+    public:
+        std::size_t count = 0;
+    private:
+        bool visit_end_object(const ser_context&, std::error_code&) override
+        {
+            ++count;
+            return true;
+        }
+    };
+
+} // namespace
+
+TEST_CASE("parallel_json_lines_reader tests")
+{
+    const std::size_t count = 1000;
+    std::string input = make_json_lines(count);
+    auto parallel_options = parallel_json_lines_options{}
+        .thread_count(4)
+        .chunk_length(256)
+        .max_chunks_in_flight(3);
+
+    SECTION("ordered from string")
+    {
+        parallel_json_lines_reader reader(json_options{}, parallel_options);
+        std::vector<int64_t> ids;
+        reader.read(jsoncons::string_view(input), [&](json&& j) {ids.push_back(j["id"].as<int64_t>());});
+
+        REQUIRE(ids.size() == count);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            CHECK(ids[i] == static_cast<int64_t>(i));
+        }
+    }
+
+    SECTION("unordered from stream")
+    {
+        parallel_json_lines_reader reader(json_options{}, parallel_options.ordered(false));
+        std::istringstream is(input);
+        std::vector<int64_t> ids;
+        reader.read(is, [&](json&& j) {ids.push_back(j["id"].as<int64_t>());});
+
+        REQUIRE(ids.size() == count);
+        std::sort(ids.begin(), ids.end());
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            CHECK(ids[i] == static_cast<int64_t>(i));
+        }
+    }
+
+    SECTION("several documents on a line")
+    {
+        parallel_json_lines_reader reader(json_options{}, parallel_options);
+        std::vector<json> values;
+        reader.read(jsoncons::string_view("[1] [2]\n3\n\"four\""), [&](json&& j) {values.push_back(std::move(j));});
+
+        REQUIRE(values.size() == 4);
+        CHECK(values[0] == json::parse("[1]"));
+        CHECK(values[1] == json::parse("[2]"));
+        CHECK(values[2] == 3);
+        CHECK(values[3] == "four");
+    }
+
+    SECTION("visitor per worker")
+    {
+        std::vector<object_counter> counters(4);
+        parallel_json_lines_reader reader(json_options{}, parallel_options);
+        reader.visit(jsoncons::string_view(input), 
+                     [&](std::size_t i) -> json_visitor& {return counters[i];});
+
+        std::size_t total = 0;
+        for (const auto& counter : counters)
+        {
+            total += counter.count;
+        }
+        CHECK(total == count);
+    }
+
+    SECTION("error line")
+    {
+        std::string s = input;
+        std::size_t pos = s.find('\n', s.size()/2) + 1;
+        s.insert(pos, "{\"id\" 1}\n");
+        std::size_t expected_line = std::count(s.begin(), s.begin() + pos, '\n') + 1;
+
+        parallel_json_lines_reader reader(json_options{}, parallel_options);
+        std::size_t delivered = 0;
+        std::error_code ec;
+        reader.read(jsoncons::string_view(s), [&](json&&) {++delivered;}, ec);
+        CHECK(ec == json_errc::expected_colon);
+
+        JSONCONS_TRY
+        {
+            reader.read(jsoncons::string_view(s), [](json&&) {});
+            CHECK(false);
+        }
+        JSONCONS_CATCH (const ser_error& e)
+        {
+            CHECK(e.code() == json_errc::expected_colon);
+            CHECK(e.line() == expected_line);
+        }
+    }
+
+    SECTION("truncated last document")
+    {
+        parallel_json_lines_reader reader(json_options{}, parallel_options);
+        std::error_code ec;
+        reader.read(jsoncons::string_view("[1,2]\n[3,"), [](json&&) {}, ec);
+        CHECK(ec == json_errc::unexpected_eof);
+    }
+}
@@ -0,0 +1,96 @@
+// Copyright 2021 Daniel Parker
+// Distributed under Boost license
+
+#include <jsoncons/json.hpp>
+#include <jsoncons/parallel_parse.hpp>
+#include <catch/catch.hpp>
+#include <string>
+#include <vector>
+
+using namespace jsoncons;
+
+namespace {
+
+    std::string parallel_parse_error(const std::string& s, std::size_t thread_count)
+    {
+        JSONCONS_TRY
+        {
+            parallel_parse<json>(s, json_options{}, thread_count);
+        }
+        JSONCONS_CATCH (const ser_error& e)
+        {
+            return e.what();
+        }
+        return std::string();
+    }
+
+    std::string sequential_parse_error(const std::string& s)
+    {
+        JSONCONS_TRY
+        {
+            json::parse(s);
+        }
+        JSONCONS_CATCH (const ser_error& e)
+        {
+            return e.what();
+        }
+        return std::string();
+    }
+
+} // namespace
+
+TEST_CASE("parallel_parse tests")
+{
+    std::string big = "[\n";
+    for (std::size_t i = 0; i < 20000; ++i)
+    {
+        if (i > 0)
+        {
+            big.append(",\n");
+        }
+        big.append("{\"id\":");
+        big.append(std::to_string(i));
+        big.append(",\"s\":\"a,b]\\\"[\",\"v\":[1.5,{\"x\":[true,null]}]}");
+    }
+    big.append("\n]\n");
+
+    SECTION("same result as json::parse")
+    {
+        json expected = json::parse(big);
+        CHECK(parallel_parse<json>(big, json_options{}, 1) == expected);
+        CHECK(parallel_parse<json>(big, json_options{}, 4) == expected);
+    }
+
+    SECTION("small and other inputs")
+    {
+        std::vector<std::string> inputs = {"[]", " [ ] ", "[1]", "[1, [2, 3], {\"a\":[4]}, \"5,]\"]",
+                                           "{\"a\":[1,2]}", "42", "\xEF\xBB\xBF[1,2]", "[1 /* a,b */, 2]"};
+        for (const auto& s : inputs)
+        {
+            CHECK(parallel_parse<json>(s, json_options{}, 3) == json::parse(s));
+        }
+    }
+
+    SECTION("same error position as json::parse")
+    {
+        std::vector<std::string> inputs = {"[1,2,]", "[1,,2]", "[1 2]", "[1,{]}", "[1,2] x", "[1,2", 
+                                           "[\"a,\"b\"]", "[1,2]]"};
+        std::string s = big;
+        s.insert(s.size()/2, "}");
+        inputs.push_back(s);
+
+        for (const auto& input : inputs)
+        {
+            std::string expected = sequential_parse_error(input);
+            CHECK_FALSE(expected.empty());
+            CHECK(parallel_parse_error(input, 4) == expected);
+        }
+    }
+
+    SECTION("max nesting depth")
+    {
+        auto options = json_options{}.max_nesting_depth(2);
+        REQUIRE_THROWS_AS(parallel_parse<json>(std::string("[[[1]]]"), options, 2), ser_error);
+        CHECK(parallel_parse<json>(std::string("[[1],[2]]"), options, 2) == json::parse("[[1],[2]]"));
+    }
+}
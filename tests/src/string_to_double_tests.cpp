@@ -53,3 +53,34 @@ TEST_CASE("test_exponent")
 
 }
 
+
+TEST_CASE("to_double_t fast path")
+{
+    jsoncons::detail::to_double_t to_double;
+
+    SECTION("same result as strtod")
+    {
+        std::vector<std::string> inputs = {"0", "-0", "0.1", "-2.5e-3", "1e23", "9007199254740993",
+            "2.2250738585072011e-308", "2.2250738585072012e-308", "4.9406564584124654e-324",
+            "2.4703282292062328e-324", "1.7976931348623157e308", "1.7976931348623159e308", "1e-400",
+            "123456789012345678901234567890", "1.00000000000000011102230246251565404236316680908203125"};
+        for (const auto& s : inputs)
+        {
+            double expected = strtod(s.c_str(), nullptr);
+            CHECK(to_double(s.c_str(), s.length()) == expected);
+        }
+    }
+
+    SECTION("stops at the first character that is not part of the number")
+    {
+        char buffer[32] = "1.5";
+        CHECK(to_double(buffer, sizeof(buffer)) == 1.5);
+        CHECK(to_double("2.5,", 4) == 2.5);
+    }
+
+    SECTION("copies")
+    {
+        jsoncons::detail::to_double_t copy(to_double);
+        CHECK(copy("-1.25", 5) == -1.25);
+    }
+}
@@ -214,3 +214,66 @@ TEST_CASE("ubjson_cursor with filter tests")
     CHECK(filtered_c.done());
 }
 
+
+TEST_CASE("ubjson_cursor skip")
+{
+    SECTION("counted")
+    {
+        json j = json::parse(R"({"a" : [1, {"b" : [2, "x", -3.5, null]}, 3], "c" : {"d" : "e"}, "f" : true})");
+        std::vector<uint8_t> data;
+        ubjson::encode_ubjson(j, data);
+
+        ubjson::ubjson_bytes_cursor cursor(data);
+        REQUIRE(cursor.current().event_type() == staj_event_type::begin_object);
+        cursor.next();
+        cursor.next();
+        REQUIRE(cursor.current().event_type() == staj_event_type::begin_array);
+        cursor.skip();
+        CHECK(cursor.current().get<std::string>() == "c");
+        cursor.next();
+        cursor.skip();
+        CHECK(cursor.current().get<std::string>() == "f");
+        cursor.next();
+        CHECK(cursor.current().get<bool>());
+        cursor.next();
+        CHECK(cursor.current().event_type() == staj_event_type::end_object);
+        cursor.next();
+        CHECK(cursor.done());
+    }
+
+    SECTION("strongly typed and uncounted")
+    {
+        // {"a" : [int32 x 3], "b" : {"c" : ["x"]}, "d" : 7}, objects without counts
+        std::vector<uint8_t> data = {'{',
+            'i',1,'a','[','$','l','#','i',3, 0,0,0,1, 0,0,0,2, 0,0,0,3,
+            'i',1,'b','{','i',1,'c','[','S','i',1,'x',']','}',
+            'i',1,'d','U',7,
+            '}'};
+
+        ubjson::ubjson_bytes_cursor cursor(data);
+        cursor.next();
+        cursor.next();
+        REQUIRE(cursor.current().event_type() == staj_event_type::begin_array);
+        cursor.skip();
+        CHECK(cursor.current().get<std::string>() == "b");
+        cursor.next();
+        REQUIRE(cursor.current().event_type() == staj_event_type::begin_object);
+        cursor.skip();
+        CHECK(cursor.current().get<std::string>() == "d");
+        cursor.next();
+        CHECK(cursor.current().get<int>() == 7);
+        cursor.next();
+        CHECK(cursor.current().event_type() == staj_event_type::end_object);
+    }
+
+    SECTION("unexpected end")
+    {
+        std::vector<uint8_t> data = {'{','i',1,'a','[','$','l','#','i',3, 0,0,0,1, 0,0};
+        ubjson::ubjson_bytes_cursor cursor(data);
+        cursor.next();
+        cursor.next();
+        std::error_code ec;
+        cursor.skip(ec);
+        CHECK(ec == ubjson::ubjson_errc::unexpected_eof);
+    }
+}